@@ -0,0 +1,84 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+namespace cppcore {
+namespace Bench {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		Timer
+///	@ingroup	Benchmark
+///
+///	@brief  Simple wall-clock timer for the benchmarks.
+//-------------------------------------------------------------------------------------------------
+class Timer {
+public:
+    /// @brief  The class constructor, the timer will be started.
+    Timer() : mStart(std::chrono::steady_clock::now()) {
+        // empty
+    }
+
+    /// @brief  Will restart the timer.
+    void restart() {
+        mStart = std::chrono::steady_clock::now();
+    }
+
+    /// @brief  Will return the elapsed time since the start in seconds.
+    /// @return The elapsed time.
+    double elapsed() const {
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - mStart).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point mStart;
+};
+
+/// @brief  Will keep the compiler from optimizing away a benchmark result.
+/// @param[in] value    The value to keep.
+template <class T>
+inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static volatile const void *sink = nullptr;
+    sink = &value;
+    static_cast<void>(sink);
+#endif
+}
+
+/// @brief  Will print one benchmark result line.
+/// @param[in] name     The name of the benchmark.
+/// @param[in] seconds  The measured time.
+/// @param[in] items    The number of processed items.
+inline void report(const char *name, double seconds, size_t items) {
+    const double nsPerItem = seconds * 1e9 / static_cast<double>(items);
+    const double itemsPerSec = static_cast<double>(items) / seconds;
+    ::printf("%-48s %10.3f ms %8.2f ns/item %10.2f M items/s\n", name, seconds * 1e3, nsPerItem, itemsPerSec / 1e6);
+}
+
+} // namespace Bench
+} // namespace cppcore
@@ -0,0 +1,101 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/Sort.h>
+#include <cppcore/Container/TEytzingerArray.h>
+
+#include "../BenchCommon.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace cppcore;
+
+namespace {
+
+void runBenchmark(size_t num, size_t numQueries) {
+    std::vector<int32_t> sorted(num);
+    for (size_t i = 0; i < num; ++i) {
+        sorted[i] = static_cast<int32_t>(i * 2);
+    }
+    std::vector<int32_t> keys(numQueries);
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    for (size_t i = 0; i < numQueries; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        keys[i] = static_cast<int32_t>(state % (num * 2));
+    }
+    TEytzingerArray<int32_t> table(sorted.data(), num);
+    char label[128];
+    const size_t kb = num * sizeof(int32_t) / 1024;
+
+    Bench::Timer timer;
+    int64_t checksum = 0;
+    for (int32_t key : keys) {
+        checksum += binSearch(key, sorted.data(), num, compAscending<int32_t>);
+    }
+    ::snprintf(label, sizeof(label), "binSearch %zu KB", kb);
+    Bench::report(label, timer.elapsed(), numQueries);
+    Bench::doNotOptimize(checksum);
+
+    timer.restart();
+    size_t sum = 0;
+    for (int32_t key : keys) {
+        sum += static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+    }
+    ::snprintf(label, sizeof(label), "std::lower_bound %zu KB", kb);
+    Bench::report(label, timer.elapsed(), numQueries);
+    Bench::doNotOptimize(sum);
+
+    timer.restart();
+    size_t branchless = 0;
+    for (int32_t key : keys) {
+        branchless += lowerBound(sorted.data(), num, key);
+    }
+    ::snprintf(label, sizeof(label), "lowerBound %zu KB", kb);
+    Bench::report(label, timer.elapsed(), numQueries);
+
+    timer.restart();
+    size_t eytzinger = 0;
+    for (int32_t key : keys) {
+        eytzinger += table.lowerBound(key);
+    }
+    ::snprintf(label, sizeof(label), "TEytzingerArray %zu KB", kb);
+    Bench::report(label, timer.elapsed(), numQueries);
+    if (branchless != sum || eytzinger != sum) {
+        ::printf("    results differ\n");
+    }
+}
+
+} // namespace
+
+int main() {
+    // From L1 to DRAM
+    for (size_t num = 1024; num <= 16 * 1024 * 1024; num *= 8) {
+        runBenchmark(num, 2000000);
+    }
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/Checksum.h>
+#include <cppcore/Common/CPUInfo.h>
+#include <cppcore/Common/Hash.h>
+
+#include "../BenchCommon.h"
+
+#include <vector>
+
+using namespace cppcore;
+
+namespace {
+
+template <class TFunc>
+void runBenchmark(const char *name, const std::vector<uint8_t> &data, size_t blockSize, TFunc func) {
+    const size_t Rounds = 20000 * 4096 / data.size();
+    const size_t numBlocks = data.size() / blockSize;
+    char label[128];
+    uint64_t sum = 0;
+    Bench::Timer timer;
+    for (size_t r = 0; r < Rounds; ++r) {
+        for (size_t i = 0; i < numBlocks; ++i) {
+            sum += func(data.data() + i * blockSize, blockSize);
+        }
+    }
+    const double seconds = timer.elapsed();
+    const double bytes = static_cast<double>(Rounds * numBlocks * blockSize);
+    ::snprintf(label, sizeof(label), "%s %zu B blocks (%.2f GB/s)", name, blockSize, bytes / seconds / 1e9);
+    Bench::report(label, seconds, Rounds * numBlocks);
+    Bench::doNotOptimize(sum);
+}
+
+void runAll(const std::vector<uint8_t> &data, size_t blockSize) {
+    runBenchmark("crc32c sse4.2", data, blockSize, [](const uint8_t *p, size_t len) { return crc32c(p, len); });
+    CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::Scalar);
+    runBenchmark("crc32c table", data, blockSize, [](const uint8_t *p, size_t len) { return crc32c(p, len); });
+    runBenchmark("adler32 scalar", data, blockSize, [](const uint8_t *p, size_t len) { return adler32(p, len); });
+    CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::SSE42);
+    runBenchmark("adler32 sse4.2", data, blockSize, [](const uint8_t *p, size_t len) { return adler32(p, len); });
+    CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::AVX2);
+    runBenchmark("adler32 avx2", data, blockSize, [](const uint8_t *p, size_t len) { return adler32(p, len); });
+    runBenchmark("xxh64", data, blockSize, [](const uint8_t *p, size_t len) { return xxh64(p, len); });
+    runBenchmark("hash64", data, blockSize, [](const uint8_t *p, size_t len) { return hash64(p, len); });
+}
+
+} // namespace
+
+int main() {
+    std::vector<uint8_t> data(1024 * 1024);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 2654435761u >> 24);
+    }
+    runAll(data, 4096);
+    runAll(data, 64 * 1024);
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/Clock.h>
+
+#include "../BenchCommon.h"
+
+#include <chrono>
+
+using namespace cppcore;
+
+namespace {
+
+class SumSink : public TimerSink {
+public:
+    void report(const char *, uint64_t nanoseconds) override {
+        total += nanoseconds;
+    }
+
+    uint64_t total{0};
+};
+
+void runClockBenchmark(size_t num) {
+    ::printf("Clock uses the time stamp counter: %s\n", Clock::usesTimeStampCounter() ? "yes" : "no");
+    uint64_t sum = 0;
+    Bench::Timer timer;
+    for (size_t i = 0; i < num; ++i) {
+        sum += Clock::now();
+    }
+    Bench::report("Clock::now", timer.elapsed(), num);
+
+    timer.restart();
+    for (size_t i = 0; i < num; ++i) {
+        sum += Clock::ticks();
+    }
+    Bench::report("Clock::ticks", timer.elapsed(), num);
+
+    timer.restart();
+    for (size_t i = 0; i < num; ++i) {
+        sum += static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+    Bench::report("std::chrono::steady_clock::now", timer.elapsed(), num);
+
+    SumSink sink;
+    timer.restart();
+    for (size_t i = 0; i < num; ++i) {
+        ScopedTimer scoped(sink, "loop");
+    }
+    Bench::report("ScopedTimer", timer.elapsed(), num);
+    Bench::doNotOptimize(sum);
+    Bench::doNotOptimize(sink.total);
+}
+
+} // namespace
+
+int main() {
+    runClockBenchmark(10000000);
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/Hash.h>
+
+#include "../BenchCommon.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace cppcore;
+
+namespace {
+
+void runBenchmark(size_t keySize, size_t numKeys, size_t rounds) {
+    std::vector<uint8_t> data(keySize * numKeys);
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    for (uint8_t &byte : data) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        byte = static_cast<uint8_t>(state >> 56);
+    }
+    std::vector<std::string> strings(numKeys);
+    for (size_t i = 0; i < numKeys; ++i) {
+        strings[i].assign(reinterpret_cast<const char *>(data.data() + i * keySize), keySize);
+    }
+    const size_t numBytes = keySize * numKeys * rounds;
+    char label[128];
+
+    Bench::Timer timer;
+    HashId sum = 0;
+    for (size_t r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < numKeys; ++i) {
+            sum += fnv1aHash(data.data() + i * keySize, keySize);
+        }
+    }
+    double seconds = timer.elapsed();
+    ::snprintf(label, sizeof(label), "fnv1aHash %zu bytes (%.2f GB/s)", keySize, numBytes / seconds / 1e9);
+    Bench::report(label, seconds, numKeys * rounds);
+
+    timer.restart();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < numKeys; ++i) {
+            sum += std::hash<std::string>()(strings[i]);
+        }
+    }
+    seconds = timer.elapsed();
+    ::snprintf(label, sizeof(label), "std::hash %zu bytes (%.2f GB/s)", keySize, numBytes / seconds / 1e9);
+    Bench::report(label, seconds, numKeys * rounds);
+
+    timer.restart();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < numKeys; ++i) {
+            sum += hash64(data.data() + i * keySize, keySize);
+        }
+    }
+    seconds = timer.elapsed();
+    ::snprintf(label, sizeof(label), "hash64 %zu bytes (%.2f GB/s)", keySize, numBytes / seconds / 1e9);
+    Bench::report(label, seconds, numKeys * rounds);
+
+    timer.restart();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < numKeys; ++i) {
+            Hasher64 hasher;
+            hasher.update(data.data() + i * keySize, keySize);
+            sum += hasher.finish();
+        }
+    }
+    seconds = timer.elapsed();
+    ::snprintf(label, sizeof(label), "Hasher64 %zu bytes (%.2f GB/s)", keySize, numBytes / seconds / 1e9);
+    Bench::report(label, seconds, numKeys * rounds);
+    Bench::doNotOptimize(sum);
+}
+
+void runIntBenchmark(size_t num) {
+    Bench::Timer timer;
+    HashId sum = 0;
+    for (uint64_t i = 0; i < num; ++i) {
+        sum += mix64(i);
+    }
+    Bench::report("mix64", timer.elapsed(), num);
+
+    timer.restart();
+    for (uint64_t i = 0; i < num; ++i) {
+        sum += fnv1aHash(&i, sizeof(i));
+    }
+    Bench::report("fnv1aHash uint64", timer.elapsed(), num);
+    Bench::doNotOptimize(sum);
+}
+
+} // namespace
+
+int main() {
+    for (size_t keySize : { 4u, 8u, 16u, 24u, 32u, 64u }) {
+        runBenchmark(keySize, 4096, 2000);
+    }
+    runBenchmark(1024, 1024, 100);
+    runBenchmark(64 * 1024, 16, 100);
+    runIntBenchmark(100000000);
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/NumberConversion.h>
+
+#include "../BenchCommon.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+using namespace cppcore;
+
+namespace {
+
+constexpr size_t NumValues = 1000000;
+
+// Mixed magnitudes, like coordinates and timings in a log
+std::vector<double> createValues() {
+    std::vector<double> values(NumValues);
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    for (size_t i = 0; i < NumValues; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const double scale = static_cast<double>(1ull << (state % 40)) / 65536.0;
+        values[i] = static_cast<double>(state >> 11) / static_cast<double>(1ull << 53) * scale;
+    }
+    return values;
+}
+
+std::vector<char> formatAll(const std::vector<double> &values, std::vector<size_t> &offsets) {
+    std::vector<char> text;
+    char buffer[MaxFloatChars];
+    for (double value : values) {
+        offsets.push_back(text.size());
+        const size_t len = formatFloat(value, buffer, sizeof(buffer));
+        text.insert(text.end(), buffer, buffer + len);
+        text.push_back('\0');
+    }
+    offsets.push_back(text.size());
+    return text;
+}
+
+void runFormatBenchmark(const std::vector<double> &values) {
+    char buffer[64];
+    size_t numChars = 0;
+    Bench::Timer timer;
+    for (double value : values) {
+        numChars += formatFloat(value, buffer, sizeof(buffer));
+    }
+    Bench::report("formatFloat", timer.elapsed(), values.size());
+
+    timer.restart();
+    for (double value : values) {
+        numChars += static_cast<size_t>(::snprintf(buffer, sizeof(buffer), "%.17g", value));
+    }
+    Bench::report("snprintf %.17g", timer.elapsed(), values.size());
+
+    timer.restart();
+    for (double value : values) {
+        std::ostringstream stream;
+        stream.precision(17);
+        stream << value;
+        numChars += stream.str().size();
+    }
+    Bench::report("std::ostringstream", timer.elapsed(), values.size());
+
+    timer.restart();
+    for (size_t i = 0; i < values.size(); ++i) {
+        numChars += formatInt(static_cast<int64_t>(values[i] * 1000.0), buffer, sizeof(buffer));
+    }
+    Bench::report("formatInt", timer.elapsed(), values.size());
+
+    timer.restart();
+    for (size_t i = 0; i < values.size(); ++i) {
+        numChars += static_cast<size_t>(::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(values[i] * 1000.0)));
+    }
+    Bench::report("snprintf %lld", timer.elapsed(), values.size());
+    Bench::doNotOptimize(numChars);
+}
+
+void runParseBenchmark(const std::vector<char> &text, const std::vector<size_t> &offsets) {
+    const size_t count = offsets.size() - 1;
+    double sum = 0.0;
+    Bench::Timer timer;
+    for (size_t i = 0; i < count; ++i) {
+        double value = 0.0;
+        parseFloat(TStringView<char>(text.data() + offsets[i], offsets[i + 1] - offsets[i] - 1), value);
+        sum += value;
+    }
+    Bench::report("parseFloat", timer.elapsed(), count);
+
+    timer.restart();
+    for (size_t i = 0; i < count; ++i) {
+        sum += ::strtod(text.data() + offsets[i], nullptr);
+    }
+    Bench::report("strtod", timer.elapsed(), count);
+
+    timer.restart();
+    for (size_t i = 0; i < count; ++i) {
+        std::istringstream stream(text.data() + offsets[i]);
+        double value = 0.0;
+        stream >> value;
+        sum += value;
+    }
+    Bench::report("std::istringstream", timer.elapsed(), count);
+    Bench::doNotOptimize(sum);
+}
+
+} // namespace
+
+int main() {
+    const std::vector<double> values = createValues();
+    std::vector<size_t> offsets;
+    const std::vector<char> text = formatAll(values, offsets);
+    runFormatBenchmark(values);
+    runParseBenchmark(text, offsets);
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/Sort.h>
+#include <cppcore/Common/ThreadPool.h>
+
+#include "../BenchCommon.h"
+
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace cppcore;
+
+namespace {
+
+template <class TSort>
+void runScaling(const char *name, const std::vector<uint64_t> &input, TSort sortFunc) {
+    const size_t num = input.size();
+    const size_t maxThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+    std::vector<uint64_t> data(num), buffer(num);
+    char label[128];
+    double baseTime = 0.0;
+    for (size_t numThreads = 1; ; numThreads = numThreads * 2 < maxThreads ? numThreads * 2 : maxThreads) {
+        // The calling thread works as well
+        ThreadPool pool(numThreads - 1);
+        data = input;
+        Bench::Timer timer;
+        sortFunc(data.data(), num, buffer.data(), &pool);
+        const double seconds = timer.elapsed();
+        if (numThreads == 1) {
+            baseTime = seconds;
+        }
+        ::snprintf(label, sizeof(label), "%s %zu threads", name, numThreads);
+        Bench::report(label, seconds, num);
+        ::printf("    speedup %.2fx\n", baseTime / seconds);
+        if (numThreads == maxThreads) {
+            break;
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    // The number of elements can be passed, like 100000000
+    const size_t num = argc > 1 ? static_cast<size_t>(::strtoull(argv[1], nullptr, 10)) : 10000000;
+    std::vector<uint64_t> input(num);
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    for (size_t i = 0; i < num; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        input[i] = state % (num / 4 + 1);
+    }
+
+    runScaling("parallelSort", input, [](uint64_t *data, size_t n, uint64_t *buffer, ThreadPool *pool) {
+        parallelSort(data, n, buffer, TLess<uint64_t>(), pool);
+    });
+    runScaling("parallelStableSort", input, [](uint64_t *data, size_t n, uint64_t *buffer, ThreadPool *pool) {
+        parallelStableSort(data, n, buffer, TLess<uint64_t>(), pool);
+    });
+
+    return 0;
+}
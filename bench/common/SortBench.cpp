@@ -0,0 +1,233 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/Sort.h>
+
+#include "../BenchCommon.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace cppcore;
+
+namespace {
+
+struct Record {
+    uint64_t key;
+    uint64_t payload[3];
+
+    bool operator<(const Record &rhs) const {
+        return key < rhs.key;
+    }
+};
+
+static_assert(sizeof(Record) == 32, "The benchmark needs 32-byte records");
+
+int32_t compareRecord(const void *lhs, const void *rhs) {
+    const uint64_t l = static_cast<const Record *>(lhs)->key;
+    const uint64_t r = static_cast<const Record *>(rhs)->key;
+    // quicksort uses the inverted comparator convention, see compDescending
+    return (l < r) - (l > r);
+}
+
+template <class T>
+std::vector<T> makeInput(size_t num, T (*make)(uint64_t)) {
+    std::vector<T> data(num);
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    for (size_t i = 0; i < num; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        data[i] = make(state);
+    }
+    return data;
+}
+
+template <class T>
+void runBenchmark(const char *typeName, const std::vector<T> &input, ComparisonFn func) {
+    char label[128];
+    const size_t num = input.size();
+
+    std::vector<T> data = input;
+    Bench::Timer timer;
+    quicksort(data.data(), num, sizeof(T), func);
+    ::snprintf(label, sizeof(label), "quicksort %s", typeName);
+    Bench::report(label, timer.elapsed(), num);
+
+    data = input;
+    timer.restart();
+    cppcore::sort(data.data(), num);
+    ::snprintf(label, sizeof(label), "sort %s", typeName);
+    Bench::report(label, timer.elapsed(), num);
+    if (!std::is_sorted(data.begin(), data.end())) {
+        ::printf("    sort result is wrong\n");
+    }
+
+    data = input;
+    timer.restart();
+    std::sort(data.begin(), data.end());
+    ::snprintf(label, sizeof(label), "std::sort %s", typeName);
+    Bench::report(label, timer.elapsed(), num);
+}
+
+template <class T>
+void runRadixBenchmark(const char *typeName, const std::vector<T> &input) {
+    char label[128];
+    const size_t num = input.size();
+    std::vector<T> data = input;
+    std::vector<T> scratch(num);
+    Bench::Timer timer;
+    radixSort(data.data(), num, scratch.data());
+    ::snprintf(label, sizeof(label), "radixSort %s", typeName);
+    Bench::report(label, timer.elapsed(), num);
+    if (!std::is_sorted(data.begin(), data.end())) {
+        ::printf("    radixSort result is wrong\n");
+    }
+
+    // Key-value variant with 32-bit payloads
+    data = input;
+    std::vector<uint32_t> values(num), valueScratch(num);
+    for (size_t i = 0; i < num; ++i) {
+        values[i] = static_cast<uint32_t>(i);
+    }
+    timer.restart();
+    radixSort(data.data(), values.data(), num, scratch.data(), valueScratch.data());
+    ::snprintf(label, sizeof(label), "radixSort key-value %s", typeName);
+    Bench::report(label, timer.elapsed(), num);
+}
+
+void runSelectionBenchmark(size_t num, size_t k) {
+    char label[128];
+    const std::vector<int32_t> input = makeInput<int32_t>(num, [](uint64_t v) { return static_cast<int32_t>(v); });
+    std::vector<int32_t> data = input;
+    Bench::Timer timer;
+    partialSort(data.data(), num, k);
+    ::snprintf(label, sizeof(label), "partialSort top %zu of %zu", k, num);
+    Bench::report(label, timer.elapsed(), num);
+
+    data = input;
+    timer.restart();
+    nthElement(data.data(), num, num / 2);
+    ::snprintf(label, sizeof(label), "nthElement median of %zu", num);
+    Bench::report(label, timer.elapsed(), num);
+
+    data = input;
+    timer.restart();
+    cppcore::sort(data.data(), num);
+    ::snprintf(label, sizeof(label), "sort all of %zu", num);
+    Bench::report(label, timer.elapsed(), num);
+}
+
+void runStableBenchmark(const char *name, const std::vector<Record> &input) {
+    char label[128];
+    const size_t num = input.size();
+    std::vector<Record> data = input;
+    std::vector<Record> buffer(num / 2 + 1);
+    Bench::Timer timer;
+    stableSort(data.data(), num, buffer.data());
+    ::snprintf(label, sizeof(label), "stableSort %s", name);
+    Bench::report(label, timer.elapsed(), num);
+
+    data = input;
+    timer.restart();
+    std::stable_sort(data.begin(), data.end());
+    ::snprintf(label, sizeof(label), "std::stable_sort %s", name);
+    Bench::report(label, timer.elapsed(), num);
+}
+
+void runSmallBenchmark(size_t num) {
+    // Many tiny arrays, like the candidates of a k-nearest search
+    const size_t NumArrays = 200000;
+    char label[128];
+    const std::vector<int32_t> input = makeInput<int32_t>(num * NumArrays, [](uint64_t v) { return static_cast<int32_t>(v); });
+    std::vector<int32_t> data = input;
+    Bench::Timer timer;
+    for (size_t i = 0; i < NumArrays; ++i) {
+        quicksort(data.data() + i * num, num, sizeof(int32_t), compDescending<int32_t>);
+    }
+    ::snprintf(label, sizeof(label), "quicksort %zu x int32", num);
+    Bench::report(label, timer.elapsed(), NumArrays);
+
+    data = input;
+    timer.restart();
+    TLess<int32_t> comp;
+    for (size_t i = 0; i < NumArrays; ++i) {
+        Details::insertionSort(data.data() + i * num, num, comp);
+    }
+    ::snprintf(label, sizeof(label), "insertionSort %zu x int32", num);
+    Bench::report(label, timer.elapsed(), NumArrays);
+
+    data = input;
+    timer.restart();
+    for (size_t i = 0; i < NumArrays; ++i) {
+        std::sort(data.begin() + i * num, data.begin() + (i + 1) * num);
+    }
+    ::snprintf(label, sizeof(label), "std::sort %zu x int32", num);
+    Bench::report(label, timer.elapsed(), NumArrays);
+
+    data = input;
+    timer.restart();
+    for (size_t i = 0; i < NumArrays; ++i) {
+        cppcore::sort(data.data() + i * num, num);
+    }
+    ::snprintf(label, sizeof(label), "sort (network) %zu x int32", num);
+    Bench::report(label, timer.elapsed(), NumArrays);
+    for (size_t i = 0; i < NumArrays; ++i) {
+        if (!std::is_sorted(data.begin() + i * num, data.begin() + (i + 1) * num)) {
+            ::printf("    sort result is wrong\n");
+            break;
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    const size_t Num = 1000000;
+    const std::vector<int32_t> ints = makeInput<int32_t>(Num, [](uint64_t v) { return static_cast<int32_t>(v); });
+    const std::vector<float> floats = makeInput<float>(Num, [](uint64_t v) { return static_cast<float>(v >> 40) * 0.25f; });
+    runBenchmark("int32", ints, compDescending<int32_t>);
+    runRadixBenchmark("int32", ints);
+    runBenchmark("float", floats, compDescending<float>);
+    runRadixBenchmark("float", floats);
+    runRadixBenchmark("uint64", makeInput<uint64_t>(Num, [](uint64_t v) { return v; }));
+    const std::vector<Record> records = makeInput<Record>(Num, [](uint64_t v) { return Record{ v, { v, v, v } }; });
+    runBenchmark("32-byte struct", records, compareRecord);
+
+    runStableBenchmark("32-byte struct random", records);
+    std::vector<Record> presorted = records;
+    std::sort(presorted.begin(), presorted.end());
+    for (size_t i = 0; i < Num; i += 1000) {
+        presorted[i].key = 0;
+    }
+    runStableBenchmark("32-byte struct nearly sorted", presorted);
+
+    runSelectionBenchmark(10000000, 100);
+
+    for (size_t num : { 4u, 8u, 16u, 24u, 32u }) {
+        runSmallBenchmark(num);
+    }
+
+    return 0;
+}
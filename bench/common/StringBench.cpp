@@ -0,0 +1,207 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/Logger.h>
+#include <cppcore/Common/Sort.h>
+#include <cppcore/Common/TRope.h>
+#include <cppcore/Common/TStringBase.h>
+#include <cppcore/Common/TStringBuilder.h>
+#include <cppcore/Common/TStringPool.h>
+#include <cppcore/Container/TArray.h>
+
+#include "../BenchCommon.h"
+
+#include <cstring>
+#include <iostream>
+
+using namespace cppcore;
+
+namespace {
+
+void runLoggerBenchmark(size_t num) {
+    // The standard stream is silenced, so only the message building is measured
+    std::cout.setstate(std::ios::badbit);
+    Logger *logger = Logger::getInstance();
+    const String domain("Renderer", 8);
+    const String msg("Texture loaded successfully", 27);
+    Bench::Timer timer;
+    for (size_t i = 0; i < num; ++i) {
+        logger->info(domain, msg);
+    }
+    const double seconds = timer.elapsed();
+    std::cout.clear();
+    Bench::report("Logger::info", seconds, num);
+}
+
+void runSortBenchmark(size_t num) {
+    TArray<String> strings;
+    strings.resize(num);
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    char buffer[32];
+    for (size_t i = 0; i < num; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const int len = ::snprintf(buffer, sizeof(buffer), "asset_%llu", static_cast<unsigned long long>(state % 100000000));
+        strings[i].set(buffer, static_cast<size_t>(len));
+    }
+    ::printf("sizeof(String) = %zu\n", sizeof(String));
+
+    Bench::Timer timer;
+    cppcore::sort(strings.data(), num, [](const String &lhs, const String &rhs) {
+        return ::strcmp(lhs.c_str(), rhs.c_str()) < 0;
+    });
+    Bench::report("sort TArray<String>", timer.elapsed(), num);
+}
+
+void runAppendBenchmark(size_t num) {
+    const String piece("texture_", 8);
+    size_t total = 0;
+    Bench::Timer timer;
+    for (size_t i = 0; i < num; ++i) {
+        String str;
+        for (size_t j = 0; j < 64; ++j) {
+            str += piece;
+            str += ';';
+        }
+        total += str.size();
+    }
+    Bench::report("String += 64 pieces", timer.elapsed(), num);
+
+    timer.restart();
+    for (size_t i = 0; i < num; ++i) {
+        TStringBuilder<char> builder;
+        for (size_t j = 0; j < 64; ++j) {
+            builder << piece << static_cast<uint32_t>(j) << ';';
+        }
+        const String str = builder.build();
+        total += str.size();
+    }
+    Bench::report("TStringBuilder 64 pieces + ints", timer.elapsed(), num);
+    Bench::doNotOptimize(total);
+}
+
+void runInternBenchmark(size_t num) {
+    // Asset paths share a long prefix, so comparing the chars is expensive
+    const size_t numPaths = 1024;
+    TArray<String> paths;
+    paths.resize(numPaths);
+    char buffer[96];
+    for (size_t i = 0; i < numPaths; ++i) {
+        const int len = ::snprintf(buffer, sizeof(buffer), "content/environment/textures/rocks/rock_%04zu.png", i);
+        paths[i].set(buffer, static_cast<size_t>(len));
+    }
+
+    size_t numEqual = 0;
+    Bench::Timer timer;
+    for (size_t i = 0; i < num; ++i) {
+        numEqual += paths[i % numPaths] == paths[(i * 7) % numPaths] ? 1 : 0;
+    }
+    Bench::report("String ==", timer.elapsed(), num);
+
+    TStringPool<char> pool;
+    TArray<TStringPool<char>::Id> ids;
+    ids.resize(numPaths);
+    timer.restart();
+    for (size_t i = 0; i < numPaths; ++i) {
+        ids[i] = pool.intern(paths[i]);
+    }
+    Bench::report("TStringPool::intern", timer.elapsed(), numPaths);
+
+    timer.restart();
+    for (size_t i = 0; i < num; ++i) {
+        numEqual += ids[i % numPaths] == ids[(i * 7) % numPaths] ? 1 : 0;
+    }
+    Bench::report("interned id ==", timer.elapsed(), num);
+    Bench::doNotOptimize(numEqual);
+}
+
+void runRopeBenchmark(size_t size, size_t numEdits) {
+    // Every insert into a String needs a copy of the whole text
+    String text;
+    text.reserve(size);
+    char line[64];
+    while (text.size() < size) {
+        const int len = ::snprintf(line, sizeof(line), "line %zu of the text buffer\n", text.size());
+        text.append(line, static_cast<size_t>(len));
+    }
+    const size_t numCopies = 20;
+    size_t total = 0;
+    Bench::Timer timer;
+    for (size_t i = 0; i < numCopies; ++i) {
+        const size_t pos = (i * 7919) % text.size();
+        String edited;
+        edited.reserve(text.size() + 8);
+        edited.append(text.c_str(), pos);
+        edited.append("inserted", 8);
+        edited.append(text.c_str() + pos, text.size() - pos);
+        total += edited.size();
+    }
+    Bench::report("String insert (copy)", timer.elapsed(), numCopies);
+
+    timer.restart();
+    TRope<char> rope(text.c_str(), text.size());
+    Bench::report("TRope build (per MB)", timer.elapsed(), size >> 20);
+
+    timer.restart();
+    for (size_t i = 0; i < numEdits; ++i) {
+        const size_t pos = (i * 7919) % rope.size();
+        rope.insert(pos, "inserted", 8);
+    }
+    Bench::report("TRope insert", timer.elapsed(), numEdits);
+
+    timer.restart();
+    for (size_t i = 0; i < numEdits; ++i) {
+        const size_t pos = (i * 7919) % rope.size();
+        rope.erase(pos, 8);
+    }
+    Bench::report("TRope erase", timer.elapsed(), numEdits);
+
+    timer.restart();
+    for (size_t i = 0; i < numEdits; ++i) {
+        const TRope<char> snapshot = rope;
+        total += snapshot.substring(i % size, 100).size();
+    }
+    Bench::report("TRope snapshot + substring", timer.elapsed(), numEdits);
+
+    timer.restart();
+    TRope<char>::ChunkIterator chunks = rope.chunks();
+    for (const TStringView<char> &chunk : chunks) {
+        total += static_cast<size_t>(chunk[0]);
+    }
+    Bench::report("TRope iterate chunks (per MB)", timer.elapsed(), size >> 20);
+    Bench::doNotOptimize(total);
+}
+
+} // namespace
+
+int main() {
+    runLoggerBenchmark(1000000);
+    runSortBenchmark(200000);
+    runAppendBenchmark(100000);
+    runInternBenchmark(10000000);
+    runRopeBenchmark(size_t(128) << 20, 100000);
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/CPUInfo.h>
+#include <cppcore/Common/TStringView.h>
+
+#include "../BenchCommon.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace cppcore;
+
+namespace {
+
+using StringView = TStringView<char>;
+
+// A log-like text: lines of 20..140 chars, words out of a small alphabet
+std::vector<char> createText(size_t size) {
+    std::vector<char> text(size);
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    size_t lineLen = 0, nextBreak = 80;
+    for (size_t i = 0; i < size; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        if (lineLen == nextBreak) {
+            text[i] = '\n';
+            lineLen = 0;
+            nextBreak = 20 + state % 120;
+            continue;
+        }
+        text[i] = (state & 7) == 0 ? ' ' : static_cast<char>('a' + (state >> 8) % 26);
+        ++lineLen;
+    }
+    return text;
+}
+
+void reportBandwidth(const char *name, double seconds, size_t bytes, size_t items) {
+    char label[128];
+    ::snprintf(label, sizeof(label), "%s (%.2f GB/s)", name, static_cast<double>(bytes) / seconds / 1e9);
+    Bench::report(label, seconds, items);
+}
+
+void runSplitBenchmark(const char *name, const std::vector<char> &text) {
+    const StringView view(text.data(), text.size());
+    size_t numLines = 0, numChars = 0;
+    Bench::Timer timer;
+    for (const StringView &line : view.split('\n')) {
+        ++numLines;
+        numChars += line.size();
+    }
+    reportBandwidth(name, timer.elapsed(), text.size(), numLines);
+    Bench::doNotOptimize(numChars);
+}
+
+void runMemchrBenchmark(const std::vector<char> &text) {
+    size_t numLines = 0;
+    const char *p = text.data();
+    const char *end = p + text.size();
+    Bench::Timer timer;
+    while (p < end) {
+        const char *found = static_cast<const char *>(::memchr(p, '\n', static_cast<size_t>(end - p)));
+        ++numLines;
+        p = found == nullptr ? end : found + 1;
+    }
+    reportBandwidth("memchr lines", timer.elapsed(), text.size(), numLines);
+}
+
+void runFindBenchmark(const std::vector<char> &text) {
+    // The needle is not in the text, so the whole buffer will be scanned
+    const char *needle = "zzqzzqzz";
+    const StringView view(text.data(), text.size());
+    Bench::Timer timer;
+    size_t pos = view.find(needle);
+    reportBandwidth("TStringView::find", timer.elapsed(), text.size(), 1);
+    Bench::doNotOptimize(pos);
+
+    const std::string str(text.data(), text.size());
+    timer.restart();
+    pos = str.find(needle);
+    reportBandwidth("std::string::find", timer.elapsed(), text.size(), 1);
+    Bench::doNotOptimize(pos);
+
+    timer.restart();
+    pos = view.findFirstOf("0123456789");
+    reportBandwidth("TStringView::findFirstOf 10 chars", timer.elapsed(), text.size(), 1);
+    Bench::doNotOptimize(pos);
+}
+
+} // namespace
+
+int main() {
+    const std::vector<char> text = createText(1024ull * 1024 * 1024);
+    runMemchrBenchmark(text);
+    runSplitBenchmark("split lines avx2", text);
+    CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::SSE42);
+    runSplitBenchmark("split lines sse4.2", text);
+    CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::Scalar);
+    runSplitBenchmark("split lines scalar", text);
+    CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::AVX2);
+    runFindBenchmark(text);
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/CPUInfo.h>
+#include <cppcore/Common/Unicode.h>
+
+#include "../BenchCommon.h"
+
+#include <vector>
+
+using namespace cppcore;
+
+namespace {
+
+constexpr size_t TextSize = 64ull * 1024 * 1024;
+
+void appendUtf8(uint32_t codePoint, std::vector<char> &text) {
+    if (codePoint < 0x80) {
+        text.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        text.push_back(static_cast<char>(0xc0 | (codePoint >> 6)));
+        text.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    } else {
+        text.push_back(static_cast<char>(0xe0 | (codePoint >> 12)));
+        text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+        text.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+    }
+}
+
+// One in nonAsciiRate code points is a two or three byte sequence
+std::vector<char> createText(uint32_t nonAsciiRate) {
+    std::vector<char> text;
+    text.reserve(TextSize + 4);
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    while (text.size() < TextSize) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        if (state % nonAsciiRate == 0) {
+            appendUtf8((state >> 20) % 2 == 0 ? 0xe4 : 0x4e00 + (state >> 24) % 0x5000, text);
+        } else {
+            text.push_back(static_cast<char>('a' + (state >> 8) % 26));
+        }
+    }
+    return text;
+}
+
+void reportBandwidth(const char *name, double seconds, size_t bytes) {
+    char label[128];
+    ::snprintf(label, sizeof(label), "%s (%.2f GB/s)", name, static_cast<double>(bytes) / seconds / 1e9);
+    Bench::report(label, seconds, bytes);
+}
+
+void runValidateBenchmark(const char *name, const std::vector<char> &text) {
+    const CPUInfo::SimdLevel levels[] = { CPUInfo::SimdLevel::AVX2, CPUInfo::SimdLevel::SSE42, CPUInfo::SimdLevel::Scalar };
+    const char *levelNames[] = { "avx2", "sse4.2", "scalar" };
+    for (size_t i = 0; i < 3; ++i) {
+        CPUInfo::setSimdLevelLimit(levels[i]);
+        char label[64];
+        ::snprintf(label, sizeof(label), "isValidUtf8 %s %s", name, levelNames[i]);
+        Bench::Timer timer;
+        const bool valid = isValidUtf8(TStringView<char>(text.data(), text.size()));
+        reportBandwidth(label, timer.elapsed(), text.size());
+        Bench::doNotOptimize(valid);
+    }
+    CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::AVX2);
+}
+
+void runConvertBenchmark(const char *name, const std::vector<char> &text) {
+    const TStringView<char> view(text.data(), text.size());
+    char label[64];
+    TStringBase<char16_t> utf16;
+    Bench::Timer timer;
+    utf8ToUtf16(view, utf16);
+    ::snprintf(label, sizeof(label), "utf8ToUtf16 %s", name);
+    reportBandwidth(label, timer.elapsed(), text.size());
+
+    TStringBase<char> utf8;
+    timer.restart();
+    utf16ToUtf8(TStringView<char16_t>(utf16.c_str(), utf16.size()), utf8);
+    ::snprintf(label, sizeof(label), "utf16ToUtf8 %s", name);
+    reportBandwidth(label, timer.elapsed(), text.size());
+
+    timer.restart();
+    const size_t numCodePoints = view.countCodePoints();
+    ::snprintf(label, sizeof(label), "countCodePoints %s", name);
+    reportBandwidth(label, timer.elapsed(), text.size());
+    Bench::doNotOptimize(numCodePoints);
+}
+
+} // namespace
+
+int main() {
+    const std::vector<char> ascii = createText(1000000000u);
+    const std::vector<char> mixed = createText(20);
+    const std::vector<char> cjk = createText(1);
+    runValidateBenchmark("ascii", ascii);
+    runValidateBenchmark("mixed", mixed);
+    runValidateBenchmark("cjk", cjk);
+    runConvertBenchmark("ascii", ascii);
+    runConvertBenchmark("mixed", mixed);
+    runConvertBenchmark("cjk", cjk);
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/TVariantArray.h>
+#include <cppcore/Common/Variant.h>
+#include <cppcore/Container/TArray.h>
+
+#include "../BenchCommon.h"
+
+#include <utility>
+
+using namespace cppcore;
+
+namespace {
+
+void runSetBenchmark(size_t num) {
+    Variant value;
+    float sum = 0.0f;
+    Bench::Timer timer;
+    for (size_t i = 0; i < num; ++i) {
+        value.setInt(static_cast<int32_t>(i));
+        sum += static_cast<float>(value.getInt());
+        value.setFloat3(1.0f, 2.0f, static_cast<float>(i));
+        sum += value.getFloat3()[2];
+    }
+    Bench::report("Variant setInt + setFloat3", timer.elapsed(), num);
+    Bench::doNotOptimize(sum);
+}
+
+void runCreateBenchmark(size_t num) {
+    // A scripting bridge creates a lot of short living arguments
+    const float matrix[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    size_t total = 0;
+    Bench::Timer timer;
+    for (size_t i = 0; i < num; ++i) {
+        Variant args[4];
+        args[0].setInt(static_cast<int32_t>(i));
+        args[1].setBool(true);
+        args[2].setFloat4x4(const_cast<float *>(matrix));
+        args[3].setString("player_name", 11);
+        Variant copy(args[2]);
+        Bench::doNotOptimize(args);
+        Bench::doNotOptimize(copy);
+        total += copy.getSize() + args[3].getSize();
+    }
+    Bench::report("Variant create 4 args + copy", timer.elapsed(), num);
+    Bench::doNotOptimize(total);
+}
+
+void runArrayBenchmark(size_t num) {
+    TArray<Variant> values;
+    values.reserve(num);
+    Bench::Timer timer;
+    for (size_t i = 0; i < num; ++i) {
+        Variant value;
+        value.setFloat(static_cast<float>(i));
+        values.add(value);
+    }
+    Bench::report("TArray<Variant>::add", timer.elapsed(), num);
+    Bench::doNotOptimize(values);
+}
+
+struct ScaleVisitor {
+    float scale;
+
+    template <class T>
+    float operator()(const T &) const {
+        return 0.0f;
+    }
+
+    float operator()(const Variant::Float3Value &value) const {
+        return (value[0] + value[1] + value[2]) * scale;
+    }
+};
+
+void runFloat3Benchmark(size_t num, size_t numRuns) {
+    TArray<Variant> args;
+    args.resize(num);
+    for (size_t i = 0; i < num; ++i) {
+        const float f = static_cast<float>(i & 1023);
+        args[i].setFloat3(f, f * 0.5f, 1.0f);
+    }
+
+    // Every value is scaled in place
+    Bench::Timer timer;
+    for (size_t run = 0; run < numRuns; ++run) {
+        for (size_t i = 0; i < num; ++i) {
+            switch (args[i].getType()) {
+                case Variant::Float3: {
+                    float *value = args[i].getFloat3();
+                    value[0] *= 1.5f;
+                    value[1] *= 1.5f;
+                    value[2] *= 1.5f;
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+    Bench::report("Float3 getType + getFloat3", timer.elapsed(), num * numRuns);
+
+    timer.restart();
+    for (size_t run = 0; run < numRuns; ++run) {
+        for (size_t i = 0; i < num; ++i) {
+            Variant::Float3Value *value = args[i].tryGet<Variant::Float3Value>();
+            if (value != nullptr) {
+                (*value)[0] *= 1.5f;
+                (*value)[1] *= 1.5f;
+                (*value)[2] *= 1.5f;
+            }
+        }
+    }
+    Bench::report("Float3 tryGet", timer.elapsed(), num * numRuns);
+
+    float sum = 0.0f;
+    timer.restart();
+    for (size_t run = 0; run < numRuns; ++run) {
+        for (size_t i = 0; i < num; ++i) {
+            sum += args[i].visit(ScaleVisitor{ 1.5f });
+        }
+    }
+    Bench::report("Float3 visit (sum)", timer.elapsed(), num * numRuns);
+
+    TVariantArray<Variant::Float3Value> column;
+    column.reserve(num);
+    timer.restart();
+    column.add(args.data(), num);
+    Bench::report("TVariantArray<Float3Value>::add batch", timer.elapsed(), num);
+
+    timer.restart();
+    for (size_t run = 0; run < numRuns; ++run) {
+        const TMutableSpan<float> components = column.components();
+        for (size_t i = 0; i < components.size(); ++i) {
+            components[i] *= 1.5f;
+        }
+    }
+    Bench::report("Float3 TVariantArray components", timer.elapsed(), num * numRuns);
+    Bench::doNotOptimize(sum);
+    Bench::doNotOptimize(column);
+}
+
+} // namespace
+
+int main() {
+    runSetBenchmark(10000000);
+    runCreateBenchmark(2000000);
+    runArrayBenchmark(2000000);
+    runFloat3Benchmark(1000000, 20);
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/CPUInfo.h>
+#include <cppcore/Container/TAlgorithm.h>
+#include <cppcore/Container/TArray.h>
+
+#include "../BenchCommon.h"
+
+using namespace cppcore;
+
+namespace {
+
+const char *levelName(CPUInfo::SimdLevel level) {
+    switch (level) {
+        case CPUInfo::SimdLevel::AVX2:
+            return "avx2";
+        case CPUInfo::SimdLevel::SSE42:
+            return "sse4.2";
+        default:
+            return "scalar";
+    }
+}
+
+template <class T>
+void runBenchmark(const char *typeName, size_t numItems, size_t numRounds) {
+    TArray<T> arr;
+    arr.resize(numItems);
+    for (size_t i = 0; i < numItems; ++i) {
+        arr[i] = static_cast<T>(i % 1000);
+    }
+    const T missing = static_cast<T>(5000);
+    const size_t total = numItems * numRounds;
+    char label[128];
+
+    const CPUInfo::SimdLevel levels[] = { CPUInfo::SimdLevel::Scalar, CPUInfo::SimdLevel::SSE42, CPUInfo::SimdLevel::AVX2 };
+    for (CPUInfo::SimdLevel level : levels) {
+        CPUInfo::setSimdLevelLimit(level);
+
+        Bench::Timer timer;
+        for (size_t round = 0; round < numRounds; ++round) {
+            Bench::doNotOptimize(find(arr, missing));
+        }
+        ::snprintf(label, sizeof(label), "find %s %s", typeName, levelName(level));
+        Bench::report(label, timer.elapsed(), total);
+
+        timer.restart();
+        for (size_t round = 0; round < numRounds; ++round) {
+            Bench::doNotOptimize(count(arr, static_cast<T>(7)));
+        }
+        ::snprintf(label, sizeof(label), "count %s %s", typeName, levelName(level));
+        Bench::report(label, timer.elapsed(), total);
+
+        timer.restart();
+        for (size_t round = 0; round < numRounds; ++round) {
+            T minValue, maxValue;
+            minMax(arr, minValue, maxValue);
+            Bench::doNotOptimize(minValue);
+            Bench::doNotOptimize(maxValue);
+        }
+        ::snprintf(label, sizeof(label), "minMax %s %s", typeName, levelName(level));
+        Bench::report(label, timer.elapsed(), total);
+
+        timer.restart();
+        for (size_t round = 0; round < numRounds; ++round) {
+            Bench::doNotOptimize(sum(arr));
+        }
+        ::snprintf(label, sizeof(label), "sum %s %s", typeName, levelName(level));
+        Bench::report(label, timer.elapsed(), total);
+
+        timer.restart();
+        for (size_t round = 0; round < numRounds; ++round) {
+            replace(arr, missing, static_cast<T>(1));
+        }
+        ::snprintf(label, sizeof(label), "replace %s %s", typeName, levelName(level));
+        Bench::report(label, timer.elapsed(), total);
+    }
+}
+
+} // namespace
+
+int main() {
+    // L2-resident and memory-bound sizes
+    runBenchmark<int32_t>("int32 64k", 64 * 1024, 2000);
+    runBenchmark<float>("float 64k", 64 * 1024, 2000);
+    runBenchmark<double>("double 64k", 64 * 1024, 2000);
+    runBenchmark<int32_t>("int32 16M", 16 * 1024 * 1024, 8);
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Container/TBloomFilter.h>
+
+#include "../BenchCommon.h"
+
+using namespace cppcore;
+
+namespace {
+
+template <class TFilter>
+void runBenchmark(const char *name, size_t numItems, double fpRate) {
+    TFilter filter(numItems, fpRate);
+    Bench::Timer timer;
+    for (uint64_t i = 0; i < numItems; ++i) {
+        filter.add(i);
+    }
+    char label[128];
+    ::snprintf(label, sizeof(label), "%s add, %zu items", name, numItems);
+    Bench::report(label, timer.elapsed(), numItems);
+
+    // Keys which were added
+    timer.restart();
+    size_t found = 0;
+    for (uint64_t i = 0; i < numItems; ++i) {
+        found += filter.mayContain(i) ? 1 : 0;
+    }
+    ::snprintf(label, sizeof(label), "%s query hit, %zu items", name, numItems);
+    Bench::report(label, timer.elapsed(), numItems);
+    Bench::doNotOptimize(found);
+
+    // Keys which were never added, counts the false positives
+    timer.restart();
+    size_t falsePositives = 0;
+    for (uint64_t i = numItems; i < numItems * 2; ++i) {
+        falsePositives += filter.mayContain(i) ? 1 : 0;
+    }
+    ::snprintf(label, sizeof(label), "%s query miss, %zu items", name, numItems);
+    Bench::report(label, timer.elapsed(), numItems);
+    ::printf("    requested fp rate %.4f, measured fp rate %.4f\n", fpRate,
+            static_cast<double>(falsePositives) / static_cast<double>(numItems));
+}
+
+} // namespace
+
+int main() {
+    static const size_t Sizes[] = { 100000, 1000000, 10000000 };
+    static const double Rates[] = { 0.01, 0.001 };
+    for (size_t size : Sizes) {
+        for (double rate : Rates) {
+            runBenchmark<TBloomFilter<uint64_t>>("TBloomFilter", size, rate);
+            runBenchmark<TCountingBloomFilter<uint64_t>>("TCountingBloomFilter", size, rate);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+
+// The vectorized Adler-32 loop, included once per instruction set by Checksum.cpp. The including
+// file provides the AdlerOps struct wrapping the intrinsics.
+
+// Each block of BlockSize bytes adds its byte sum to s1. Every byte adds its value times the
+// number of bytes up to the end of the chunk to s2, which is split into the weights inside of
+// the block and BlockSize times the sums of all earlier blocks.
+template <class Ops>
+uint32_t adler32Kernel(const uint8_t *p, size_t len, uint32_t adler) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t BlockSize = Ops::BlockSize;
+    constexpr size_t MaxChunk = AdlerMaxChunk / BlockSize * BlockSize;
+    uint64_t s1 = adler & 0xffff, s2 = adler >> 16;
+    while (len >= BlockSize) {
+        const size_t n = (len < MaxChunk ? len : MaxChunk) / BlockSize * BlockSize;
+        Vec sums = Ops::zero(), weighted = Ops::zero(), earlier = Ops::zero();
+        for (size_t i = 0; i < n; i += BlockSize) {
+            const Vec v = Ops::load(p + i);
+            earlier = Ops::add(earlier, sums);
+            sums = Ops::add(sums, Ops::sum(v));
+            weighted = Ops::add(weighted, Ops::weightedSum(v));
+        }
+        s2 += n * s1 + BlockSize * Ops::horizontalSum(earlier) + Ops::horizontalSum(weighted);
+        s1 += Ops::horizontalSum(sums);
+        s1 %= AdlerMod;
+        s2 %= AdlerMod;
+        p += n;
+        len -= n;
+    }
+    for (; len > 0; --len, ++p) {
+        s1 += *p;
+        s2 += s1;
+    }
+    s1 %= AdlerMod;
+    s2 %= AdlerMod;
+    return static_cast<uint32_t>((s2 << 16) | s1);
+}
@@ -0,0 +1,142 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <cppcore/Common/CPUInfo.h>
+
+#include <atomic>
+
+#ifdef CPPCORE_ARCH_X86
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+namespace cppcore {
+namespace {
+
+    uint32_t detectFeatures() {
+        uint32_t features = 0;
+#ifdef CPPCORE_ARCH_X86
+        auto setFeature = [&features](CPUInfo::Feature feature, bool on) {
+            if (on) {
+                features |= 1u << static_cast<uint32_t>(feature);
+            }
+        };
+
+        uint32_t regs[4] = {};
+#   ifdef _MSC_VER
+        __cpuidex(reinterpret_cast<int *>(regs), 0, 0);
+#   else
+        __cpuid_count(0, 0, regs[0], regs[1], regs[2], regs[3]);
+#   endif
+        const uint32_t maxLeaf = regs[0];
+
+#   ifdef _MSC_VER
+        __cpuidex(reinterpret_cast<int *>(regs), 1, 0);
+#   else
+        __cpuid_count(1, 0, regs[0], regs[1], regs[2], regs[3]);
+#   endif
+        const uint32_t ecx = regs[2];
+        const uint32_t edx = regs[3];
+        setFeature(CPUInfo::Feature::SSE2, (edx & (1u << 26)) != 0);
+        setFeature(CPUInfo::Feature::SSE41, (ecx & (1u << 19)) != 0);
+        setFeature(CPUInfo::Feature::SSE42, (ecx & (1u << 20)) != 0);
+        setFeature(CPUInfo::Feature::POPCNT, (ecx & (1u << 23)) != 0);
+        setFeature(CPUInfo::Feature::PCLMUL, (ecx & (1u << 1)) != 0);
+
+        // AVX needs the OS to save the ymm registers
+        bool osAvx = false;
+        if ((ecx & (1u << 27)) != 0 && (ecx & (1u << 28)) != 0) {
+#   ifdef _MSC_VER
+            const uint64_t xcr0 = _xgetbv(0);
+#   else
+            uint32_t eax = 0, edxXcr = 0;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edxXcr) : "c"(0));
+            const uint64_t xcr0 = (static_cast<uint64_t>(edxXcr) << 32) | eax;
+#   endif
+            osAvx = (xcr0 & 0x6) == 0x6;
+        }
+        setFeature(CPUInfo::Feature::AVX, osAvx);
+
+        if (maxLeaf >= 7) {
+#   ifdef _MSC_VER
+            __cpuidex(reinterpret_cast<int *>(regs), 7, 0);
+#   else
+            __cpuid_count(7, 0, regs[0], regs[1], regs[2], regs[3]);
+#   endif
+            setFeature(CPUInfo::Feature::AVX2, osAvx && (regs[1] & (1u << 5)) != 0);
+            setFeature(CPUInfo::Feature::BMI2, (regs[1] & (1u << 8)) != 0);
+        }
+
+#   ifdef _MSC_VER
+        __cpuidex(reinterpret_cast<int *>(regs), 0x80000000, 0);
+#   else
+        __cpuid_count(0x80000000, 0, regs[0], regs[1], regs[2], regs[3]);
+#   endif
+        if (regs[0] >= 0x80000007) {
+#   ifdef _MSC_VER
+            __cpuidex(reinterpret_cast<int *>(regs), 0x80000007, 0);
+#   else
+            __cpuid_count(0x80000007, 0, regs[0], regs[1], regs[2], regs[3]);
+#   endif
+            setFeature(CPUInfo::Feature::InvariantTSC, (regs[3] & (1u << 8)) != 0);
+        }
+#endif
+        return features;
+    }
+
+    uint32_t getFeatures() {
+        static const uint32_t features = detectFeatures();
+        return features;
+    }
+
+    CPUInfo::SimdLevel detectSimdLevel() {
+        if (CPUInfo::hasFeature(CPUInfo::Feature::AVX2) && CPUInfo::hasFeature(CPUInfo::Feature::POPCNT)) {
+            return CPUInfo::SimdLevel::AVX2;
+        }
+        if (CPUInfo::hasFeature(CPUInfo::Feature::SSE42) && CPUInfo::hasFeature(CPUInfo::Feature::POPCNT)) {
+            return CPUInfo::SimdLevel::SSE42;
+        }
+        return CPUInfo::SimdLevel::Scalar;
+    }
+
+    std::atomic<int> sSimdLevelLimit{static_cast<int>(CPUInfo::SimdLevel::AVX2)};
+
+} // namespace
+
+bool CPUInfo::hasFeature(Feature feature) {
+    return (getFeatures() & (1u << static_cast<uint32_t>(feature))) != 0;
+}
+
+CPUInfo::SimdLevel CPUInfo::getSimdLevel() {
+    static const SimdLevel detected = detectSimdLevel();
+    const int limit = sSimdLevelLimit.load(std::memory_order_relaxed);
+    return static_cast<int>(detected) < limit ? detected : static_cast<SimdLevel>(limit);
+}
+
+void CPUInfo::setSimdLevelLimit(SimdLevel level) {
+    sSimdLevelLimit.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+} // namespace cppcore
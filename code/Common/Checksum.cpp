@@ -0,0 +1,438 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <cppcore/Common/Checksum.h>
+#include <cppcore/Common/CPUInfo.h>
+
+#include <cstring>
+#include <utility>
+
+#ifdef CPPCORE_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+namespace cppcore {
+
+namespace {
+
+    // The reflected Castagnoli polynomial
+    constexpr uint32_t Crc32cPoly = 0x82f63b78u;
+
+    // The hardware version computes three streams of these sizes side by side and combines them.
+    constexpr size_t Crc32cLongBlock = 8192;
+    constexpr size_t Crc32cShortBlock = 256;
+
+    // The largest number of bytes before the Adler-32 sums must be reduced.
+    constexpr size_t AdlerMaxChunk = 5552;
+    constexpr uint32_t AdlerMod = 65521u;
+
+    inline uint64_t read64(const uint8_t *p) {
+        uint64_t value;
+        ::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint32_t read32(const uint8_t *p) {
+        uint32_t value;
+        ::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    uint32_t gf2MatrixTimes(const uint32_t *mat, uint32_t vec) {
+        uint32_t sum = 0;
+        for (; vec != 0; vec >>= 1, ++mat) {
+            if (vec & 1) {
+                sum ^= *mat;
+            }
+        }
+        return sum;
+    }
+
+    void gf2MatrixSquare(uint32_t *square, const uint32_t *mat) {
+        for (int n = 0; n < 32; ++n) {
+            square[n] = gf2MatrixTimes(mat, mat[n]);
+        }
+    }
+
+    // Builds the tables to shift a crc over len zero bytes, len must be a power of two.
+    void buildShiftTables(uint32_t shift[4][256], size_t len) {
+        uint32_t odd[32], even[32];
+        odd[0] = Crc32cPoly;
+        for (int n = 1; n < 32; ++n) {
+            odd[n] = 1u << (n - 1);
+        }
+        gf2MatrixSquare(even, odd);
+        gf2MatrixSquare(odd, even);
+
+        // odd is the operator for 4 zero bits now, square it up to len bytes
+        uint32_t *op = odd, *next = even;
+        for (size_t bits = 4; bits < len * 8; bits *= 2) {
+            gf2MatrixSquare(next, op);
+            std::swap(op, next);
+        }
+
+        for (uint32_t n = 0; n < 256; ++n) {
+            shift[0][n] = gf2MatrixTimes(op, n);
+            shift[1][n] = gf2MatrixTimes(op, n << 8);
+            shift[2][n] = gf2MatrixTimes(op, n << 16);
+            shift[3][n] = gf2MatrixTimes(op, n << 24);
+        }
+    }
+
+    struct Crc32cTables {
+        uint32_t slicing[8][256];
+        uint32_t longShift[4][256];
+        uint32_t shortShift[4][256];
+
+        Crc32cTables() {
+            for (uint32_t n = 0; n < 256; ++n) {
+                uint32_t crc = n;
+                for (int k = 0; k < 8; ++k) {
+                    crc = crc & 1 ? (crc >> 1) ^ Crc32cPoly : crc >> 1;
+                }
+                slicing[0][n] = crc;
+            }
+            for (uint32_t n = 0; n < 256; ++n) {
+                uint32_t crc = slicing[0][n];
+                for (int k = 1; k < 8; ++k) {
+                    crc = slicing[0][crc & 0xff] ^ (crc >> 8);
+                    slicing[k][n] = crc;
+                }
+            }
+            buildShiftTables(longShift, Crc32cLongBlock);
+            buildShiftTables(shortShift, Crc32cShortBlock);
+        }
+    };
+
+    const Crc32cTables &getCrc32cTables() {
+        static const Crc32cTables tables;
+        return tables;
+    }
+
+    inline uint32_t crc32cShift(const uint32_t shift[4][256], uint32_t crc) {
+        return shift[0][crc & 0xff] ^ shift[1][(crc >> 8) & 0xff] ^ shift[2][(crc >> 16) & 0xff] ^ shift[3][crc >> 24];
+    }
+
+    uint32_t crc32cScalar(const uint8_t *p, size_t len, uint32_t crc) {
+        const Crc32cTables &tables = getCrc32cTables();
+        const uint32_t (*t)[256] = tables.slicing;
+        for (; len >= 8; len -= 8, p += 8) {
+            crc ^= read32(p);
+            const uint32_t hi = read32(p + 4);
+            crc = t[7][crc & 0xff] ^ t[6][(crc >> 8) & 0xff] ^ t[5][(crc >> 16) & 0xff] ^ t[4][crc >> 24] ^
+                  t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^ t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+        }
+        for (; len > 0; --len, ++p) {
+            crc = t[0][(crc ^ *p) & 0xff] ^ (crc >> 8);
+        }
+        return crc;
+    }
+
+    uint32_t adler32Scalar(const uint8_t *p, size_t len, uint32_t adler) {
+        uint32_t s1 = adler & 0xffff, s2 = adler >> 16;
+        while (len > 0) {
+            const size_t n = len < AdlerMaxChunk ? len : AdlerMaxChunk;
+            for (size_t i = 0; i < n; ++i) {
+                s1 += p[i];
+                s2 += s1;
+            }
+            s1 %= AdlerMod;
+            s2 %= AdlerMod;
+            p += n;
+            len -= n;
+        }
+        return (s2 << 16) | s1;
+    }
+
+#ifdef CPPCORE_ARCH_X86
+
+// See TAlgorithm.cpp, the kernels are compiled for their instruction set by a target pragma.
+#if defined(__clang__)
+#   pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC push_options
+#   pragma GCC target("avx2")
+#endif
+
+namespace avx2 {
+
+    struct AdlerOps {
+        using Vec = __m256i;
+        static constexpr size_t BlockSize = 32;
+        static Vec load(const uint8_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        static Vec zero() { return _mm256_setzero_si256(); }
+        static Vec add(Vec a, Vec b) { return _mm256_add_epi32(a, b); }
+        static Vec sum(Vec v) { return _mm256_sad_epu8(v, _mm256_setzero_si256()); }
+        static Vec weightedSum(Vec v) {
+            const __m256i weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                    16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+            return _mm256_madd_epi16(_mm256_maddubs_epi16(v, weights), _mm256_set1_epi16(1));
+        }
+        static uint64_t horizontalSum(Vec v) {
+            uint32_t lanes[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), v);
+            uint64_t result = 0;
+            for (uint32_t lane : lanes) {
+                result += lane;
+            }
+            return result;
+        }
+    };
+
+#   include "AdlerKernel.inl"
+
+} // namespace avx2
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#   pragma clang attribute push(__attribute__((target("sse4.2"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#   pragma GCC push_options
+#   pragma GCC target("sse4.2")
+#endif
+
+namespace sse42 {
+
+    struct AdlerOps {
+        using Vec = __m128i;
+        static constexpr size_t BlockSize = 16;
+        static Vec load(const uint8_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        static Vec zero() { return _mm_setzero_si128(); }
+        static Vec add(Vec a, Vec b) { return _mm_add_epi32(a, b); }
+        static Vec sum(Vec v) { return _mm_sad_epu8(v, _mm_setzero_si128()); }
+        static Vec weightedSum(Vec v) {
+            const __m128i weights = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+            return _mm_madd_epi16(_mm_maddubs_epi16(v, weights), _mm_set1_epi16(1));
+        }
+        static uint64_t horizontalSum(Vec v) {
+            uint32_t lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), v);
+            return static_cast<uint64_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        }
+    };
+
+#   include "AdlerKernel.inl"
+
+    inline uint32_t crc32cWord(uint32_t crc, const uint8_t *p) {
+#if defined(__x86_64__) || defined(_M_X64)
+        return static_cast<uint32_t>(_mm_crc32_u64(crc, read64(p)));
+#else
+        return _mm_crc32_u32(_mm_crc32_u32(crc, read32(p)), read32(p + 4));
+#endif
+    }
+
+    // The crc32 instruction has a latency of three cycles but a throughput of one, so three
+    // independent streams are computed and combined by shifting over the zeros.
+    template <size_t BlockSize>
+    uint32_t crc32cStreams(const uint8_t *&p, size_t &len, uint32_t crc, const uint32_t shift[4][256]) {
+        while (len >= 3 * BlockSize) {
+            uint32_t crc1 = 0, crc2 = 0;
+            const uint8_t *end = p + BlockSize;
+            do {
+                crc = crc32cWord(crc, p);
+                crc1 = crc32cWord(crc1, p + BlockSize);
+                crc2 = crc32cWord(crc2, p + 2 * BlockSize);
+                p += 8;
+            } while (p < end);
+            crc = crc32cShift(shift, crc) ^ crc1;
+            crc = crc32cShift(shift, crc) ^ crc2;
+            p += 2 * BlockSize;
+            len -= 3 * BlockSize;
+        }
+        return crc;
+    }
+
+    uint32_t crc32cHardware(const uint8_t *p, size_t len, uint32_t crc) {
+        for (; len > 0 && (reinterpret_cast<uintptr_t>(p) & 7) != 0; --len, ++p) {
+            crc = _mm_crc32_u8(crc, *p);
+        }
+
+        const Crc32cTables &tables = getCrc32cTables();
+        crc = crc32cStreams<Crc32cLongBlock>(p, len, crc, tables.longShift);
+        crc = crc32cStreams<Crc32cShortBlock>(p, len, crc, tables.shortShift);
+        for (; len >= 8; len -= 8, p += 8) {
+            crc = crc32cWord(crc, p);
+        }
+        for (; len > 0; --len, ++p) {
+            crc = _mm_crc32_u8(crc, *p);
+        }
+        return crc;
+    }
+
+} // namespace sse42
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#endif
+
+#endif // CPPCORE_ARCH_X86
+
+    constexpr uint64_t XxhPrime1 = 11400714785074694791ull;
+    constexpr uint64_t XxhPrime2 = 14029467366897019727ull;
+    constexpr uint64_t XxhPrime3 = 1609587929392839161ull;
+    constexpr uint64_t XxhPrime4 = 9650029242287828579ull;
+    constexpr uint64_t XxhPrime5 = 2870177450012600261ull;
+
+    inline uint64_t rotl64(uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    inline uint64_t xxhRound(uint64_t acc, uint64_t input) {
+        acc += input * XxhPrime2;
+        return rotl64(acc, 31) * XxhPrime1;
+    }
+
+    inline uint64_t xxhMergeRound(uint64_t acc, uint64_t lane) {
+        acc ^= xxhRound(0, lane);
+        return acc * XxhPrime1 + XxhPrime4;
+    }
+
+    inline void xxhInitLanes(uint64_t *lanes, uint64_t seed) {
+        lanes[0] = seed + XxhPrime1 + XxhPrime2;
+        lanes[1] = seed + XxhPrime2;
+        lanes[2] = seed;
+        lanes[3] = seed - XxhPrime1;
+    }
+
+    inline void xxhStripe(uint64_t *lanes, const uint8_t *p) {
+        lanes[0] = xxhRound(lanes[0], read64(p));
+        lanes[1] = xxhRound(lanes[1], read64(p + 8));
+        lanes[2] = xxhRound(lanes[2], read64(p + 16));
+        lanes[3] = xxhRound(lanes[3], read64(p + 24));
+    }
+
+    uint64_t xxhFinish(const uint64_t *lanes, uint64_t seed, uint64_t totalLen, const uint8_t *p, size_t len) {
+        uint64_t h;
+        if (totalLen >= 32) {
+            h = rotl64(lanes[0], 1) + rotl64(lanes[1], 7) + rotl64(lanes[2], 12) + rotl64(lanes[3], 18);
+            for (int i = 0; i < 4; ++i) {
+                h = xxhMergeRound(h, lanes[i]);
+            }
+        } else {
+            h = seed + XxhPrime5;
+        }
+        h += totalLen;
+
+        for (; len >= 8; len -= 8, p += 8) {
+            h ^= xxhRound(0, read64(p));
+            h = rotl64(h, 27) * XxhPrime1 + XxhPrime4;
+        }
+        if (len >= 4) {
+            h ^= static_cast<uint64_t>(read32(p)) * XxhPrime1;
+            h = rotl64(h, 23) * XxhPrime2 + XxhPrime3;
+            p += 4;
+            len -= 4;
+        }
+        for (; len > 0; --len, ++p) {
+            h ^= *p * XxhPrime5;
+            h = rotl64(h, 11) * XxhPrime1;
+        }
+
+        h ^= h >> 33;
+        h *= XxhPrime2;
+        h ^= h >> 29;
+        h *= XxhPrime3;
+        h ^= h >> 32;
+        return h;
+    }
+
+} // namespace
+
+uint32_t crc32c(const void *buffer, size_t len, uint32_t crc) {
+    const uint8_t *p = static_cast<const uint8_t *>(buffer);
+    crc = ~crc;
+#ifdef CPPCORE_ARCH_X86
+    if (CPUInfo::getSimdLevel() != CPUInfo::SimdLevel::Scalar) {
+        return ~sse42::crc32cHardware(p, len, crc);
+    }
+#endif
+    return ~crc32cScalar(p, len, crc);
+}
+
+uint32_t adler32(const void *buffer, size_t len, uint32_t adler) {
+    const uint8_t *p = static_cast<const uint8_t *>(buffer);
+#ifdef CPPCORE_ARCH_X86
+    switch (CPUInfo::getSimdLevel()) {
+        case CPUInfo::SimdLevel::AVX2:
+            return avx2::adler32Kernel<avx2::AdlerOps>(p, len, adler);
+        case CPUInfo::SimdLevel::SSE42:
+            return sse42::adler32Kernel<sse42::AdlerOps>(p, len, adler);
+        default:
+            break;
+    }
+#endif
+    return adler32Scalar(p, len, adler);
+}
+
+uint64_t xxh64(const void *buffer, size_t len, uint64_t seed) {
+    const uint8_t *p = static_cast<const uint8_t *>(buffer);
+    uint64_t lanes[4];
+    xxhInitLanes(lanes, seed);
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        xxhStripe(lanes, p + i);
+    }
+    return xxhFinish(lanes, seed, len, p + i, len - i);
+}
+
+Xxh64Hasher::Xxh64Hasher(uint64_t seed) {
+    reset(seed);
+}
+
+void Xxh64Hasher::reset(uint64_t seed) {
+    mSeed = seed;
+    xxhInitLanes(mLanes, seed);
+    mTotalLen = 0;
+    mBufferLen = 0;
+}
+
+void Xxh64Hasher::update(const void *buffer, size_t len) {
+    const uint8_t *p = static_cast<const uint8_t *>(buffer);
+    mTotalLen += len;
+    if (mBufferLen + len < sizeof(mBuffer)) {
+        ::memcpy(mBuffer + mBufferLen, p, len);
+        mBufferLen += len;
+        return;
+    }
+
+    if (mBufferLen != 0) {
+        const size_t fill = sizeof(mBuffer) - mBufferLen;
+        ::memcpy(mBuffer + mBufferLen, p, fill);
+        xxhStripe(mLanes, mBuffer);
+        p += fill;
+        len -= fill;
+    }
+    for (; len >= 32; len -= 32, p += 32) {
+        xxhStripe(mLanes, p);
+    }
+    ::memcpy(mBuffer, p, len);
+    mBufferLen = len;
+}
+
+uint64_t Xxh64Hasher::finish() const {
+    return xxhFinish(mLanes, mSeed, mTotalLen, mBuffer, mBufferLen);
+}
+
+} // namespace cppcore
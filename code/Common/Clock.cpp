@@ -0,0 +1,114 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <cppcore/Common/Clock.h>
+#include <cppcore/Common/CPUInfo.h>
+
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <time.h>
+#endif
+
+#ifdef CPPCORE_ARCH_X86
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   else
+#       include <x86intrin.h>
+#   endif
+#endif
+
+namespace cppcore {
+namespace {
+
+    constexpr uint64_t NanosecondsPerSecond = 1000000000ull;
+
+    uint64_t readSystemClock() {
+#ifdef _WIN32
+        static const uint64_t frequency = [] {
+            LARGE_INTEGER value;
+            ::QueryPerformanceFrequency(&value);
+            return static_cast<uint64_t>(value.QuadPart);
+        }();
+        LARGE_INTEGER value;
+        ::QueryPerformanceCounter(&value);
+        const uint64_t counter = static_cast<uint64_t>(value.QuadPart);
+        return (counter / frequency) * NanosecondsPerSecond + (counter % frequency) * NanosecondsPerSecond / frequency;
+#else
+        timespec ts;
+        ::clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * NanosecondsPerSecond + static_cast<uint64_t>(ts.tv_nsec);
+#endif
+    }
+
+#ifdef CPPCORE_ARCH_X86
+    struct Sample {
+        uint64_t ticks;
+        uint64_t nanoseconds;
+    };
+
+    // Taken when the library is loaded, so the calibration will usually not have to wait
+    const Sample sLoadSample = { __rdtsc(), readSystemClock() };
+
+    double calibrate() {
+        constexpr uint64_t MinDuration = 10000000ull;
+        uint64_t ticks = __rdtsc();
+        uint64_t nanoseconds = readSystemClock();
+        while (nanoseconds - sLoadSample.nanoseconds < MinDuration) {
+            ticks = __rdtsc();
+            nanoseconds = readSystemClock();
+        }
+        return static_cast<double>(nanoseconds - sLoadSample.nanoseconds) / static_cast<double>(ticks - sLoadSample.ticks);
+    }
+#endif
+
+} // namespace
+
+uint64_t Clock::now() {
+    return readSystemClock();
+}
+
+uint64_t Clock::ticks() {
+#ifdef CPPCORE_ARCH_X86
+    if (usesTimeStampCounter()) {
+        return __rdtsc();
+    }
+#endif
+    return readSystemClock();
+}
+
+uint64_t Clock::toNanoseconds(uint64_t ticks) {
+#ifdef CPPCORE_ARCH_X86
+    if (usesTimeStampCounter()) {
+        static const double nanosecondsPerTick = calibrate();
+        return static_cast<uint64_t>(static_cast<double>(ticks) * nanosecondsPerTick);
+    }
+#endif
+    return ticks;
+}
+
+bool Clock::usesTimeStampCounter() {
+    static const bool useTsc = CPUInfo::hasFeature(CPUInfo::Feature::InvariantTSC);
+    return useTsc;
+}
+
+} // namespace cppcore
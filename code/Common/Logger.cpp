@@ -22,12 +22,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #include <cppcore/Common/Logger.h>
 #include <cppcore/Common/DateTime.h>
+#include <cppcore/Common/NumberConversion.h>
+#include <cppcore/Common/TStringView.h>
 
 #include <cassert>
-#include <iomanip>
 #include <iostream>
-#include <sstream>
-#include <string>
 
 namespace cppcore {
 namespace {
@@ -39,33 +38,34 @@ namespace {
         }
     }
     
-    ::std::string stripFilename(const ::std::string &filename) {
-        if (filename.empty()) {
-            return filename;
-        }
-    
-        ::std::string::size_type pos = filename.find_last_of("/");
-        if (pos == ::std::string::npos) {
-            return filename;
-        }
-        const ::std::string strippedName = filename.substr(pos + 1, filename.size() - pos - 1);
-    
-        return strippedName;
-    }
-    
     void addTraceInfo(const String &file, int line, String &msg) {
         if (Logger::getInstance()->getVerboseMode() == Logger::VerboseMode::Trace) {
-            msg += String(" (", 2);
-            std::string stripped = stripFilename(file.c_str());
-            msg += String(stripped.c_str(), stripped.size());
-            msg += String(", ", 2);
-            std::stringstream ss;
-            ss << line;
-            std::string lineno = ss.str();
-            msg += String(lineno.c_str(), lineno.size());
+            TStringView<char> filename(file.c_str(), file.size());
+            const size_t pos = filename.rfind('/');
+            if (pos != TStringView<char>::NotFound) {
+                filename = filename.subView(pos + 1);
+            }
+
+            char lineno[MaxIntChars];
+            const size_t len = formatInt(static_cast<int32_t>(line), lineno, sizeof(lineno));
+            msg.reserve(msg.size() + filename.size() + len + 5);
+            msg.append(" (", 2);
+            msg.append(filename.data(), filename.size());
+            msg.append(", ", 2);
+            msg.append(lineno, len);
             msg += ')';
         }
     }
+
+    // Appends the value with leading zeros up to the given width.
+    void appendPadded(uint32_t value, size_t width, String &str) {
+        char digits[MaxIntChars];
+        const size_t len = formatInt(value, digits, sizeof(digits));
+        for (size_t i = len; i < width; ++i) {
+            str += '0';
+        }
+        str.append(digits, len);
+    }
 }
 
 void AbstractLogStream::activate() {
@@ -169,6 +169,7 @@ void Logger::print(const String &msg, PrintMode mode) {
     }
 
     String logMsg;
+    logMsg.reserve(mIntention + msg.size() + 32);
     if (0 != mIntention) {
         for (uint32_t i = 0; i < mIntention; i++) {
             logMsg += ' ';
@@ -254,18 +255,21 @@ Logger::~Logger() {
 }
 
 String Logger::getDateTime() const {
-    static constexpr uint32_t Space = 2;
     DateTime currentDateTime;
-    std::stringstream stream;
-    stream.fill('0');
-    stream << std::setw(Space) << currentDateTime.year << "."
-           << std::setw(Space) << currentDateTime.month << "."
-           << std::setw(Space * 2) << currentDateTime.day << " "
-           << std::setw(Space) << currentDateTime.hour << ":"
-           << std::setw(Space) << currentDateTime.minute << ":"
-           << std::setw(Space) << currentDateTime.second;
-    const std::string tmp(stream.str());
-    String dateTime(tmp.c_str(), tmp.size());
+    String dateTime;
+    dateTime.reserve(19);
+    appendPadded(currentDateTime.year, 4, dateTime);
+    dateTime += '.';
+    appendPadded(currentDateTime.month, 2, dateTime);
+    dateTime += '.';
+    appendPadded(currentDateTime.day, 2, dateTime);
+    dateTime += ' ';
+    appendPadded(currentDateTime.hour, 2, dateTime);
+    dateTime += ':';
+    appendPadded(currentDateTime.minute, 2, dateTime);
+    dateTime += ':';
+    appendPadded(currentDateTime.second, 2, dateTime);
+
     return dateTime;
 }
 
@@ -0,0 +1,794 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <cppcore/Common/NumberConversion.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
+
+namespace cppcore {
+
+namespace {
+
+#include "NumberTables.inl"
+
+    struct UInt128 {
+        uint64_t lo;
+        uint64_t hi;
+    };
+
+    inline UInt128 mul128(uint64_t a, uint64_t b) {
+        UInt128 result;
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 NativeUInt128;
+        const NativeUInt128 r = static_cast<NativeUInt128>(a) * b;
+        result.lo = static_cast<uint64_t>(r);
+        result.hi = static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        result.lo = _umul128(a, b, &result.hi);
+#else
+        const uint64_t aLo = a & 0xffffffffull, aHi = a >> 32;
+        const uint64_t bLo = b & 0xffffffffull, bHi = b >> 32;
+        const uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+        const uint64_t mid = (ll >> 32) + (lh & 0xffffffffull) + (hl & 0xffffffffull);
+        result.lo = (ll & 0xffffffffull) | (mid << 32);
+        result.hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+        return result;
+    }
+
+    inline uint64_t mulHigh(uint64_t a, uint64_t b) {
+        return mul128(a, b).hi;
+    }
+
+    inline int clz64(uint64_t value) {
+#ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanReverse64(&index, value);
+        return 63 - static_cast<int>(index);
+#else
+        return __builtin_clzll(value);
+#endif
+    }
+
+    inline uint32_t digitOf(char c) {
+        return static_cast<uint32_t>(static_cast<unsigned char>(c) - '0');
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // Integer formatting
+
+    const char DigitPairs[] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+    uint32_t countDigits(uint64_t value) {
+        uint32_t numDigits = 1;
+        for (;;) {
+            if (value < 10) {
+                return numDigits;
+            }
+            if (value < 100) {
+                return numDigits + 1;
+            }
+            if (value < 1000) {
+                return numDigits + 2;
+            }
+            if (value < 10000) {
+                return numDigits + 3;
+            }
+            value /= 10000;
+            numDigits += 4;
+        }
+    }
+
+    // Writes exactly numDigits digits, two at once.
+    void writeDigits(uint64_t value, char *buffer, uint32_t numDigits) {
+        char *end = buffer + numDigits;
+        while (value >= 100) {
+            end -= 2;
+            ::memcpy(end, DigitPairs + (value % 100) * 2, 2);
+            value /= 100;
+        }
+        if (value >= 10) {
+            end -= 2;
+            ::memcpy(end, DigitPairs + value * 2, 2);
+        } else {
+            *--end = static_cast<char>('0' + value);
+        }
+    }
+
+    size_t formatUnsigned(uint64_t value, bool negative, char *buffer, size_t size) {
+        const uint32_t numDigits = countDigits(value);
+        const size_t len = numDigits + (negative ? 1 : 0);
+        if (buffer == nullptr || size < len + 1) {
+            return 0;
+        }
+        if (negative) {
+            *buffer = '-';
+        }
+        writeDigits(value, buffer + len - numDigits, numDigits);
+        buffer[len] = '\0';
+        return len;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // Integer parsing
+
+    size_t parseUnsigned(const char *p, size_t len, uint64_t max, uint64_t &value) {
+        // Leading zeros do not count for the overflow check
+        size_t i = 0;
+        while (i < len && p[i] == '0') {
+            ++i;
+        }
+        const size_t start = i;
+
+        // 19 digits will always fit into 64 bit
+        uint64_t result = 0;
+        const size_t safeEnd = len - start < 19 ? len : start + 19;
+        for (; i < safeEnd; ++i) {
+            const uint32_t digit = digitOf(p[i]);
+            if (digit > 9) {
+                break;
+            }
+            result = result * 10 + digit;
+        }
+        if (i == safeEnd && i < len && digitOf(p[i]) <= 9) {
+            const uint32_t digit = digitOf(p[i]);
+            if (result > (~0ull - digit) / 10) {
+                return 0;
+            }
+            result = result * 10 + digit;
+            ++i;
+            if (i < len && digitOf(p[i]) <= 9) {
+                return 0;
+            }
+        }
+        if (i == 0 || result > max) {
+            return 0;
+        }
+
+        value = result;
+        return i;
+    }
+
+    size_t parseSigned(const TStringView<char> &str, uint64_t maxPositive, int64_t &value) {
+        const char *p = str.data();
+        const size_t len = str.size();
+        if (len == 0) {
+            return 0;
+        }
+        const bool negative = p[0] == '-';
+        const size_t signLen = (negative || p[0] == '+') ? 1 : 0;
+        uint64_t abs = 0;
+        const size_t numDigits = parseUnsigned(p + signLen, len - signLen, negative ? maxPositive + 1 : maxPositive, abs);
+        if (numDigits == 0) {
+            return 0;
+        }
+
+        value = negative ? static_cast<int64_t>(0u - abs) : static_cast<int64_t>(abs);
+        return signLen + numDigits;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // Float parsing, see "Number Parsing at a Gigabyte per Second", Daniel Lemire, 2021
+
+    struct DoubleTraits {
+        using Float = double;
+        using Bits = uint64_t;
+        static constexpr int MantissaBits = 52;
+        static constexpr int MinExponent = -1023;
+        static constexpr int InfinitePower = 0x7ff;
+        static constexpr int SmallestPowerOf10 = -342;
+        static constexpr int LargestPowerOf10 = 308;
+        static constexpr int MinRoundToEven = -4;
+        static constexpr int MaxRoundToEven = 23;
+        static constexpr int MaxExactPowerOf10 = 22;
+        static constexpr uint64_t MaxExactMantissa = 1ull << 53;
+
+        static Float exactPowerOf10(int e) {
+            static const double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+            return powers[e];
+        }
+
+        static Float slowParse(const char *str) {
+            return ::strtod(str, nullptr);
+        }
+    };
+
+    struct FloatTraits {
+        using Float = float;
+        using Bits = uint32_t;
+        static constexpr int MantissaBits = 23;
+        static constexpr int MinExponent = -127;
+        static constexpr int InfinitePower = 0xff;
+        static constexpr int SmallestPowerOf10 = -64;
+        static constexpr int LargestPowerOf10 = 38;
+        static constexpr int MinRoundToEven = -17;
+        static constexpr int MaxRoundToEven = 10;
+        static constexpr int MaxExactPowerOf10 = 10;
+        static constexpr uint64_t MaxExactMantissa = 1ull << 24;
+
+        static Float exactPowerOf10(int e) {
+            static const float powers[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+            return powers[e];
+        }
+
+        static Float slowParse(const char *str) {
+            return ::strtof(str, nullptr);
+        }
+    };
+
+    // The significant digits beyond 19 will be dropped, truncated notes a dropped non-zero digit.
+    struct ParsedDecimal {
+        uint64_t mantissa;
+        int64_t exponent;
+        bool negative;
+        bool truncated;
+    };
+
+    // Enough digits to decide the rounding of any double, the rest only counts as non-zero or not.
+    constexpr size_t MaxSlowDigits = 780;
+
+    // Parses [sign] digits [. digits] [e [sign] digits], keeping up to maxDigits significant digits.
+    // Returns the number of parsed chars, 0 for no digits.
+    template <class TSink>
+    size_t parseDecimal(const char *p, size_t len, size_t maxDigits, ParsedDecimal &decimal, TSink sink) {
+        size_t i = 0;
+        decimal.negative = len > 0 && p[0] == '-';
+        if (len > 0 && (p[0] == '-' || p[0] == '+')) {
+            ++i;
+        }
+
+        size_t numDigits = 0, numSignificant = 0;
+        int64_t exponent = 0;
+        bool truncated = false;
+        for (; i < len && digitOf(p[i]) <= 9; ++i, ++numDigits) {
+            const uint32_t digit = digitOf(p[i]);
+            if (numSignificant < maxDigits) {
+                if (numSignificant != 0 || digit != 0) {
+                    sink(digit);
+                    ++numSignificant;
+                }
+            } else {
+                ++exponent;
+                truncated |= digit != 0;
+            }
+        }
+        if (i < len && p[i] == '.') {
+            ++i;
+            for (; i < len && digitOf(p[i]) <= 9; ++i, ++numDigits) {
+                const uint32_t digit = digitOf(p[i]);
+                if (numSignificant < maxDigits) {
+                    if (numSignificant != 0 || digit != 0) {
+                        sink(digit);
+                        ++numSignificant;
+                    }
+                    --exponent;
+                } else {
+                    truncated |= digit != 0;
+                }
+            }
+        }
+        if (numDigits == 0) {
+            return 0;
+        }
+
+        // The exponent is optional, a single 'e' is not a part of the number
+        if (i < len && (p[i] == 'e' || p[i] == 'E')) {
+            size_t j = i + 1;
+            const bool negativeExp = j < len && p[j] == '-';
+            if (j < len && (p[j] == '-' || p[j] == '+')) {
+                ++j;
+            }
+            if (j < len && digitOf(p[j]) <= 9) {
+                int64_t exp = 0;
+                for (; j < len && digitOf(p[j]) <= 9; ++j) {
+                    // Saturate, the result will be zero or infinite anyway
+                    if (exp < 100000) {
+                        exp = exp * 10 + digitOf(p[j]);
+                    }
+                }
+                exponent += negativeExp ? -exp : exp;
+                i = j;
+            }
+        }
+
+        decimal.exponent = exponent;
+        decimal.truncated = truncated;
+        return i;
+    }
+
+    bool matchWord(const char *p, size_t len, const char *word) {
+        const size_t wordLen = ::strlen(word);
+        if (len < wordLen) {
+            return false;
+        }
+        for (size_t i = 0; i < wordLen; ++i) {
+            if ((p[i] | 0x20) != word[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Computes the bits of w * 10^q, returns false if the result cannot be decided this way.
+    template <class Traits>
+    bool eiselLemire(int64_t q, uint64_t w, typename Traits::Bits &bits) {
+        using Bits = typename Traits::Bits;
+        constexpr int MantissaBits = Traits::MantissaBits;
+        if (w == 0 || q < Traits::SmallestPowerOf10) {
+            bits = 0;
+            return true;
+        }
+        if (q > Traits::LargestPowerOf10) {
+            bits = static_cast<Bits>(Traits::InfinitePower) << MantissaBits;
+            return true;
+        }
+
+        const int lz = clz64(w);
+        w <<= lz;
+        const uint64_t *power = PowerOfFive128[q - PowerOfFiveMinQ];
+        UInt128 product = mul128(w, power[0]);
+        constexpr uint64_t PrecisionMask = ~0ull >> (MantissaBits + 3);
+        if ((product.hi & PrecisionMask) == PrecisionMask) {
+            const UInt128 second = mul128(w, power[1]);
+            product.lo += second.hi;
+            if (second.hi > product.lo) {
+                ++product.hi;
+            }
+        }
+        if (product.lo == ~0ull && (q < -27 || q > 55)) {
+            return false;
+        }
+
+        const int upperBit = static_cast<int>(product.hi >> 63);
+        const int shift = upperBit + 64 - MantissaBits - 3;
+        uint64_t mantissa = product.hi >> shift;
+        // floor(log2(10^q)) + 63 = (217706 q >> 16) + 63
+        int64_t power2 = ((static_cast<int64_t>(217706) * q) >> 16) + 63 + upperBit - lz - Traits::MinExponent;
+        if (power2 <= 0) {
+            // Subnormal
+            if (-power2 + 1 >= 64) {
+                bits = 0;
+                return true;
+            }
+            mantissa >>= -power2 + 1;
+            mantissa += mantissa & 1;
+            mantissa >>= 1;
+            power2 = mantissa < (1ull << MantissaBits) ? 0 : 1;
+            bits = static_cast<Bits>((mantissa & ((1ull << MantissaBits) - 1)) | (static_cast<uint64_t>(power2) << MantissaBits));
+            return true;
+        }
+
+        // Exactly halfway between two floats, round to even
+        if (product.lo <= 1 && q >= Traits::MinRoundToEven && q <= Traits::MaxRoundToEven && (mantissa & 3) == 1) {
+            if ((mantissa << shift) == product.hi) {
+                mantissa &= ~1ull;
+            }
+        }
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        if (mantissa >= (2ull << MantissaBits)) {
+            mantissa = 1ull << MantissaBits;
+            ++power2;
+        }
+        mantissa &= ~(1ull << MantissaBits);
+        if (power2 >= Traits::InfinitePower) {
+            power2 = Traits::InfinitePower;
+            mantissa = 0;
+        }
+        bits = static_cast<Bits>(mantissa | (static_cast<uint64_t>(power2) << MantissaBits));
+        return true;
+    }
+
+    template <class Traits>
+    size_t parseFloatImpl(const TStringView<char> &str, typename Traits::Float &value) {
+        using Float = typename Traits::Float;
+        using Bits = typename Traits::Bits;
+        const char *p = str.data();
+        const size_t len = str.size();
+
+        ParsedDecimal decimal = {};
+        uint64_t w = 0;
+        const size_t numParsed = parseDecimal(p, len, 19, decimal, [&w](uint32_t digit) { w = w * 10 + digit; });
+        if (numParsed == 0) {
+            const size_t signLen = (len > 0 && (p[0] == '-' || p[0] == '+')) ? 1 : 0;
+            const bool negative = len > 0 && p[0] == '-';
+            if (matchWord(p + signLen, len - signLen, "nan")) {
+                value = negative ? -std::numeric_limits<Float>::quiet_NaN() : std::numeric_limits<Float>::quiet_NaN();
+                return signLen + 3;
+            }
+            if (matchWord(p + signLen, len - signLen, "inf")) {
+                value = negative ? -std::numeric_limits<Float>::infinity() : std::numeric_limits<Float>::infinity();
+                return signLen + (matchWord(p + signLen, len - signLen, "infinity") ? 8 : 3);
+            }
+            return 0;
+        }
+
+        const int64_t q = decimal.exponent;
+        Bits bits = 0;
+        bool found = false;
+        if (!decimal.truncated) {
+            // Both operands are exact, so the division or multiplication is correctly rounded
+            if (q >= -Traits::MaxExactPowerOf10 && q <= Traits::MaxExactPowerOf10 && w <= Traits::MaxExactMantissa) {
+                Float result = static_cast<Float>(w);
+                result = q < 0 ? result / Traits::exactPowerOf10(static_cast<int>(-q)) : result * Traits::exactPowerOf10(static_cast<int>(q));
+                value = decimal.negative ? -result : result;
+                return numParsed;
+            }
+            found = eiselLemire<Traits>(q, w, bits);
+        } else {
+            // The exact value is between w and w + 1, both must give the same result
+            Bits upper = 0;
+            found = eiselLemire<Traits>(q, w, bits) && eiselLemire<Traits>(q, w + 1, upper) && bits == upper;
+        }
+
+        Float result;
+        if (found) {
+            ::memcpy(&result, &bits, sizeof(result));
+        } else {
+            // Rare fallback: the digits as an integer with an exponent, which strtod parses in any
+            // locale. A dropped non-zero digit is kept as a trailing 1, so it still breaks ties.
+            char buffer[MaxSlowDigits + 32];
+            size_t pos = 0;
+            ParsedDecimal slow = {};
+            parseDecimal(p, len, MaxSlowDigits, slow, [&buffer, &pos](uint32_t digit) {
+                buffer[pos++] = static_cast<char>('0' + digit);
+            });
+            int64_t exponent = slow.exponent;
+            if (slow.truncated) {
+                buffer[pos++] = '1';
+                --exponent;
+            }
+            buffer[pos++] = 'e';
+            formatUnsigned(static_cast<uint64_t>(exponent < 0 ? -exponent : exponent), exponent < 0, buffer + pos, sizeof(buffer) - pos);
+            result = Traits::slowParse(buffer);
+        }
+
+        value = decimal.negative ? -result : result;
+        return numParsed;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // Float formatting, see "The Schubfach way to render doubles", Raffaello Giulietti, 2020
+
+    // floor(q log10(2))
+    inline int flog10Pow2(int q) {
+        return static_cast<int>((static_cast<int64_t>(q) * 661971961083ll) >> 41);
+    }
+
+    // floor(q log10(2) + log10(3/4))
+    inline int flog10ThreeQuartersPow2(int q) {
+        return static_cast<int>((static_cast<int64_t>(q) * 661971961083ll - 274743187321ll) >> 41);
+    }
+
+    // floor(e log2(10))
+    inline int flog2Pow10(int e) {
+        return static_cast<int>((static_cast<int64_t>(e) * 913124641741ll) >> 38);
+    }
+
+    // The value is f 10^e, f may have trailing zeros.
+    struct DecimalFloat {
+        uint64_t f;
+        int e;
+    };
+
+    constexpr uint64_t Mask63 = (1ull << 63) - 1;
+    constexpr uint64_t Mask32 = (1ull << 32) - 1;
+
+    // Rounds g cp / 2^127 to odd.
+    inline uint64_t roundToOdd(uint64_t g1, uint64_t g0, uint64_t cp) {
+        const uint64_t x1 = mulHigh(g0, cp);
+        const UInt128 y = mul128(g1, cp);
+        const uint64_t z = (y.lo >> 1) + x1;
+        const uint64_t vbp = y.hi + (z >> 63);
+        return vbp | (((z & Mask63) + Mask63) >> 63);
+    }
+
+    // Rounds g cp / 2^95 to odd.
+    inline uint64_t roundToOdd(uint64_t g, uint64_t cp) {
+        const uint64_t x1 = mulHigh(g, cp);
+        const uint64_t vbp = x1 >> 31;
+        return vbp | (((x1 & Mask32) + Mask32) >> 32);
+    }
+
+    // The shortest decimal in the rounding interval of c 2^q, with the closest one on ties.
+    template <bool IsDouble>
+    DecimalFloat toDecimal(int q, uint64_t c, int dk, uint64_t cMin, int qMin) {
+        const uint64_t out = c & 1;
+        const uint64_t cb = c << 2;
+        const uint64_t cbr = cb + 2;
+        uint64_t cbl;
+        int k;
+        if (c != cMin || q == qMin) {
+            cbl = cb - 2;
+            k = flog10Pow2(q);
+        } else {
+            // The interval is asymmetric at powers of two
+            cbl = cb - 1;
+            k = flog10ThreeQuartersPow2(q);
+        }
+
+        const uint64_t *g = SchubfachG[k - SchubfachMinK];
+        uint64_t vb, vbl, vbr;
+        if (IsDouble) {
+            const int h = q + flog2Pow10(-k) + 2;
+            vb = roundToOdd(g[0], g[1], cb << h);
+            vbl = roundToOdd(g[0], g[1], cbl << h);
+            vbr = roundToOdd(g[0], g[1], cbr << h);
+        } else {
+            const int h = q + flog2Pow10(-k) + 33;
+            vb = roundToOdd(g[0] + 1, cb << h);
+            vbl = roundToOdd(g[0] + 1, cbl << h);
+            vbr = roundToOdd(g[0] + 1, cbr << h);
+        }
+
+        const uint64_t s = vb >> 2;
+        if (s >= 100) {
+            // Try one digit less first
+            const uint64_t sp10 = s / 10 * 10;
+            const uint64_t tp10 = sp10 + 10;
+            const bool upin = vbl + out <= sp10 << 2;
+            const bool wpin = (tp10 << 2) + out <= vbr;
+            if (upin != wpin) {
+                return { upin ? sp10 : tp10, k };
+            }
+        }
+        const uint64_t t = s + 1;
+        const bool uin = vbl + out <= s << 2;
+        const bool win = (t << 2) + out <= vbr;
+        if (uin != win) {
+            return { uin ? s : t, k + dk };
+        }
+        const int64_t cmp = static_cast<int64_t>(vb - ((s + t) << 1));
+        return { (cmp < 0 || (cmp == 0 && (s & 1) == 0)) ? s : t, k + dk };
+    }
+
+    // The smallest subnormals are computed with one more digit, check whether one digit less is
+    // still enough to round-trip.
+    template <class Traits>
+    DecimalFloat shortenTiny(DecimalFloat decimal, typename Traits::Float absValue) {
+        const uint64_t rounded = (decimal.f + 5) / 10;
+        const int e = decimal.e + 1;
+        char text[32];
+        size_t len = formatUnsigned(rounded, false, text, sizeof(text));
+        text[len++] = 'e';
+        len += formatUnsigned(static_cast<uint64_t>(e < 0 ? -e : e), e < 0, text + len, sizeof(text) - len);
+        typename Traits::Float parsed = 0;
+        parseFloatImpl<Traits>(TStringView<char>(text, len), parsed);
+        if (parsed == absValue) {
+            return { rounded, e };
+        }
+        return decimal;
+    }
+
+    size_t writeSpecial(const char *text, char *buffer, size_t size) {
+        const size_t len = ::strlen(text);
+        if (buffer == nullptr || size < len + 1) {
+            return 0;
+        }
+        ::memcpy(buffer, text, len + 1);
+        return len;
+    }
+
+    size_t writeDecimal(bool negative, DecimalFloat decimal, char *buffer, size_t size) {
+        uint64_t f = decimal.f;
+        int e = decimal.e;
+        if (f == 0) {
+            return writeSpecial(negative ? "-0" : "0", buffer, size);
+        }
+        while (f % 10 == 0) {
+            f /= 10;
+            ++e;
+        }
+
+        char digits[20];
+        const uint32_t numDigits = countDigits(f);
+        writeDigits(f, digits, numDigits);
+        const int exp10 = e + static_cast<int>(numDigits) - 1;
+
+        char text[MaxFloatChars];
+        size_t pos = 0;
+        if (negative) {
+            text[pos++] = '-';
+        }
+        if (exp10 >= 0 && exp10 <= 16) {
+            const size_t intDigits = static_cast<size_t>(exp10) + 1;
+            if (numDigits <= intDigits) {
+                ::memcpy(text + pos, digits, numDigits);
+                pos += numDigits;
+                ::memset(text + pos, '0', intDigits - numDigits);
+                pos += intDigits - numDigits;
+            } else {
+                ::memcpy(text + pos, digits, intDigits);
+                pos += intDigits;
+                text[pos++] = '.';
+                ::memcpy(text + pos, digits + intDigits, numDigits - intDigits);
+                pos += numDigits - intDigits;
+            }
+        } else if (exp10 < 0 && exp10 >= -5) {
+            text[pos++] = '0';
+            text[pos++] = '.';
+            ::memset(text + pos, '0', static_cast<size_t>(-exp10 - 1));
+            pos += static_cast<size_t>(-exp10 - 1);
+            ::memcpy(text + pos, digits, numDigits);
+            pos += numDigits;
+        } else {
+            text[pos++] = digits[0];
+            if (numDigits > 1) {
+                text[pos++] = '.';
+                ::memcpy(text + pos, digits + 1, numDigits - 1);
+                pos += numDigits - 1;
+            }
+            text[pos++] = 'e';
+            text[pos++] = exp10 < 0 ? '-' : '+';
+            const uint32_t absExp = static_cast<uint32_t>(exp10 < 0 ? -exp10 : exp10);
+            const uint32_t numExpDigits = countDigits(absExp);
+            writeDigits(absExp, text + pos, numExpDigits);
+            pos += numExpDigits;
+        }
+
+        if (buffer == nullptr || size < pos + 1) {
+            return 0;
+        }
+        ::memcpy(buffer, text, pos);
+        buffer[pos] = '\0';
+        return pos;
+    }
+
+} // namespace
+
+size_t parseInt(const TStringView<char> &str, int64_t &value) {
+    return parseSigned(str, 0x7fffffffffffffffull, value);
+}
+
+size_t parseInt(const TStringView<char> &str, int32_t &value) {
+    int64_t result = 0;
+    const size_t numParsed = parseSigned(str, 0x7fffffffull, result);
+    if (numParsed != 0) {
+        value = static_cast<int32_t>(result);
+    }
+    return numParsed;
+}
+
+size_t parseInt(const TStringView<char> &str, uint64_t &value) {
+    const size_t signLen = (!str.isEmpty() && str[0] == '+') ? 1 : 0;
+    const size_t numDigits = parseUnsigned(str.data() + signLen, str.size() - signLen, ~0ull, value);
+    return numDigits == 0 ? 0 : signLen + numDigits;
+}
+
+size_t parseInt(const TStringView<char> &str, uint32_t &value) {
+    uint64_t result = 0;
+    const size_t numParsed = parseInt(str, result);
+    if (numParsed == 0 || result > 0xffffffffull) {
+        return 0;
+    }
+    value = static_cast<uint32_t>(result);
+    return numParsed;
+}
+
+size_t parseFloat(const TStringView<char> &str, double &value) {
+    return parseFloatImpl<DoubleTraits>(str, value);
+}
+
+size_t parseFloat(const TStringView<char> &str, float &value) {
+    return parseFloatImpl<FloatTraits>(str, value);
+}
+
+size_t formatInt(int64_t value, char *buffer, size_t size) {
+    const uint64_t abs = value < 0 ? 0u - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+    return formatUnsigned(abs, value < 0, buffer, size);
+}
+
+size_t formatInt(int32_t value, char *buffer, size_t size) {
+    return formatInt(static_cast<int64_t>(value), buffer, size);
+}
+
+size_t formatInt(uint64_t value, char *buffer, size_t size) {
+    return formatUnsigned(value, false, buffer, size);
+}
+
+size_t formatInt(uint32_t value, char *buffer, size_t size) {
+    return formatUnsigned(value, false, buffer, size);
+}
+
+size_t formatFloat(double value, char *buffer, size_t size) {
+    constexpr int Precision = 53;
+    constexpr int QMin = -1074;
+    constexpr uint64_t CMin = 1ull << 52;
+    constexpr uint64_t CTiny = 3;
+
+    uint64_t bits = 0;
+    ::memcpy(&bits, &value, sizeof(bits));
+    const bool negative = (bits >> 63) != 0;
+    const uint64_t t = bits & (CMin - 1);
+    const int bq = static_cast<int>((bits >> 52) & 0x7ff);
+    if (bq == 0x7ff) {
+        return writeSpecial(t != 0 ? "nan" : (negative ? "-inf" : "inf"), buffer, size);
+    }
+
+    DecimalFloat decimal = { 0, 0 };
+    if (bq != 0) {
+        const int mq = -QMin + 1 - bq;
+        const uint64_t c = CMin | t;
+        if (mq > 0 && mq < Precision && ((c >> mq) << mq) == c) {
+            // An integer, all digits are needed
+            decimal = { c >> mq, 0 };
+        } else {
+            decimal = toDecimal<true>(-mq, c, 0, CMin, QMin);
+        }
+    } else if (t != 0) {
+        decimal = t < CTiny ? shortenTiny<DoubleTraits>(toDecimal<true>(QMin, 10 * t, -1, CMin, QMin), negative ? -value : value)
+                : toDecimal<true>(QMin, t, 0, CMin, QMin);
+    }
+
+    return writeDecimal(negative, decimal, buffer, size);
+}
+
+size_t formatFloat(float value, char *buffer, size_t size) {
+    constexpr int Precision = 24;
+    constexpr int QMin = -149;
+    constexpr uint64_t CMin = 1ull << 23;
+    constexpr uint64_t CTiny = 8;
+
+    uint32_t bits = 0;
+    ::memcpy(&bits, &value, sizeof(bits));
+    const bool negative = (bits >> 31) != 0;
+    const uint64_t t = bits & (CMin - 1);
+    const int bq = static_cast<int>((bits >> 23) & 0xff);
+    if (bq == 0xff) {
+        return writeSpecial(t != 0 ? "nan" : (negative ? "-inf" : "inf"), buffer, size);
+    }
+
+    DecimalFloat decimal = { 0, 0 };
+    if (bq != 0) {
+        const int mq = -QMin + 1 - bq;
+        const uint64_t c = CMin | t;
+        if (mq > 0 && mq < Precision && ((c >> mq) << mq) == c) {
+            decimal = { c >> mq, 0 };
+        } else {
+            decimal = toDecimal<false>(-mq, c, 0, CMin, QMin);
+        }
+    } else if (t != 0) {
+        decimal = t < CTiny ? shortenTiny<FloatTraits>(toDecimal<false>(QMin, 10 * t, -1, CMin, QMin), negative ? -value : value)
+                : toDecimal<false>(QMin, t, 0, CMin, QMin);
+    }
+
+    return writeDecimal(negative, decimal, buffer, size);
+}
+
+} // namespace cppcore
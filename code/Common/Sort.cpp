@@ -0,0 +1,170 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <cppcore/Common/Sort.h>
+#include <cppcore/Common/CPUInfo.h>
+
+#include <cstring>
+#include <limits>
+
+#ifdef CPPCORE_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+namespace cppcore {
+
+#ifdef CPPCORE_ARCH_X86
+
+namespace {
+
+// See TAlgorithm.cpp, the kernels are compiled for their instruction set by a target pragma.
+#if defined(__clang__)
+#   pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC push_options
+#   pragma GCC target("avx2")
+#endif
+
+namespace avx2 {
+
+    struct OpsI32 {
+        using Vec = __m256i;
+        static constexpr size_t Lanes = 8;
+        static Vec load(const int32_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        static void store(int32_t *p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+        static Vec set1(int32_t v) { return _mm256_set1_epi32(v); }
+        static Vec zero() { return _mm256_setzero_si256(); }
+        static Vec laneIndex() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+        static Vec add(Vec a, Vec b) { return _mm256_add_epi32(a, b); }
+        static Vec andBits(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+        static Vec xorBits(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm256_cmpeq_epi32(a, b); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm256_blendv_epi8(a, b, m); }
+        static Vec min(Vec a, Vec b) { return _mm256_min_epi32(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm256_max_epi32(a, b); }
+        static Vec permute(Vec v, std::integral_constant<size_t, 1>) { return _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)); }
+        static Vec permute(Vec v, std::integral_constant<size_t, 2>) { return _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)); }
+        static Vec permute(Vec v, std::integral_constant<size_t, 4>) { return _mm256_permute2x128_si256(v, v, 1); }
+        static Vec floatToKey(Vec v) { return _mm256_xor_si256(v, _mm256_and_si256(_mm256_srai_epi32(v, 31), _mm256_set1_epi32(0x7fffffff))); }
+    };
+
+#   include "SortNetwork.inl"
+
+} // namespace avx2
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#   pragma clang attribute push(__attribute__((target("sse4.2"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#   pragma GCC push_options
+#   pragma GCC target("sse4.2")
+#endif
+
+namespace sse42 {
+
+    struct OpsI32 {
+        using Vec = __m128i;
+        static constexpr size_t Lanes = 4;
+        static Vec load(const int32_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        static void store(int32_t *p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+        static Vec set1(int32_t v) { return _mm_set1_epi32(v); }
+        static Vec zero() { return _mm_setzero_si128(); }
+        static Vec laneIndex() { return _mm_setr_epi32(0, 1, 2, 3); }
+        static Vec add(Vec a, Vec b) { return _mm_add_epi32(a, b); }
+        static Vec andBits(Vec a, Vec b) { return _mm_and_si128(a, b); }
+        static Vec xorBits(Vec a, Vec b) { return _mm_xor_si128(a, b); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm_cmpeq_epi32(a, b); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm_blendv_epi8(a, b, m); }
+        static Vec min(Vec a, Vec b) { return _mm_min_epi32(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm_max_epi32(a, b); }
+        static Vec permute(Vec v, std::integral_constant<size_t, 1>) { return _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)); }
+        static Vec permute(Vec v, std::integral_constant<size_t, 2>) { return _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)); }
+        static Vec floatToKey(Vec v) { return _mm_xor_si128(v, _mm_and_si128(_mm_srai_epi32(v, 31), _mm_set1_epi32(0x7fffffff))); }
+    };
+
+#   include "SortNetwork.inl"
+
+} // namespace sse42
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#endif
+
+} // namespace
+
+#endif // CPPCORE_ARCH_X86
+
+namespace {
+
+    template <bool FloatKeys>
+    bool sortNetworkSimd(int32_t *keys, size_t num) {
+#ifdef CPPCORE_ARCH_X86
+        switch (CPUInfo::getSimdLevel()) {
+            case CPUInfo::SimdLevel::AVX2:
+                avx2::sortNetworkKernel<avx2::OpsI32, FloatKeys>(keys, num);
+                return true;
+            case CPUInfo::SimdLevel::SSE42:
+                sse42::sortNetworkKernel<sse42::OpsI32, FloatKeys>(keys, num);
+                return true;
+            default:
+                break;
+        }
+#endif
+        return false;
+    }
+
+    template <class T, bool FloatKeys>
+    void sortNetworkImpl(T *data, size_t num) {
+        assert(num <= Details::SortNetworkMaxSize);
+        if (num < 2) {
+            return;
+        }
+
+        // The padding is the highest key, so it stays behind the data. For floats it is a NaN
+        // with the highest bit pattern, which is ordered behind all other values.
+        int32_t keys[Details::SortNetworkMaxSize];
+        std::memcpy(keys, data, num * sizeof(T));
+        for (size_t i = num; i < Details::SortNetworkMaxSize; ++i) {
+            keys[i] = std::numeric_limits<int32_t>::max();
+        }
+        if (!sortNetworkSimd<FloatKeys>(keys, num)) {
+            TLess<T> comp;
+            Details::insertionSort(data, num, comp);
+            return;
+        }
+        std::memcpy(data, keys, num * sizeof(T));
+    }
+
+} // namespace
+
+void sortNetwork(int32_t *data, size_t num) {
+    sortNetworkImpl<int32_t, false>(data, num);
+}
+
+void sortNetwork(float *data, size_t num) {
+    sortNetworkImpl<float, true>(data, num);
+}
+
+} // namespace cppcore
@@ -0,0 +1,123 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+
+// Bitonic sorting networks, included once per instruction set by Sort.cpp. The including file
+// provides the Ops struct wrapping the intrinsics. The network size is a template parameter, so
+// all loops are unrolled and the lane masks are constants. Do not call any inline functions or
+// templates from other headers in here, they would be compiled for the target instruction set.
+
+// Compare-exchange between whole vectors, the partner is J / Lanes vectors away.
+template <class Ops, size_t NumVecs, size_t K, size_t J>
+void exchange(typename Ops::Vec *v, std::true_type) {
+    constexpr size_t Lanes = Ops::Lanes;
+    for (size_t i = 0; i < NumVecs; ++i) {
+        const size_t partner = i ^ (J / Lanes);
+        if (partner > i) {
+            const typename Ops::Vec lo = Ops::min(v[i], v[partner]);
+            const typename Ops::Vec hi = Ops::max(v[i], v[partner]);
+            const bool descending = ((i * Lanes) & K) != 0;
+            v[i] = descending ? hi : lo;
+            v[partner] = descending ? lo : hi;
+        }
+    }
+}
+
+// Compare-exchange between the lanes of one vector, the partner is J lanes away.
+template <class Ops, size_t NumVecs, size_t K, size_t J>
+void exchange(typename Ops::Vec *v, std::false_type) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    const Vec zero = Ops::zero();
+    for (size_t i = 0; i < NumVecs; ++i) {
+        const Vec partner = Ops::permute(v[i], std::integral_constant<size_t, J>());
+        const Vec lo = Ops::min(v[i], partner);
+        const Vec hi = Ops::max(v[i], partner);
+
+        // The upper element of a pair takes the max, unless the block of K is sorted descending
+        const Vec index = Ops::add(Ops::laneIndex(), Ops::set1(static_cast<int32_t>(i * Lanes)));
+        const Vec isLower = Ops::cmpEq(Ops::andBits(index, Ops::set1(static_cast<int32_t>(J))), zero);
+        const Vec isAscending = Ops::cmpEq(Ops::andBits(index, Ops::set1(static_cast<int32_t>(K))), zero);
+        v[i] = Ops::blend(lo, hi, Ops::xorBits(isLower, isAscending));
+    }
+}
+
+template <class Ops, size_t NumVecs, size_t K, size_t J>
+struct BitonicMerge {
+    static void run(typename Ops::Vec *v) {
+        exchange<Ops, NumVecs, K, J>(v, std::integral_constant<bool, (J >= Ops::Lanes)>());
+        BitonicMerge<Ops, NumVecs, K, J / 2>::run(v);
+    }
+};
+
+template <class Ops, size_t NumVecs, size_t K>
+struct BitonicMerge<Ops, NumVecs, K, 0> {
+    static void run(typename Ops::Vec *) {}
+};
+
+template <class Ops, size_t NumVecs, size_t K>
+struct BitonicSort {
+    static void run(typename Ops::Vec *v) {
+        BitonicSort<Ops, NumVecs, K / 2>::run(v);
+        BitonicMerge<Ops, NumVecs, K, K / 2>::run(v);
+    }
+};
+
+template <class Ops, size_t NumVecs>
+struct BitonicSort<Ops, NumVecs, 1> {
+    static void run(typename Ops::Vec *) {}
+};
+
+template <class Ops, size_t NumVecs, bool FloatKeys>
+void sortVectors(int32_t *data) {
+    using Vec = typename Ops::Vec;
+    Vec v[NumVecs];
+    for (size_t i = 0; i < NumVecs; ++i) {
+        v[i] = Ops::load(data + i * Ops::Lanes);
+        if (FloatKeys) {
+            v[i] = Ops::floatToKey(v[i]);
+        }
+    }
+    BitonicSort<Ops, NumVecs, NumVecs * Ops::Lanes>::run(v);
+    for (size_t i = 0; i < NumVecs; ++i) {
+        if (FloatKeys) {
+            v[i] = Ops::floatToKey(v[i]);
+        }
+        Ops::store(data + i * Ops::Lanes, v[i]);
+    }
+}
+
+// Sorts the first num elements of a buffer of SortNetworkMaxSize elements, the rest must be
+// padded with the highest key.
+template <class Ops, bool FloatKeys>
+void sortNetworkKernel(int32_t *data, size_t num) {
+    constexpr size_t Lanes = Ops::Lanes;
+    if (num <= Lanes) {
+        sortVectors<Ops, 1, FloatKeys>(data);
+    } else if (num <= 2 * Lanes) {
+        sortVectors<Ops, 2, FloatKeys>(data);
+    } else if (num <= 4 * Lanes) {
+        sortVectors<Ops, 4, FloatKeys>(data);
+    } else {
+        sortVectors<Ops, Details::SortNetworkMaxSize / Lanes, FloatKeys>(data);
+    }
+}
@@ -0,0 +1,274 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <cppcore/Common/TStringView.h>
+#include <cppcore/Common/CPUInfo.h>
+
+#include <cstring>
+
+#ifdef CPPCORE_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+namespace cppcore {
+
+namespace {
+
+    inline uint32_t ctz32(uint32_t value) {
+#ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanForward(&index, value);
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+    }
+
+    inline uint32_t highestBit32(uint32_t value) {
+#ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanReverse(&index, value);
+        return static_cast<uint32_t>(index);
+#else
+        return 31u - static_cast<uint32_t>(__builtin_clz(value));
+#endif
+    }
+
+    size_t findByteScalar(const char *data, size_t len, char value) {
+        const void *found = ::memchr(data, value, len);
+        return found == nullptr ? len : static_cast<size_t>(static_cast<const char *>(found) - data);
+    }
+
+    size_t findAllBytesScalar(const char *data, size_t len, char value, uint32_t *positions, size_t maxPositions, size_t &numFound) {
+        numFound = 0;
+        size_t i = 0;
+        while (i < len) {
+            const size_t pos = i + findByteScalar(data + i, len - i, value);
+            if (pos == len) {
+                break;
+            }
+            if (numFound == maxPositions) {
+                return pos;
+            }
+            positions[numFound++] = static_cast<uint32_t>(pos);
+            i = pos + 1;
+        }
+        return len;
+    }
+
+    size_t findLastByteScalar(const char *data, size_t len, char value) {
+        for (size_t i = len; i > 0; --i) {
+            if (data[i - 1] == value) {
+                return i - 1;
+            }
+        }
+        return len;
+    }
+
+    size_t findBytesScalar(const char *data, size_t len, const char *needle, size_t needleLen) {
+        for (size_t i = 0; i + needleLen <= len; ++i) {
+            if (data[i] == needle[0] && ::memcmp(data + i, needle, needleLen) == 0) {
+                return i;
+            }
+        }
+        return len;
+    }
+
+    size_t findFirstOfTable(const char *data, size_t len, const char *chars, size_t numChars) {
+        bool table[256] = {};
+        for (size_t j = 0; j < numChars; ++j) {
+            table[static_cast<uint8_t>(chars[j])] = true;
+        }
+        for (size_t i = 0; i < len; ++i) {
+            if (table[static_cast<uint8_t>(data[i])]) {
+                return i;
+            }
+        }
+        return len;
+    }
+
+#ifdef CPPCORE_ARCH_X86
+
+    // Each distinct high nibble of the set gets one of 8 class bits. loTable holds the classes of
+    // all chars with this low nibble, hiTable the class of the high nibble. Fails for sets with more
+    // than 8 distinct high nibbles, ASCII sets will always fit.
+    bool buildNibbleTables(const char *chars, size_t numChars, uint8_t *loTable, uint8_t *hiTable) {
+        ::memset(loTable, 0, 16);
+        ::memset(hiTable, 0, 16);
+        uint32_t numClasses = 0;
+        for (size_t j = 0; j < numChars; ++j) {
+            const uint8_t c = static_cast<uint8_t>(chars[j]);
+            const uint8_t hiNibble = c >> 4;
+            if (hiTable[hiNibble] == 0) {
+                if (numClasses == 8) {
+                    return false;
+                }
+                hiTable[hiNibble] = static_cast<uint8_t>(1u << numClasses++);
+            }
+            loTable[c & 0x0f] |= hiTable[hiNibble];
+        }
+        return true;
+    }
+
+// See TAlgorithm.cpp, the kernels are compiled for their instruction set by a target pragma.
+#if defined(__clang__)
+#   pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC push_options
+#   pragma GCC target("avx2")
+#endif
+
+namespace avx2 {
+
+    struct ByteOps {
+        using Vec = __m256i;
+        static constexpr size_t Lanes = 32;
+        static Vec load(const char *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        static Vec set1(char c) { return _mm256_set1_epi8(c); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm256_cmpeq_epi8(a, b); }
+        static Vec orVec(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+        static Vec andVec(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+        static uint32_t moveMask(Vec v) { return static_cast<uint32_t>(_mm256_movemask_epi8(v)); }
+        static constexpr uint32_t FullMask = 0xffffffffu;
+        static Vec zero() { return _mm256_setzero_si256(); }
+        static Vec loadTable(const uint8_t *p) { return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))); }
+        static Vec shuffle(Vec table, Vec idx) { return _mm256_shuffle_epi8(table, idx); }
+        static Vec loNibbles(Vec v) { return _mm256_and_si256(v, _mm256_set1_epi8(0x0f)); }
+        static Vec hiNibbles(Vec v) { return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f)); }
+    };
+
+#   include "StringSearchKernel.inl"
+
+} // namespace avx2
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#   pragma clang attribute push(__attribute__((target("sse4.2"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#   pragma GCC push_options
+#   pragma GCC target("sse4.2")
+#endif
+
+namespace sse42 {
+
+    struct ByteOps {
+        using Vec = __m128i;
+        static constexpr size_t Lanes = 16;
+        static Vec load(const char *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        static Vec set1(char c) { return _mm_set1_epi8(c); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm_cmpeq_epi8(a, b); }
+        static Vec orVec(Vec a, Vec b) { return _mm_or_si128(a, b); }
+        static Vec andVec(Vec a, Vec b) { return _mm_and_si128(a, b); }
+        static uint32_t moveMask(Vec v) { return static_cast<uint32_t>(_mm_movemask_epi8(v)); }
+        static constexpr uint32_t FullMask = 0xffffu;
+        static Vec zero() { return _mm_setzero_si128(); }
+        static Vec loadTable(const uint8_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        static Vec shuffle(Vec table, Vec idx) { return _mm_shuffle_epi8(table, idx); }
+        static Vec loNibbles(Vec v) { return _mm_and_si128(v, _mm_set1_epi8(0x0f)); }
+        static Vec hiNibbles(Vec v) { return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f)); }
+    };
+
+#   include "StringSearchKernel.inl"
+
+} // namespace sse42
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#endif
+
+#endif // CPPCORE_ARCH_X86
+
+} // namespace
+
+#ifdef CPPCORE_ARCH_X86
+#   define CPPCORE_BYTE_DISPATCH(kernel, ...)                                       \
+        switch (CPUInfo::getSimdLevel()) {                                          \
+            case CPUInfo::SimdLevel::AVX2:                                          \
+                return avx2::kernel<avx2::ByteOps>(__VA_ARGS__);                    \
+            case CPUInfo::SimdLevel::SSE42:                                         \
+                return sse42::kernel<sse42::ByteOps>(__VA_ARGS__);                  \
+            default:                                                                \
+                break;                                                              \
+        }
+#else
+#   define CPPCORE_BYTE_DISPATCH(kernel, ...)
+#endif
+
+namespace Details {
+
+size_t findByte(const char *data, size_t len, char value) {
+    CPPCORE_BYTE_DISPATCH(findByteKernel, data, len, value)
+    return findByteScalar(data, len, value);
+}
+
+size_t findAllBytes(const char *data, size_t len, char value, uint32_t *positions, size_t maxPositions, size_t &numFound) {
+    assert(maxPositions >= MinBatchSize);
+    // The positions are 32 bit
+    const size_t maxLen = 0xffffffffu;
+    len = len < maxLen ? len : maxLen;
+    CPPCORE_BYTE_DISPATCH(findAllBytesKernel, data, len, value, positions, maxPositions, numFound)
+    return findAllBytesScalar(data, len, value, positions, maxPositions, numFound);
+}
+
+size_t findLastByte(const char *data, size_t len, char value) {
+    CPPCORE_BYTE_DISPATCH(findLastByteKernel, data, len, value)
+    return findLastByteScalar(data, len, value);
+}
+
+size_t findBytes(const char *data, size_t len, const char *needle, size_t needleLen) {
+    if (needleLen == 0) {
+        return 0;
+    }
+    if (needleLen > len) {
+        return len;
+    }
+    if (needleLen == 1) {
+        return findByte(data, len, needle[0]);
+    }
+    CPPCORE_BYTE_DISPATCH(findBytesKernel, data, len, needle, needleLen)
+    return findBytesScalar(data, len, needle, needleLen);
+}
+
+size_t findFirstOfBytes(const char *data, size_t len, const char *chars, size_t numChars) {
+    if (numChars == 0) {
+        return len;
+    }
+    if (numChars == 1) {
+        return findByte(data, len, chars[0]);
+    }
+#ifdef CPPCORE_ARCH_X86
+    uint8_t loTable[16], hiTable[16];
+    if (CPUInfo::getSimdLevel() != CPUInfo::SimdLevel::Scalar && buildNibbleTables(chars, numChars, loTable, hiTable)) {
+        CPPCORE_BYTE_DISPATCH(findFirstOfKernel, data, len, loTable, hiTable)
+    }
+#endif
+    return findFirstOfTable(data, len, chars, numChars);
+}
+
+} // namespace Details
+
+#undef CPPCORE_BYTE_DISPATCH
+
+} // namespace cppcore
@@ -0,0 +1,172 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+
+// Byte search loops, included once per instruction set by StringSearch.cpp. The Ops struct wraps
+// the intrinsics. All kernels return len, if nothing was found.
+
+template <class Ops>
+size_t findByteKernel(const char *data, size_t len, char value) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    const Vec needle = Ops::set1(value);
+    size_t i = 0;
+    for (; i + 4 * Lanes <= len; i += 4 * Lanes) {
+        const Vec m0 = Ops::cmpEq(Ops::load(data + i), needle);
+        const Vec m1 = Ops::cmpEq(Ops::load(data + i + Lanes), needle);
+        const Vec m2 = Ops::cmpEq(Ops::load(data + i + 2 * Lanes), needle);
+        const Vec m3 = Ops::cmpEq(Ops::load(data + i + 3 * Lanes), needle);
+        if (Ops::moveMask(Ops::orVec(Ops::orVec(m0, m1), Ops::orVec(m2, m3))) != 0) {
+            uint32_t mask = Ops::moveMask(m0);
+            if (mask != 0) {
+                return i + ctz32(mask);
+            }
+            mask = Ops::moveMask(m1);
+            if (mask != 0) {
+                return i + Lanes + ctz32(mask);
+            }
+            mask = Ops::moveMask(m2);
+            if (mask != 0) {
+                return i + 2 * Lanes + ctz32(mask);
+            }
+            return i + 3 * Lanes + ctz32(Ops::moveMask(m3));
+        }
+    }
+    for (; i + Lanes <= len; i += Lanes) {
+        const uint32_t mask = Ops::moveMask(Ops::cmpEq(Ops::load(data + i), needle));
+        if (mask != 0) {
+            return i + ctz32(mask);
+        }
+    }
+    for (; i < len; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return len;
+}
+
+// Stops early when less than Lanes positions are left, so maxPositions must be at least Lanes.
+template <class Ops>
+size_t findAllBytesKernel(const char *data, size_t len, char value, uint32_t *positions, size_t maxPositions, size_t &numFound) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    const Vec needle = Ops::set1(value);
+    numFound = 0;
+    size_t i = 0;
+    for (; i + Lanes <= len; i += Lanes) {
+        if (numFound + Lanes > maxPositions) {
+            return i;
+        }
+        uint32_t mask = Ops::moveMask(Ops::cmpEq(Ops::load(data + i), needle));
+        while (mask != 0) {
+            positions[numFound++] = static_cast<uint32_t>(i + ctz32(mask));
+            mask &= mask - 1;
+        }
+    }
+    for (; i < len; ++i) {
+        if (data[i] == value) {
+            if (numFound == maxPositions) {
+                return i;
+            }
+            positions[numFound++] = static_cast<uint32_t>(i);
+        }
+    }
+    return len;
+}
+
+template <class Ops>
+size_t findLastByteKernel(const char *data, size_t len, char value) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    const Vec needle = Ops::set1(value);
+    size_t i = len;
+    while (i >= Lanes) {
+        i -= Lanes;
+        const uint32_t mask = Ops::moveMask(Ops::cmpEq(Ops::load(data + i), needle));
+        if (mask != 0) {
+            return i + highestBit32(mask);
+        }
+    }
+    while (i > 0) {
+        --i;
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return len;
+}
+
+// Candidates must match the first and the last byte of the needle, only those will be compared.
+template <class Ops>
+size_t findBytesKernel(const char *data, size_t len, const char *needle, size_t needleLen) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    const Vec first = Ops::set1(needle[0]);
+    const Vec last = Ops::set1(needle[needleLen - 1]);
+    size_t i = 0;
+    for (; i + needleLen - 1 + Lanes <= len; i += Lanes) {
+        const Vec matchFirst = Ops::cmpEq(Ops::load(data + i), first);
+        const Vec matchLast = Ops::cmpEq(Ops::load(data + i + needleLen - 1), last);
+        uint32_t mask = Ops::moveMask(Ops::andVec(matchFirst, matchLast));
+        while (mask != 0) {
+            const size_t pos = i + ctz32(mask);
+            if (::memcmp(data + pos + 1, needle + 1, needleLen - 2) == 0) {
+                return pos;
+            }
+            mask &= mask - 1;
+        }
+    }
+    for (; i + needleLen <= len; ++i) {
+        if (data[i] == needle[0] && ::memcmp(data + i, needle, needleLen) == 0) {
+            return i;
+        }
+    }
+    return len;
+}
+
+// The chars are classified by two table lookups with the low and the high nibble of each byte, see
+// buildNibbleTables. A byte matches, if both lookups share a bit.
+template <class Ops>
+size_t findFirstOfKernel(const char *data, size_t len, const uint8_t *loTable, const uint8_t *hiTable) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    const Vec lo = Ops::loadTable(loTable);
+    const Vec hi = Ops::loadTable(hiTable);
+    const Vec zero = Ops::zero();
+    size_t i = 0;
+    for (; i + Lanes <= len; i += Lanes) {
+        const Vec block = Ops::load(data + i);
+        const Vec classes = Ops::andVec(Ops::shuffle(lo, Ops::loNibbles(block)), Ops::shuffle(hi, Ops::hiNibbles(block)));
+        const uint32_t mask = ~Ops::moveMask(Ops::cmpEq(classes, zero)) & Ops::FullMask;
+        if (mask != 0) {
+            return i + ctz32(mask);
+        }
+    }
+    for (; i < len; ++i) {
+        const uint8_t c = static_cast<uint8_t>(data[i]);
+        if ((loTable[c & 0x0f] & hiTable[c >> 4]) != 0) {
+            return i;
+        }
+    }
+    return len;
+}
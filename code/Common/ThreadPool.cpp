@@ -0,0 +1,241 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <cppcore/Common/ThreadPool.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cppcore {
+
+namespace {
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<ThreadPool::Task> tasks;
+    };
+
+    // Counts the open chunks of one parallelFor call, the caller blocks on it when nothing is left
+    // to steal
+    struct Latch {
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t count;
+
+        explicit Latch(size_t initial) :
+                count(initial) {
+            // empty
+        }
+
+        void countDown() {
+            // Notify under the lock, the waiter owns the latch and may destroy it right after
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--count == 0) {
+                condition.notify_all();
+            }
+        }
+
+        bool isDone() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return count == 0;
+        }
+
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this] { return count == 0; });
+        }
+    };
+
+    // Set for the worker threads, so tasks pushed from a worker go to its own queue
+    thread_local const void *sCurrentPool = nullptr;
+    thread_local size_t sCurrentWorker = 0;
+
+} // namespace
+
+struct ThreadPool::Impl {
+    std::vector<std::thread> threads;
+    std::vector<WorkQueue> queues;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    // The number of tasks waiting in the queues, not counting the running ones
+    std::atomic<size_t> numQueued{0};
+    std::atomic<size_t> nextQueue{0};
+    bool stop{false};
+
+    explicit Impl(size_t numThreads) :
+            queues(numThreads == 0 ? 1 : numThreads) {
+        // empty
+    }
+
+    void push(Task task) {
+        size_t queueIdx;
+        if (sCurrentPool == this) {
+            queueIdx = sCurrentWorker;
+        } else {
+            queueIdx = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        }
+
+        {
+            // Count under the queue lock, so the pop in tryRun can never run ahead of the count
+            std::lock_guard<std::mutex> lock(queues[queueIdx].mutex);
+            queues[queueIdx].tasks.push_back(std::move(task));
+            numQueued.fetch_add(1, std::memory_order_release);
+        }
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+        }
+        wakeCondition.notify_one();
+    }
+
+    bool tryRun(size_t firstQueue, bool isOwner) {
+        Task task;
+        const size_t numQueues = queues.size();
+        for (size_t i = 0; i < numQueues && !task; ++i) {
+            WorkQueue &queue = queues[(firstQueue + i) % numQueues];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (i == 0 && isOwner) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            numQueued.fetch_sub(1, std::memory_order_relaxed);
+        }
+        if (!task) {
+            return false;
+        }
+
+        task();
+        return true;
+    }
+
+    void workerLoop(size_t index) {
+        sCurrentPool = this;
+        sCurrentWorker = index;
+        for (;;) {
+            if (tryRun(index, true)) {
+                continue;
+            }
+
+            // Running tasks are not counted, a worker pushing from a task will run the rest itself
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait(lock, [this] {
+                return stop || numQueued.load(std::memory_order_acquire) != 0;
+            });
+            if (stop && numQueued.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+};
+
+ThreadPool::ThreadPool(size_t numThreads) :
+        mImpl(new Impl(numThreads)) {
+    for (size_t i = 0; i < numThreads; ++i) {
+        mImpl->threads.emplace_back(&Impl::workerLoop, mImpl, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mImpl->wakeMutex);
+        mImpl->stop = true;
+    }
+    mImpl->wakeCondition.notify_all();
+    for (std::thread &thread : mImpl->threads) {
+        thread.join();
+    }
+    delete mImpl;
+}
+
+size_t ThreadPool::getNumThreads() const {
+    return mImpl->threads.size();
+}
+
+void ThreadPool::submit(Task task) {
+    if (mImpl->threads.empty()) {
+        task();
+        return;
+    }
+    mImpl->push(std::move(task));
+}
+
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t grainSize, const RangeFunc &func) {
+    if (end <= begin) {
+        return;
+    }
+
+    const size_t numItems = end - begin;
+    if (grainSize == 0) {
+        // Some chunks per thread, so stealing can balance uneven chunks
+        const size_t numChunks = 4 * (getNumThreads() + 1);
+        grainSize = (numItems + numChunks - 1) / numChunks;
+    }
+    const size_t numChunks = (numItems + grainSize - 1) / grainSize;
+    if (numChunks == 1 || getNumThreads() == 0) {
+        func(begin, end);
+        return;
+    }
+
+    Latch remaining(numChunks - 1);
+    for (size_t chunk = 1; chunk < numChunks; ++chunk) {
+        const size_t first = begin + chunk * grainSize;
+        const size_t last = first + grainSize < end ? first + grainSize : end;
+        mImpl->push([&func, &remaining, first, last]() {
+            func(first, last);
+            remaining.countDown();
+        });
+    }
+
+    func(begin, begin + grainSize);
+
+    // Help out while there is something to steal, the chunks may wait in any queue. When all
+    // of them are taken they are running, so block until the last one is done.
+    while (!remaining.isDone()) {
+        if (!runPendingTask()) {
+            remaining.wait();
+            break;
+        }
+    }
+}
+
+bool ThreadPool::runPendingTask() {
+    if (sCurrentPool == mImpl) {
+        return mImpl->tryRun(sCurrentWorker, true);
+    }
+    return mImpl->tryRun(0, false);
+}
+
+ThreadPool &ThreadPool::getDefault() {
+    static ThreadPool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+    return pool;
+}
+
+} // namespace cppcore
@@ -0,0 +1,555 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <cppcore/Common/Unicode.h>
+#include <cppcore/Common/CPUInfo.h>
+
+#include <cstring>
+
+#ifdef CPPCORE_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+namespace cppcore {
+
+namespace {
+
+    // The size of the stack buffers for the conversions, in units of the target encoding
+    constexpr size_t ChunkSize = 1024;
+
+    // Error classes of two byte sequences. The three tables below flag, which classes are possible
+    // for the high and low nibble of the first byte and the high nibble of the second byte, an
+    // error is found when all three agree.
+    constexpr uint8_t TooShort = 1 << 0;        // 11______ 0_______ or 11______ 11______
+    constexpr uint8_t TooLong = 1 << 1;         // 0_______ 10______
+    constexpr uint8_t Overlong3 = 1 << 2;       // 11100000 100_____
+    constexpr uint8_t TooLarge = 1 << 3;        // 11110100 1001____ and above
+    constexpr uint8_t Surrogate = 1 << 4;       // 11101101 101_____
+    constexpr uint8_t Overlong2 = 1 << 5;       // 1100000_ 10______
+    constexpr uint8_t TooLarge1000 = 1 << 6;    // 11110101 1000____ and above
+    constexpr uint8_t Overlong4 = 1 << 6;       // 11110000 1000____
+    constexpr uint8_t TwoConts = 1 << 7;        // 10______ 10______
+    constexpr uint8_t Carry = TooShort | TooLong | TwoConts;
+
+    const uint8_t Utf8Byte1High[16] = {
+        TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+        TwoConts, TwoConts, TwoConts, TwoConts,
+        TooShort | Overlong2,
+        TooShort,
+        TooShort | Overlong3 | Surrogate,
+        TooShort | TooLarge | TooLarge1000 | Overlong4
+    };
+
+    const uint8_t Utf8Byte1Low[16] = {
+        Carry | Overlong3 | Overlong2 | Overlong4,
+        Carry | Overlong2,
+        Carry,
+        Carry,
+        Carry | TooLarge,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000 | Surrogate,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000
+    };
+
+    const uint8_t Utf8Byte2High[16] = {
+        TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+        TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+        TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+        TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+        TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+        TooShort, TooShort, TooShort, TooShort
+    };
+
+    // Bytes above these values in the last three bytes of a block start an incomplete sequence
+    const uint8_t Utf8IncompleteMax[32] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+    };
+
+    inline uint32_t ctz32(uint32_t value) {
+#ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanForward(&index, value);
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+    }
+
+    inline uint32_t ctz64(uint64_t value) {
+#ifdef _MSC_VER
+        unsigned long index = 0;
+        _BitScanForward64(&index, value);
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+    }
+
+    inline uint32_t popcnt32(uint32_t value) {
+#ifdef _MSC_VER
+        return static_cast<uint32_t>(__popcnt(value));
+#else
+        return static_cast<uint32_t>(__builtin_popcount(value));
+#endif
+    }
+
+    // Decodes one code point of valid UTF-8, returns the number of bytes.
+    inline size_t decodeUtf8(const char *src, uint32_t &codePoint) {
+        const uint32_t lead = static_cast<uint8_t>(src[0]);
+        if (lead < 0x80) {
+            codePoint = lead;
+            return 1;
+        }
+        if (lead < 0xe0) {
+            codePoint = ((lead & 0x1f) << 6) | (src[1] & 0x3f);
+            return 2;
+        }
+        if (lead < 0xf0) {
+            codePoint = ((lead & 0x0f) << 12) | ((src[1] & 0x3f) << 6) | (src[2] & 0x3f);
+            return 3;
+        }
+        codePoint = ((lead & 0x07) << 18) | ((src[1] & 0x3f) << 12) | ((src[2] & 0x3f) << 6) | (src[3] & 0x3f);
+        return 4;
+    }
+
+    inline size_t encodeUtf16(uint32_t codePoint, char16_t *dst) {
+        if (codePoint < 0x10000) {
+            dst[0] = static_cast<char16_t>(codePoint);
+            return 1;
+        }
+        codePoint -= 0x10000;
+        dst[0] = static_cast<char16_t>(0xd800 + (codePoint >> 10));
+        dst[1] = static_cast<char16_t>(0xdc00 + (codePoint & 0x3ff));
+        return 2;
+    }
+
+    inline size_t encodeUtf8(uint32_t codePoint, char *dst) {
+        if (codePoint < 0x80) {
+            dst[0] = static_cast<char>(codePoint);
+            return 1;
+        }
+        if (codePoint < 0x800) {
+            dst[0] = static_cast<char>(0xc0 | (codePoint >> 6));
+            dst[1] = static_cast<char>(0x80 | (codePoint & 0x3f));
+            return 2;
+        }
+        if (codePoint < 0x10000) {
+            dst[0] = static_cast<char>(0xe0 | (codePoint >> 12));
+            dst[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+            dst[2] = static_cast<char>(0x80 | (codePoint & 0x3f));
+            return 3;
+        }
+        dst[0] = static_cast<char>(0xf0 | (codePoint >> 18));
+        dst[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+        dst[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+        dst[3] = static_cast<char>(0x80 | (codePoint & 0x3f));
+        return 4;
+    }
+
+    bool validateUtf8Scalar(const char *data, size_t len) {
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data);
+        size_t i = 0;
+        while (i < len) {
+            if (i + 8 <= len) {
+                uint64_t word = 0;
+                ::memcpy(&word, bytes + i, sizeof(word));
+                if ((word & 0x8080808080808080ull) == 0) {
+                    i += 8;
+                    continue;
+                }
+            }
+
+            const uint8_t lead = bytes[i];
+            if (lead < 0x80) {
+                ++i;
+                continue;
+            }
+            size_t numBytes = 0;
+            uint32_t codePoint = 0, minCodePoint = 0;
+            if ((lead & 0xe0) == 0xc0) {
+                numBytes = 2;
+                codePoint = lead & 0x1f;
+                minCodePoint = 0x80;
+            } else if ((lead & 0xf0) == 0xe0) {
+                numBytes = 3;
+                codePoint = lead & 0x0f;
+                minCodePoint = 0x800;
+            } else if ((lead & 0xf8) == 0xf0) {
+                numBytes = 4;
+                codePoint = lead & 0x07;
+                minCodePoint = 0x10000;
+            } else {
+                return false;
+            }
+            if (numBytes > len - i) {
+                return false;
+            }
+            for (size_t j = 1; j < numBytes; ++j) {
+                if ((bytes[i + j] & 0xc0) != 0x80) {
+                    return false;
+                }
+                codePoint = (codePoint << 6) | (bytes[i + j] & 0x3f);
+            }
+            if (codePoint < minCodePoint || codePoint > 0x10ffff || (codePoint & 0xfffff800) == 0xd800) {
+                return false;
+            }
+            i += numBytes;
+        }
+        return true;
+    }
+
+    size_t countUtf8Scalar(const char *data, size_t len) {
+        size_t numCodePoints = 0;
+        for (size_t i = 0; i < len; ++i) {
+            numCodePoints += static_cast<int8_t>(data[i]) > -65 ? 1 : 0;
+        }
+        return numCodePoints;
+    }
+
+namespace scalar {
+
+    // ASCII blocks of 8 bytes, only used by the conversion kernels
+    struct Utf8Ops {
+        static constexpr size_t Lanes = 8;
+
+        static size_t asciiPrefix(const char *src) {
+            uint64_t word = 0;
+            ::memcpy(&word, src, sizeof(word));
+            const uint64_t highBits = word & 0x8080808080808080ull;
+            return highBits == 0 ? Lanes : ctz64(highBits) / 8;
+        }
+
+        static size_t widen16(const char *src, char16_t *dst) {
+            for (size_t j = 0; j < Lanes; ++j) {
+                dst[j] = static_cast<char16_t>(static_cast<uint8_t>(src[j]));
+            }
+            return asciiPrefix(src);
+        }
+
+        static size_t widen32(const char *src, char32_t *dst) {
+            for (size_t j = 0; j < Lanes; ++j) {
+                dst[j] = static_cast<char32_t>(static_cast<uint8_t>(src[j]));
+            }
+            return asciiPrefix(src);
+        }
+
+        static size_t narrow16(const char16_t *src, char *dst) {
+            size_t j = 0;
+            for (; j < Lanes && src[j] < 0x80; ++j) {
+                dst[j] = static_cast<char>(src[j]);
+            }
+            return j;
+        }
+    };
+
+#   include "UnicodeKernel.inl"
+
+} // namespace scalar
+
+#ifdef CPPCORE_ARCH_X86
+
+// See TAlgorithm.cpp, the kernels are compiled for their instruction set by a target pragma.
+#if defined(__clang__)
+#   pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC push_options
+#   pragma GCC target("avx2")
+#endif
+
+namespace avx2 {
+
+    struct Utf8Ops {
+        using Vec = __m256i;
+        static constexpr size_t Lanes = 32;
+        static Vec load(const char *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        static Vec zero() { return _mm256_setzero_si256(); }
+        static Vec set1(char c) { return _mm256_set1_epi8(c); }
+        static Vec orVec(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+        static Vec andVec(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+        static Vec xorVec(Vec a, Vec b) { return _mm256_xor_si256(a, b); }
+        static Vec subsU8(Vec a, Vec b) { return _mm256_subs_epu8(a, b); }
+        static Vec cmpGt(Vec a, Vec b) { return _mm256_cmpgt_epi8(a, b); }
+        static uint32_t moveMask(Vec v) { return static_cast<uint32_t>(_mm256_movemask_epi8(v)); }
+        static bool isZero(Vec v) { return _mm256_testz_si256(v, v) != 0; }
+        static Vec loadTable(const uint8_t *p) { return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))); }
+        static Vec shuffle(Vec table, Vec idx) { return _mm256_shuffle_epi8(table, idx); }
+        static Vec loNibbles(Vec v) { return _mm256_and_si256(v, _mm256_set1_epi8(0x0f)); }
+        static Vec hiNibbles(Vec v) { return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f)); }
+
+        // The input shifted by N bytes, the gap is filled with the end of the previous block
+        static Vec prev1(Vec input, Vec prev) { return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 15); }
+        static Vec prev2(Vec input, Vec prev) { return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 14); }
+        static Vec prev3(Vec input, Vec prev) { return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 13); }
+
+        static size_t asciiPrefix(Vec v) {
+            const uint32_t mask = moveMask(v);
+            return mask == 0 ? Lanes : ctz32(mask);
+        }
+
+        static size_t widen16(const char *src, char16_t *dst) {
+            const Vec v = load(src);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+            return asciiPrefix(v);
+        }
+
+        static size_t widen32(const char *src, char32_t *dst) {
+            const Vec v = load(src);
+            const __m128i lo = _mm256_castsi256_si128(v);
+            const __m128i hi = _mm256_extracti128_si256(v, 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_cvtepu8_epi32(lo));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 16), _mm256_cvtepu8_epi32(hi));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+            return asciiPrefix(v);
+        }
+
+        static size_t narrow16(const char16_t *src, char *dst) {
+            const Vec a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+            const Vec b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 16));
+            // packus saturates signed, the min maps all non-ASCII units to bytes with the high
+            // bit set. packus works per 128-bit lane, the permute restores the order.
+            const Vec maxByte = _mm256_set1_epi16(0xff);
+            const Vec packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_min_epu16(a, maxByte), _mm256_min_epu16(b, maxByte)), 0xd8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), packed);
+            return asciiPrefix(packed);
+        }
+    };
+
+#   include "UnicodeKernel.inl"
+
+} // namespace avx2
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#   pragma clang attribute push(__attribute__((target("sse4.2"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#   pragma GCC push_options
+#   pragma GCC target("sse4.2")
+#endif
+
+namespace sse42 {
+
+    struct Utf8Ops {
+        using Vec = __m128i;
+        static constexpr size_t Lanes = 16;
+        static Vec load(const char *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        static Vec zero() { return _mm_setzero_si128(); }
+        static Vec set1(char c) { return _mm_set1_epi8(c); }
+        static Vec orVec(Vec a, Vec b) { return _mm_or_si128(a, b); }
+        static Vec andVec(Vec a, Vec b) { return _mm_and_si128(a, b); }
+        static Vec xorVec(Vec a, Vec b) { return _mm_xor_si128(a, b); }
+        static Vec subsU8(Vec a, Vec b) { return _mm_subs_epu8(a, b); }
+        static Vec cmpGt(Vec a, Vec b) { return _mm_cmpgt_epi8(a, b); }
+        static uint32_t moveMask(Vec v) { return static_cast<uint32_t>(_mm_movemask_epi8(v)); }
+        static bool isZero(Vec v) { return _mm_testz_si128(v, v) != 0; }
+        static Vec loadTable(const uint8_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        static Vec shuffle(Vec table, Vec idx) { return _mm_shuffle_epi8(table, idx); }
+        static Vec loNibbles(Vec v) { return _mm_and_si128(v, _mm_set1_epi8(0x0f)); }
+        static Vec hiNibbles(Vec v) { return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f)); }
+        static Vec prev1(Vec input, Vec prev) { return _mm_alignr_epi8(input, prev, 15); }
+        static Vec prev2(Vec input, Vec prev) { return _mm_alignr_epi8(input, prev, 14); }
+        static Vec prev3(Vec input, Vec prev) { return _mm_alignr_epi8(input, prev, 13); }
+
+        static size_t asciiPrefix(Vec v) {
+            const uint32_t mask = moveMask(v);
+            return mask == 0 ? Lanes : ctz32(mask);
+        }
+
+        static size_t widen16(const char *src, char16_t *dst) {
+            const Vec v = load(src);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_unpacklo_epi8(v, zero()));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 8), _mm_unpackhi_epi8(v, zero()));
+            return asciiPrefix(v);
+        }
+
+        static size_t widen32(const char *src, char32_t *dst) {
+            const Vec v = load(src);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_cvtepu8_epi32(v));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 4), _mm_cvtepu8_epi32(_mm_srli_si128(v, 4)));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 8), _mm_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 12), _mm_cvtepu8_epi32(_mm_srli_si128(v, 12)));
+            return asciiPrefix(v);
+        }
+
+        static size_t narrow16(const char16_t *src, char *dst) {
+            const Vec a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            const Vec b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 8));
+            // packus saturates signed, the min maps all non-ASCII units to bytes with the high bit set
+            const Vec maxByte = _mm_set1_epi16(0xff);
+            const Vec packed = _mm_packus_epi16(_mm_min_epu16(a, maxByte), _mm_min_epu16(b, maxByte));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), packed);
+            return asciiPrefix(packed);
+        }
+    };
+
+#   include "UnicodeKernel.inl"
+
+} // namespace sse42
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#endif
+
+#endif // CPPCORE_ARCH_X86
+
+} // namespace
+
+#ifdef CPPCORE_ARCH_X86
+#   define CPPCORE_UTF8_DISPATCH(kernel, ...)                                       \
+        switch (CPUInfo::getSimdLevel()) {                                          \
+            case CPUInfo::SimdLevel::AVX2:                                          \
+                return avx2::kernel<avx2::Utf8Ops>(__VA_ARGS__);                    \
+            case CPUInfo::SimdLevel::SSE42:                                         \
+                return sse42::kernel<sse42::Utf8Ops>(__VA_ARGS__);                  \
+            default:                                                                \
+                break;                                                              \
+        }
+#else
+#   define CPPCORE_UTF8_DISPATCH(kernel, ...)
+#endif
+
+namespace {
+
+    size_t utf8ToUtf16Chunk(const char *src, size_t len, char16_t *dst, size_t capacity, size_t &numRead) {
+        CPPCORE_UTF8_DISPATCH(utf8ToUtf16Kernel, src, len, dst, capacity, numRead)
+        return scalar::utf8ToUtf16Kernel<scalar::Utf8Ops>(src, len, dst, capacity, numRead);
+    }
+
+    size_t utf8ToUtf32Chunk(const char *src, size_t len, char32_t *dst, size_t capacity, size_t &numRead) {
+        CPPCORE_UTF8_DISPATCH(utf8ToUtf32Kernel, src, len, dst, capacity, numRead)
+        return scalar::utf8ToUtf32Kernel<scalar::Utf8Ops>(src, len, dst, capacity, numRead);
+    }
+
+    size_t utf16ToUtf8Chunk(const char16_t *src, size_t len, char *dst, size_t capacity, size_t &numRead, bool &valid) {
+        CPPCORE_UTF8_DISPATCH(utf16ToUtf8Kernel, src, len, dst, capacity, numRead, valid)
+        return scalar::utf16ToUtf8Kernel<scalar::Utf8Ops>(src, len, dst, capacity, numRead, valid);
+    }
+
+} // namespace
+
+namespace Details {
+
+size_t countUtf8CodePoints(const char *data, size_t len) {
+    CPPCORE_UTF8_DISPATCH(countUtf8Kernel, data, len)
+    return countUtf8Scalar(data, len);
+}
+
+} // namespace Details
+
+bool isValidUtf8(const TStringView<char> &str) {
+    CPPCORE_UTF8_DISPATCH(validateUtf8Kernel, str.data(), str.size())
+    return validateUtf8Scalar(str.data(), str.size());
+}
+
+bool utf8ToUtf16(const TStringView<char> &str, TStringBase<char16_t> &result) {
+    result.reset();
+    if (!isValidUtf8(str)) {
+        return false;
+    }
+
+    // A code point never needs more UTF-16 units than UTF-8 bytes
+    result.reserve(str.size());
+    char16_t chunk[ChunkSize];
+    size_t i = 0;
+    while (i < str.size()) {
+        size_t numRead = 0;
+        const size_t numWritten = utf8ToUtf16Chunk(str.data(i), str.size() - i, chunk, ChunkSize, numRead);
+        result.append(chunk, numWritten);
+        i += numRead;
+    }
+    return true;
+}
+
+bool utf8ToUtf32(const TStringView<char> &str, TStringBase<char32_t> &result) {
+    result.reset();
+    if (!isValidUtf8(str)) {
+        return false;
+    }
+
+    result.reserve(str.size());
+    char32_t chunk[ChunkSize];
+    size_t i = 0;
+    while (i < str.size()) {
+        size_t numRead = 0;
+        const size_t numWritten = utf8ToUtf32Chunk(str.data(i), str.size() - i, chunk, ChunkSize, numRead);
+        result.append(chunk, numWritten);
+        i += numRead;
+    }
+    return true;
+}
+
+bool utf16ToUtf8(const TStringView<char16_t> &str, TStringBase<char> &result) {
+    result.reset();
+    result.reserve(str.size());
+    char chunk[ChunkSize];
+    size_t i = 0;
+    while (i < str.size()) {
+        size_t numRead = 0;
+        bool valid = true;
+        const size_t numWritten = utf16ToUtf8Chunk(str.data(i), str.size() - i, chunk, ChunkSize, numRead, valid);
+        if (!valid) {
+            result.reset();
+            return false;
+        }
+        result.append(chunk, numWritten);
+        i += numRead;
+    }
+    return true;
+}
+
+bool utf32ToUtf8(const TStringView<char32_t> &str, TStringBase<char> &result) {
+    result.reset();
+    result.reserve(str.size());
+    char chunk[ChunkSize];
+    size_t numWritten = 0;
+    for (size_t i = 0; i < str.size(); ++i) {
+        const uint32_t codePoint = static_cast<uint32_t>(str[i]);
+        if (codePoint > 0x10ffff || (codePoint & 0xfffff800) == 0xd800) {
+            result.reset();
+            return false;
+        }
+        if (numWritten + 4 > ChunkSize) {
+            result.append(chunk, numWritten);
+            numWritten = 0;
+        }
+        numWritten += encodeUtf8(codePoint, chunk + numWritten);
+    }
+    result.append(chunk, numWritten);
+    return true;
+}
+
+#undef CPPCORE_UTF8_DISPATCH
+
+} // namespace cppcore
@@ -0,0 +1,205 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+
+// UTF-8 loops, included once per instruction set by Unicode.cpp. The conversion kernels only need
+// the ASCII block functions of the Ops struct, so they are also compiled with the scalar ops.
+
+// Checks one block per call, the errors are accumulated until the end.
+template <class Ops>
+struct Utf8Checker {
+    using Vec = typename Ops::Vec;
+
+    Vec byte1High;
+    Vec byte1Low;
+    Vec byte2High;
+    Vec incompleteMax;
+    Vec error;
+    Vec prev;
+    Vec prevIncomplete;
+
+    // Not implicit, so it will be compiled for the target of the kernel
+    Utf8Checker() :
+            byte1High(Ops::loadTable(Utf8Byte1High)),
+            byte1Low(Ops::loadTable(Utf8Byte1Low)),
+            byte2High(Ops::loadTable(Utf8Byte2High)),
+            incompleteMax(Ops::load(reinterpret_cast<const char *>(Utf8IncompleteMax + sizeof(Utf8IncompleteMax) - Ops::Lanes))),
+            error(Ops::zero()),
+            prev(Ops::zero()),
+            prevIncomplete(Ops::zero()) {
+        // empty
+    }
+
+    void check(Vec input) {
+        if (Ops::moveMask(input) == 0) {
+            // A sequence may not end with ASCII
+            error = Ops::orVec(error, prevIncomplete);
+        } else {
+            // Invalid pairs of bytes, like an overlong lead followed by a continuation byte
+            const Vec prev1 = Ops::prev1(input, prev);
+            const Vec specialCases = Ops::andVec(Ops::andVec(
+                    Ops::shuffle(byte1High, Ops::hiNibbles(prev1)),
+                    Ops::shuffle(byte1Low, Ops::loNibbles(prev1))),
+                    Ops::shuffle(byte2High, Ops::hiNibbles(input)));
+
+            // The third and fourth byte of a sequence must be continuation bytes, the tables
+            // flag two continuation bytes in a row.
+            const Vec isThird = Ops::subsU8(Ops::prev2(input, prev), Ops::set1(static_cast<char>(0xe0 - 0x80)));
+            const Vec isFourth = Ops::subsU8(Ops::prev3(input, prev), Ops::set1(static_cast<char>(0xf0 - 0x80)));
+            const Vec must23 = Ops::andVec(Ops::orVec(isThird, isFourth), Ops::set1(static_cast<char>(0x80)));
+            error = Ops::orVec(error, Ops::xorVec(must23, specialCases));
+
+            // A lead byte in the last three bytes needs bytes of the next block
+            prevIncomplete = Ops::subsU8(input, incompleteMax);
+        }
+        prev = input;
+    }
+};
+
+template <class Ops>
+bool validateUtf8Kernel(const char *data, size_t len) {
+    constexpr size_t Lanes = Ops::Lanes;
+    Utf8Checker<Ops> checker;
+    size_t i = 0;
+    for (; i + 2 * Lanes <= len; i += 2 * Lanes) {
+        const typename Ops::Vec v0 = Ops::load(data + i);
+        const typename Ops::Vec v1 = Ops::load(data + i + Lanes);
+        if (Ops::moveMask(Ops::orVec(v0, v1)) == 0) {
+            checker.error = Ops::orVec(checker.error, checker.prevIncomplete);
+            checker.prev = v1;
+            continue;
+        }
+        checker.check(v0);
+        checker.check(v1);
+    }
+    for (; i + Lanes <= len; i += Lanes) {
+        checker.check(Ops::load(data + i));
+    }
+    if (i < len) {
+        // Zeros are ASCII, so a truncated sequence at the end will be found
+        char tail[Lanes] = {};
+        ::memcpy(tail, data + i, len - i);
+        checker.check(Ops::load(tail));
+    }
+    return Ops::isZero(Ops::orVec(checker.error, checker.prevIncomplete));
+}
+
+template <class Ops>
+size_t countUtf8Kernel(const char *data, size_t len) {
+    constexpr size_t Lanes = Ops::Lanes;
+    // Continuation bytes are 0x80..0xbf, as signed bytes -128..-65
+    const typename Ops::Vec lastContinuation = Ops::set1(static_cast<char>(0xbf));
+    size_t numCodePoints = 0;
+    size_t i = 0;
+    for (; i + Lanes <= len; i += Lanes) {
+        numCodePoints += popcnt32(Ops::moveMask(Ops::cmpGt(Ops::load(data + i), lastContinuation)));
+    }
+    for (; i < len; ++i) {
+        numCodePoints += static_cast<int8_t>(data[i]) > -65 ? 1 : 0;
+    }
+    return numCodePoints;
+}
+
+// The conversion kernels convert until the source is done or the target is almost full and return
+// the number of written units. numRead returns the number of consumed source units. The block
+// functions of the Ops convert a whole block and return the length of its ASCII prefix, the
+// rest of the block will be overwritten.
+
+template <class Ops>
+size_t utf8ToUtf16Kernel(const char *src, size_t len, char16_t *dst, size_t capacity, size_t &numRead) {
+    constexpr size_t Lanes = Ops::Lanes;
+    size_t i = 0, n = 0;
+    while (i < len && n + Lanes + 2 <= capacity) {
+        if (i + Lanes <= len) {
+            const size_t numAscii = Ops::widen16(src + i, dst + n);
+            i += numAscii;
+            n += numAscii;
+            if (numAscii == Lanes) {
+                continue;
+            }
+        }
+        // Runs of non-ASCII code points are decoded one by one
+        do {
+            uint32_t codePoint = 0;
+            i += decodeUtf8(src + i, codePoint);
+            n += encodeUtf16(codePoint, dst + n);
+        } while (i < len && static_cast<int8_t>(src[i]) < 0 && n + 2 <= capacity);
+    }
+    numRead = i;
+    return n;
+}
+
+template <class Ops>
+size_t utf8ToUtf32Kernel(const char *src, size_t len, char32_t *dst, size_t capacity, size_t &numRead) {
+    constexpr size_t Lanes = Ops::Lanes;
+    size_t i = 0, n = 0;
+    while (i < len && n + Lanes + 1 <= capacity) {
+        if (i + Lanes <= len) {
+            const size_t numAscii = Ops::widen32(src + i, dst + n);
+            i += numAscii;
+            n += numAscii;
+            if (numAscii == Lanes) {
+                continue;
+            }
+        }
+        do {
+            uint32_t codePoint = 0;
+            i += decodeUtf8(src + i, codePoint);
+            dst[n++] = static_cast<char32_t>(codePoint);
+        } while (i < len && static_cast<int8_t>(src[i]) < 0 && n + 1 <= capacity);
+    }
+    numRead = i;
+    return n;
+}
+
+template <class Ops>
+size_t utf16ToUtf8Kernel(const char16_t *src, size_t len, char *dst, size_t capacity, size_t &numRead, bool &valid) {
+    constexpr size_t Lanes = Ops::Lanes;
+    size_t i = 0, n = 0;
+    valid = true;
+    while (i < len && n + Lanes + 4 <= capacity) {
+        if (i + Lanes <= len) {
+            const size_t numAscii = Ops::narrow16(src + i, dst + n);
+            i += numAscii;
+            n += numAscii;
+            if (numAscii == Lanes) {
+                continue;
+            }
+        }
+        do {
+            uint32_t codePoint = src[i];
+            if ((codePoint & 0xf800) == 0xd800) {
+                if (codePoint > 0xdbff || i + 1 == len || (src[i + 1] & 0xfc00) != 0xdc00) {
+                    valid = false;
+                    numRead = i;
+                    return n;
+                }
+                codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (src[i + 1] - 0xdc00u);
+                ++i;
+            }
+            ++i;
+            n += encodeUtf8(codePoint, dst + n);
+        } while (i < len && src[i] >= 0x80 && n + 4 <= capacity);
+    }
+    numRead = i;
+    return n;
+}
@@ -0,0 +1,191 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+
+// Generic SIMD loops, included once per instruction set by TAlgorithm.cpp. The including file
+// provides the Ops structs wrapping the intrinsics, so the loops will be compiled for each target.
+// Do not call any inline functions or templates from other headers in here, they would be
+// compiled for the target instruction set as well.
+
+inline uint32_t ctz32(uint32_t value) {
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+}
+
+inline uint32_t popcnt32(uint32_t value) {
+#ifdef _MSC_VER
+    return static_cast<uint32_t>(__popcnt(value));
+#else
+    return static_cast<uint32_t>(__builtin_popcount(value));
+#endif
+}
+
+template <class Ops>
+size_t findKernel(const typename Ops::Scalar *data, size_t count, typename Ops::Scalar value) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    const Vec needle = Ops::set1(value);
+    size_t i = 0;
+    for (; i + 4 * Lanes <= count; i += 4 * Lanes) {
+        const Vec m0 = Ops::cmpEq(Ops::load(data + i), needle);
+        const Vec m1 = Ops::cmpEq(Ops::load(data + i + Lanes), needle);
+        const Vec m2 = Ops::cmpEq(Ops::load(data + i + 2 * Lanes), needle);
+        const Vec m3 = Ops::cmpEq(Ops::load(data + i + 3 * Lanes), needle);
+        if (Ops::moveMask(Ops::orMask(Ops::orMask(m0, m1), Ops::orMask(m2, m3))) != 0) {
+            const uint32_t mask = Ops::moveMask(m0) | (Ops::moveMask(m1) << Lanes) |
+                    (Ops::moveMask(m2) << (2 * Lanes)) | (Ops::moveMask(m3) << (3 * Lanes));
+            return i + ctz32(mask);
+        }
+    }
+    for (; i + Lanes <= count; i += Lanes) {
+        const uint32_t mask = Ops::moveMask(Ops::cmpEq(Ops::load(data + i), needle));
+        if (mask != 0) {
+            return i + ctz32(mask);
+        }
+    }
+    for (; i < count; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return count;
+}
+
+template <class Ops>
+size_t countKernel(const typename Ops::Scalar *data, size_t count, typename Ops::Scalar value) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    const Vec needle = Ops::set1(value);
+    size_t numFound = 0;
+    size_t i = 0;
+    for (; i + 4 * Lanes <= count; i += 4 * Lanes) {
+        const uint32_t mask = Ops::moveMask(Ops::cmpEq(Ops::load(data + i), needle)) |
+                (Ops::moveMask(Ops::cmpEq(Ops::load(data + i + Lanes), needle)) << Lanes) |
+                (Ops::moveMask(Ops::cmpEq(Ops::load(data + i + 2 * Lanes), needle)) << (2 * Lanes)) |
+                (Ops::moveMask(Ops::cmpEq(Ops::load(data + i + 3 * Lanes), needle)) << (3 * Lanes));
+        numFound += popcnt32(mask);
+    }
+    for (; i + Lanes <= count; i += Lanes) {
+        numFound += popcnt32(Ops::moveMask(Ops::cmpEq(Ops::load(data + i), needle)));
+    }
+    for (; i < count; ++i) {
+        if (data[i] == value) {
+            ++numFound;
+        }
+    }
+    return numFound;
+}
+
+template <class Ops>
+void replaceKernel(typename Ops::Scalar *data, size_t count, typename Ops::Scalar oldValue, typename Ops::Scalar newValue) {
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    const Vec oldVec = Ops::set1(oldValue);
+    const Vec newVec = Ops::set1(newValue);
+    size_t i = 0;
+    for (; i + Lanes <= count; i += Lanes) {
+        const Vec v = Ops::load(data + i);
+        Ops::store(data + i, Ops::blend(v, newVec, Ops::cmpEq(v, oldVec)));
+    }
+    for (; i < count; ++i) {
+        if (data[i] == oldValue) {
+            data[i] = newValue;
+        }
+    }
+}
+
+template <class Ops>
+void minMaxKernel(const typename Ops::Scalar *data, size_t count, typename Ops::Scalar &minValue, typename Ops::Scalar &maxValue) {
+    using Scalar = typename Ops::Scalar;
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+    if (count < Lanes) {
+        minValue = maxValue = data[0];
+        for (size_t i = 1; i < count; ++i) {
+            minValue = data[i] < minValue ? data[i] : minValue;
+            maxValue = maxValue < data[i] ? data[i] : maxValue;
+        }
+        return;
+    }
+
+    Vec vMin = Ops::load(data);
+    Vec vMax = vMin;
+    size_t i = Lanes;
+    for (; i + Lanes <= count; i += Lanes) {
+        const Vec v = Ops::load(data + i);
+        vMin = Ops::min(vMin, v);
+        vMax = Ops::max(vMax, v);
+    }
+    if (i < count) {
+        // Overlapping load of the last full vector, does not change the result
+        const Vec v = Ops::load(data + count - Lanes);
+        vMin = Ops::min(vMin, v);
+        vMax = Ops::max(vMax, v);
+    }
+
+    Scalar mins[Lanes], maxs[Lanes];
+    Ops::store(mins, vMin);
+    Ops::store(maxs, vMax);
+    minValue = mins[0];
+    maxValue = maxs[0];
+    for (size_t lane = 1; lane < Lanes; ++lane) {
+        minValue = mins[lane] < minValue ? mins[lane] : minValue;
+        maxValue = maxValue < maxs[lane] ? maxs[lane] : maxValue;
+    }
+}
+
+template <class Ops>
+typename Ops::Scalar sumKernel(const typename Ops::Scalar *data, size_t count) {
+    using Scalar = typename Ops::Scalar;
+    using Vec = typename Ops::Vec;
+    constexpr size_t Lanes = Ops::Lanes;
+
+    // Independent accumulators hide the latency of the adds
+    Vec acc0 = Ops::zero(), acc1 = Ops::zero(), acc2 = Ops::zero(), acc3 = Ops::zero();
+    size_t i = 0;
+    for (; i + 4 * Lanes <= count; i += 4 * Lanes) {
+        acc0 = Ops::add(acc0, Ops::load(data + i));
+        acc1 = Ops::add(acc1, Ops::load(data + i + Lanes));
+        acc2 = Ops::add(acc2, Ops::load(data + i + 2 * Lanes));
+        acc3 = Ops::add(acc3, Ops::load(data + i + 3 * Lanes));
+    }
+    for (; i + Lanes <= count; i += Lanes) {
+        acc0 = Ops::add(acc0, Ops::load(data + i));
+    }
+    acc0 = Ops::add(Ops::add(acc0, acc1), Ops::add(acc2, acc3));
+
+    Scalar lanes[Lanes];
+    Ops::store(lanes, acc0);
+    Scalar result = lanes[0];
+    for (size_t lane = 1; lane < Lanes; ++lane) {
+        result = Ops::addScalar(result, lanes[lane]);
+    }
+    for (; i < count; ++i) {
+        result = Ops::addScalar(result, data[i]);
+    }
+    return result;
+}
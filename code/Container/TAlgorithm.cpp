@@ -0,0 +1,457 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <cppcore/Container/TAlgorithm.h>
+#include <cppcore/Common/CPUInfo.h>
+
+#ifdef CPPCORE_ARCH_X86
+#   include <immintrin.h>
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   endif
+#endif
+
+namespace cppcore {
+
+#ifdef CPPCORE_ARCH_X86
+
+namespace {
+
+// The kernels are compiled for their instruction set by a target pragma instead of a per-file
+// compiler switch, so the rest of the library stays usable on any x86 CPU. MSVC does not need
+// the pragma to emit the intrinsics.
+#if defined(__clang__)
+#   pragma clang attribute push(__attribute__((target("avx2,popcnt"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC push_options
+#   pragma GCC target("avx2,popcnt")
+#endif
+
+namespace avx2 {
+
+    struct OpsI32 {
+        using Scalar = int32_t;
+        using Vec = __m256i;
+        static constexpr size_t Lanes = 8;
+        static Vec load(const Scalar *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        static void store(Scalar *p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+        static Vec set1(Scalar v) { return _mm256_set1_epi32(v); }
+        static Vec zero() { return _mm256_setzero_si256(); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm256_cmpeq_epi32(a, b); }
+        static Vec orMask(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+        static uint32_t moveMask(Vec m) { return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(m))); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm256_blendv_epi8(a, b, m); }
+        static Vec add(Vec a, Vec b) { return _mm256_add_epi32(a, b); }
+        static Vec min(Vec a, Vec b) { return _mm256_min_epi32(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm256_max_epi32(a, b); }
+        static Scalar addScalar(Scalar a, Scalar b) { return static_cast<Scalar>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b)); }
+    };
+
+    struct OpsU32 {
+        using Scalar = uint32_t;
+        using Vec = __m256i;
+        static constexpr size_t Lanes = 8;
+        static Vec load(const Scalar *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        static void store(Scalar *p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+        static Vec min(Vec a, Vec b) { return _mm256_min_epu32(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm256_max_epu32(a, b); }
+    };
+
+    struct OpsI64 {
+        using Scalar = int64_t;
+        using Vec = __m256i;
+        static constexpr size_t Lanes = 4;
+        static Vec load(const Scalar *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        static void store(Scalar *p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+        static Vec set1(Scalar v) { return _mm256_set1_epi64x(v); }
+        static Vec zero() { return _mm256_setzero_si256(); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm256_cmpeq_epi64(a, b); }
+        static Vec orMask(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+        static uint32_t moveMask(Vec m) { return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(m))); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm256_blendv_epi8(a, b, m); }
+        static Vec add(Vec a, Vec b) { return _mm256_add_epi64(a, b); }
+        static Vec min(Vec a, Vec b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+        static Vec max(Vec a, Vec b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+        static Scalar addScalar(Scalar a, Scalar b) { return static_cast<Scalar>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b)); }
+    };
+
+    struct OpsF32 {
+        using Scalar = float;
+        using Vec = __m256;
+        static constexpr size_t Lanes = 8;
+        static Vec load(const Scalar *p) { return _mm256_loadu_ps(p); }
+        static void store(Scalar *p, Vec v) { _mm256_storeu_ps(p, v); }
+        static Vec set1(Scalar v) { return _mm256_set1_ps(v); }
+        static Vec zero() { return _mm256_setzero_ps(); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+        static Vec orMask(Vec a, Vec b) { return _mm256_or_ps(a, b); }
+        static uint32_t moveMask(Vec m) { return static_cast<uint32_t>(_mm256_movemask_ps(m)); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm256_blendv_ps(a, b, m); }
+        static Vec add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+        static Vec min(Vec a, Vec b) { return _mm256_min_ps(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+        static Scalar addScalar(Scalar a, Scalar b) { return a + b; }
+    };
+
+    struct OpsF64 {
+        using Scalar = double;
+        using Vec = __m256d;
+        static constexpr size_t Lanes = 4;
+        static Vec load(const Scalar *p) { return _mm256_loadu_pd(p); }
+        static void store(Scalar *p, Vec v) { _mm256_storeu_pd(p, v); }
+        static Vec set1(Scalar v) { return _mm256_set1_pd(v); }
+        static Vec zero() { return _mm256_setzero_pd(); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+        static Vec orMask(Vec a, Vec b) { return _mm256_or_pd(a, b); }
+        static uint32_t moveMask(Vec m) { return static_cast<uint32_t>(_mm256_movemask_pd(m)); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm256_blendv_pd(a, b, m); }
+        static Vec add(Vec a, Vec b) { return _mm256_add_pd(a, b); }
+        static Vec min(Vec a, Vec b) { return _mm256_min_pd(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm256_max_pd(a, b); }
+        static Scalar addScalar(Scalar a, Scalar b) { return a + b; }
+    };
+
+#   include "SimdKernels.inl"
+
+} // namespace avx2
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#   pragma clang attribute push(__attribute__((target("sse4.2,popcnt"))), apply_to = function)
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#   pragma GCC push_options
+#   pragma GCC target("sse4.2,popcnt")
+#endif
+
+namespace sse42 {
+
+    struct OpsI32 {
+        using Scalar = int32_t;
+        using Vec = __m128i;
+        static constexpr size_t Lanes = 4;
+        static Vec load(const Scalar *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        static void store(Scalar *p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+        static Vec set1(Scalar v) { return _mm_set1_epi32(v); }
+        static Vec zero() { return _mm_setzero_si128(); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm_cmpeq_epi32(a, b); }
+        static Vec orMask(Vec a, Vec b) { return _mm_or_si128(a, b); }
+        static uint32_t moveMask(Vec m) { return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(m))); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm_blendv_epi8(a, b, m); }
+        static Vec add(Vec a, Vec b) { return _mm_add_epi32(a, b); }
+        static Vec min(Vec a, Vec b) { return _mm_min_epi32(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm_max_epi32(a, b); }
+        static Scalar addScalar(Scalar a, Scalar b) { return static_cast<Scalar>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b)); }
+    };
+
+    struct OpsU32 {
+        using Scalar = uint32_t;
+        using Vec = __m128i;
+        static constexpr size_t Lanes = 4;
+        static Vec load(const Scalar *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        static void store(Scalar *p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+        static Vec min(Vec a, Vec b) { return _mm_min_epu32(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm_max_epu32(a, b); }
+    };
+
+    struct OpsI64 {
+        using Scalar = int64_t;
+        using Vec = __m128i;
+        static constexpr size_t Lanes = 2;
+        static Vec load(const Scalar *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        static void store(Scalar *p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+        static Vec set1(Scalar v) { return _mm_set1_epi64x(v); }
+        static Vec zero() { return _mm_setzero_si128(); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm_cmpeq_epi64(a, b); }
+        static Vec orMask(Vec a, Vec b) { return _mm_or_si128(a, b); }
+        static uint32_t moveMask(Vec m) { return static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(m))); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm_blendv_epi8(a, b, m); }
+        static Vec add(Vec a, Vec b) { return _mm_add_epi64(a, b); }
+        static Vec min(Vec a, Vec b) { return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b)); }
+        static Vec max(Vec a, Vec b) { return _mm_blendv_epi8(b, a, _mm_cmpgt_epi64(a, b)); }
+        static Scalar addScalar(Scalar a, Scalar b) { return static_cast<Scalar>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b)); }
+    };
+
+    struct OpsF32 {
+        using Scalar = float;
+        using Vec = __m128;
+        static constexpr size_t Lanes = 4;
+        static Vec load(const Scalar *p) { return _mm_loadu_ps(p); }
+        static void store(Scalar *p, Vec v) { _mm_storeu_ps(p, v); }
+        static Vec set1(Scalar v) { return _mm_set1_ps(v); }
+        static Vec zero() { return _mm_setzero_ps(); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm_cmpeq_ps(a, b); }
+        static Vec orMask(Vec a, Vec b) { return _mm_or_ps(a, b); }
+        static uint32_t moveMask(Vec m) { return static_cast<uint32_t>(_mm_movemask_ps(m)); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm_blendv_ps(a, b, m); }
+        static Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+        static Vec min(Vec a, Vec b) { return _mm_min_ps(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm_max_ps(a, b); }
+        static Scalar addScalar(Scalar a, Scalar b) { return a + b; }
+    };
+
+    struct OpsF64 {
+        using Scalar = double;
+        using Vec = __m128d;
+        static constexpr size_t Lanes = 2;
+        static Vec load(const Scalar *p) { return _mm_loadu_pd(p); }
+        static void store(Scalar *p, Vec v) { _mm_storeu_pd(p, v); }
+        static Vec set1(Scalar v) { return _mm_set1_pd(v); }
+        static Vec zero() { return _mm_setzero_pd(); }
+        static Vec cmpEq(Vec a, Vec b) { return _mm_cmpeq_pd(a, b); }
+        static Vec orMask(Vec a, Vec b) { return _mm_or_pd(a, b); }
+        static uint32_t moveMask(Vec m) { return static_cast<uint32_t>(_mm_movemask_pd(m)); }
+        static Vec blend(Vec a, Vec b, Vec m) { return _mm_blendv_pd(a, b, m); }
+        static Vec add(Vec a, Vec b) { return _mm_add_pd(a, b); }
+        static Vec min(Vec a, Vec b) { return _mm_min_pd(a, b); }
+        static Vec max(Vec a, Vec b) { return _mm_max_pd(a, b); }
+        static Scalar addScalar(Scalar a, Scalar b) { return a + b; }
+    };
+
+#   include "SimdKernels.inl"
+
+    // The scan is bound by the carry between the vectors, so wider registers will not help and
+    // this version is used for the AVX2 level as well.
+    void prefixSumI32(const int32_t *in, int32_t *out, size_t count) {
+        __m128i carry = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+            x = _mm_add_epi32(x, carry);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), x);
+            carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+        uint32_t current = static_cast<uint32_t>(_mm_cvtsi128_si32(carry));
+        for (; i < count; ++i) {
+            current += static_cast<uint32_t>(in[i]);
+            out[i] = static_cast<int32_t>(current);
+        }
+    }
+
+    void prefixSumF32(const float *in, float *out, size_t count) {
+        __m128 carry = _mm_setzero_ps();
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128 x = _mm_loadu_ps(in + i);
+            x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+            x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+            x = _mm_add_ps(x, carry);
+            _mm_storeu_ps(out + i, x);
+            carry = _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+        float current = _mm_cvtss_f32(carry);
+        for (; i < count; ++i) {
+            current += in[i];
+            out[i] = current;
+        }
+    }
+
+} // namespace sse42
+
+#if defined(__clang__)
+#   pragma clang attribute pop
+#elif defined(__GNUC__)
+#   pragma GCC pop_options
+#endif
+
+} // namespace
+
+#   define CPPCORE_SIMD_DISPATCH(kernel, ops, ...)                        \
+        switch (CPUInfo::getSimdLevel()) {                                  \
+            case CPUInfo::SimdLevel::AVX2:                                  \
+                return avx2::kernel<avx2::ops>(__VA_ARGS__);                \
+            case CPUInfo::SimdLevel::SSE42:                                 \
+                return sse42::kernel<sse42::ops>(__VA_ARGS__);              \
+            default:                                                        \
+                break;                                                      \
+        }
+#else
+#   define CPPCORE_SIMD_DISPATCH(kernel, ops, ...)
+#endif
+
+namespace Details {
+
+size_t findImpl(const int32_t *data, size_t count, int32_t value) {
+    CPPCORE_SIMD_DISPATCH(findKernel, OpsI32, data, count, value)
+    return findScalar(data, count, value);
+}
+
+size_t findImpl(const uint32_t *data, size_t count, uint32_t value) {
+    return findImpl(reinterpret_cast<const int32_t *>(data), count, static_cast<int32_t>(value));
+}
+
+size_t findImpl(const int64_t *data, size_t count, int64_t value) {
+    CPPCORE_SIMD_DISPATCH(findKernel, OpsI64, data, count, value)
+    return findScalar(data, count, value);
+}
+
+size_t findImpl(const uint64_t *data, size_t count, uint64_t value) {
+    return findImpl(reinterpret_cast<const int64_t *>(data), count, static_cast<int64_t>(value));
+}
+
+size_t findImpl(const float *data, size_t count, float value) {
+    CPPCORE_SIMD_DISPATCH(findKernel, OpsF32, data, count, value)
+    return findScalar(data, count, value);
+}
+
+size_t findImpl(const double *data, size_t count, double value) {
+    CPPCORE_SIMD_DISPATCH(findKernel, OpsF64, data, count, value)
+    return findScalar(data, count, value);
+}
+
+size_t countImpl(const int32_t *data, size_t count, int32_t value) {
+    CPPCORE_SIMD_DISPATCH(countKernel, OpsI32, data, count, value)
+    return countScalar(data, count, value);
+}
+
+size_t countImpl(const uint32_t *data, size_t count, uint32_t value) {
+    return countImpl(reinterpret_cast<const int32_t *>(data), count, static_cast<int32_t>(value));
+}
+
+size_t countImpl(const int64_t *data, size_t count, int64_t value) {
+    CPPCORE_SIMD_DISPATCH(countKernel, OpsI64, data, count, value)
+    return countScalar(data, count, value);
+}
+
+size_t countImpl(const uint64_t *data, size_t count, uint64_t value) {
+    return countImpl(reinterpret_cast<const int64_t *>(data), count, static_cast<int64_t>(value));
+}
+
+size_t countImpl(const float *data, size_t count, float value) {
+    CPPCORE_SIMD_DISPATCH(countKernel, OpsF32, data, count, value)
+    return countScalar(data, count, value);
+}
+
+size_t countImpl(const double *data, size_t count, double value) {
+    CPPCORE_SIMD_DISPATCH(countKernel, OpsF64, data, count, value)
+    return countScalar(data, count, value);
+}
+
+void minMaxImpl(const int32_t *data, size_t count, int32_t &minValue, int32_t &maxValue) {
+    CPPCORE_SIMD_DISPATCH(minMaxKernel, OpsI32, data, count, minValue, maxValue)
+    minMaxScalar(data, count, minValue, maxValue);
+}
+
+void minMaxImpl(const uint32_t *data, size_t count, uint32_t &minValue, uint32_t &maxValue) {
+    CPPCORE_SIMD_DISPATCH(minMaxKernel, OpsU32, data, count, minValue, maxValue)
+    minMaxScalar(data, count, minValue, maxValue);
+}
+
+void minMaxImpl(const int64_t *data, size_t count, int64_t &minValue, int64_t &maxValue) {
+    CPPCORE_SIMD_DISPATCH(minMaxKernel, OpsI64, data, count, minValue, maxValue)
+    minMaxScalar(data, count, minValue, maxValue);
+}
+
+void minMaxImpl(const float *data, size_t count, float &minValue, float &maxValue) {
+    CPPCORE_SIMD_DISPATCH(minMaxKernel, OpsF32, data, count, minValue, maxValue)
+    minMaxScalar(data, count, minValue, maxValue);
+}
+
+void minMaxImpl(const double *data, size_t count, double &minValue, double &maxValue) {
+    CPPCORE_SIMD_DISPATCH(minMaxKernel, OpsF64, data, count, minValue, maxValue)
+    minMaxScalar(data, count, minValue, maxValue);
+}
+
+int32_t sumImpl(const int32_t *data, size_t count) {
+    CPPCORE_SIMD_DISPATCH(sumKernel, OpsI32, data, count)
+    return sumScalarWrapped(data, count, std::true_type());
+}
+
+uint32_t sumImpl(const uint32_t *data, size_t count) {
+    return static_cast<uint32_t>(sumImpl(reinterpret_cast<const int32_t *>(data), count));
+}
+
+int64_t sumImpl(const int64_t *data, size_t count) {
+    CPPCORE_SIMD_DISPATCH(sumKernel, OpsI64, data, count)
+    return sumScalarWrapped(data, count, std::true_type());
+}
+
+uint64_t sumImpl(const uint64_t *data, size_t count) {
+    return static_cast<uint64_t>(sumImpl(reinterpret_cast<const int64_t *>(data), count));
+}
+
+float sumImpl(const float *data, size_t count) {
+    CPPCORE_SIMD_DISPATCH(sumKernel, OpsF32, data, count)
+    return sumScalar(data, count);
+}
+
+double sumImpl(const double *data, size_t count) {
+    CPPCORE_SIMD_DISPATCH(sumKernel, OpsF64, data, count)
+    return sumScalar(data, count);
+}
+
+void prefixSumImpl(const int32_t *in, int32_t *out, size_t count) {
+#ifdef CPPCORE_ARCH_X86
+    if (CPUInfo::getSimdLevel() != CPUInfo::SimdLevel::Scalar) {
+        sse42::prefixSumI32(in, out, count);
+        return;
+    }
+#endif
+    prefixSumScalarWrapped(in, out, count, std::true_type());
+}
+
+void prefixSumImpl(const uint32_t *in, uint32_t *out, size_t count) {
+    prefixSumImpl(reinterpret_cast<const int32_t *>(in), reinterpret_cast<int32_t *>(out), count);
+}
+
+void prefixSumImpl(const float *in, float *out, size_t count) {
+#ifdef CPPCORE_ARCH_X86
+    if (CPUInfo::getSimdLevel() != CPUInfo::SimdLevel::Scalar) {
+        sse42::prefixSumF32(in, out, count);
+        return;
+    }
+#endif
+    prefixSumScalar(in, out, count);
+}
+
+void replaceImpl(int32_t *data, size_t count, int32_t oldValue, int32_t newValue) {
+    CPPCORE_SIMD_DISPATCH(replaceKernel, OpsI32, data, count, oldValue, newValue)
+    replaceScalar(data, count, oldValue, newValue);
+}
+
+void replaceImpl(uint32_t *data, size_t count, uint32_t oldValue, uint32_t newValue) {
+    replaceImpl(reinterpret_cast<int32_t *>(data), count, static_cast<int32_t>(oldValue), static_cast<int32_t>(newValue));
+}
+
+void replaceImpl(int64_t *data, size_t count, int64_t oldValue, int64_t newValue) {
+    CPPCORE_SIMD_DISPATCH(replaceKernel, OpsI64, data, count, oldValue, newValue)
+    replaceScalar(data, count, oldValue, newValue);
+}
+
+void replaceImpl(uint64_t *data, size_t count, uint64_t oldValue, uint64_t newValue) {
+    replaceImpl(reinterpret_cast<int64_t *>(data), count, static_cast<int64_t>(oldValue), static_cast<int64_t>(newValue));
+}
+
+void replaceImpl(float *data, size_t count, float oldValue, float newValue) {
+    CPPCORE_SIMD_DISPATCH(replaceKernel, OpsF32, data, count, oldValue, newValue)
+    replaceScalar(data, count, oldValue, newValue);
+}
+
+void replaceImpl(double *data, size_t count, double oldValue, double newValue) {
+    CPPCORE_SIMD_DISPATCH(replaceKernel, OpsF64, data, count, oldValue, newValue)
+    replaceScalar(data, count, oldValue, newValue);
+}
+
+} // namespace Details
+} // namespace cppcore
@@ -30,6 +30,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <stdio.h>
 #include <stdarg.h>
 #include <malloc.h>
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
 
 namespace cppcore {
 
@@ -55,9 +58,11 @@ namespace cppcore {
     // All disabled warnings for windows
 #   pragma warning( disable : 4251 ) // <class> needs to have dll-interface to be used by clients of class <class>
 #   define CPPCORE_STACK_ALLOC(size)    ::alloca(size)
+#   define CPPCORE_PREFETCH(addr)       _mm_prefetch(reinterpret_cast<const char *>(addr), 3 /* _MM_HINT_T0 */)
 #else
 #   define DLL_CPPCORE_EXPORT           __attribute__((visibility("default")))
 #   define CPPCORE_STACK_ALLOC(size)    __builtin_alloca(size)
+#   define CPPCORE_PREFETCH(addr)       __builtin_prefetch(addr)
 #endif
 
 //-------------------------------------------------------------------------------------------------
@@ -0,0 +1,72 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
+
+namespace cppcore {
+
+/// @brief  Will return the number of trailing zero bits.
+/// @param[in] value    The value to check, must not be zero.
+/// @return The index of the lowest set bit.
+inline uint32_t countTrailingZeros(uint64_t value) {
+    assert(value != 0);
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+}
+
+/// @brief  Will return the number of leading zero bits.
+/// @param[in] value    The value to check, must not be zero.
+/// @return The number of zero bits above the highest set bit.
+inline uint32_t countLeadingZeros(uint64_t value) {
+    assert(value != 0);
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return static_cast<uint32_t>(63 - index);
+#else
+    return static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+}
+
+/// @brief  Will return the number of set bits.
+/// @param[in] value    The value to check.
+/// @return The number of set bits.
+inline uint32_t popCount(uint64_t value) {
+#ifdef _MSC_VER
+    return static_cast<uint32_t>(__popcnt64(value));
+#else
+    return static_cast<uint32_t>(__builtin_popcountll(value));
+#endif
+}
+
+} // namespace cppcore
@@ -0,0 +1,82 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#   define CPPCORE_ARCH_X86
+#endif
+
+namespace cppcore {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		CPUInfo
+///	@ingroup	CPPCore
+///
+///	@brief  Utility class to detect the instruction sets supported by the current CPU.
+///
+/// The SIMD kernels of cppcore will be selected at runtime by using the reported SIMD level, so
+/// the library can be built for a generic target and will still use AVX2 when it is there.
+//-------------------------------------------------------------------------------------------------
+class DLL_CPPCORE_EXPORT CPUInfo {
+public:
+    /// @brief  The detectable CPU features.
+    enum class Feature {
+        SSE2,       ///< SSE2 instructions
+        SSE41,      ///< SSE 4.1 instructions
+        SSE42,      ///< SSE 4.2 instructions, including crc32
+        POPCNT,     ///< popcnt instruction
+        PCLMUL,     ///< Carry-less multiplication
+        AVX,        ///< AVX instructions, including OS support
+        AVX2,       ///< AVX2 instructions, including OS support
+        BMI2,       ///< BMI2 instructions
+        InvariantTSC, ///< The time stamp counter runs with a constant rate
+        Count       ///< Number of enums
+    };
+
+    /// @brief  The SIMD levels used to select kernels.
+    enum class SimdLevel {
+        Scalar = 0, ///< No SIMD kernels, portable code only
+        SSE42,      ///< SSE 4.2 and popcnt kernels
+        AVX2        ///< AVX2 kernels
+    };
+
+    /// @brief  Will return true, if the feature is supported by the CPU.
+    /// @param[in] feature  The feature to check.
+    /// @return true, if supported.
+    static bool hasFeature(Feature feature);
+
+    /// @brief  Will return the SIMD level used for kernel selection.
+    /// @return The best supported level, not higher than the configured limit.
+    static SimdLevel getSimdLevel();
+
+    /// @brief  Will limit the SIMD level, use it to test or benchmark the fallback kernels.
+    /// @param[in] level    The highest level to use.
+    static void setSimdLevelLimit(SimdLevel level);
+
+    CPUInfo() = delete;
+    ~CPUInfo() = delete;
+};
+
+} // namespace cppcore
@@ -0,0 +1,91 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+
+namespace cppcore {
+
+/// @brief  Computes the CRC32C (Castagnoli) checksum of a buffer.
+/// @param  buffer  [in] The buffer.
+/// @param  len     [in] The buffer size in bytes.
+/// @param  crc     [in] The checksum of the previous chunks, 0 for the first one.
+/// @return The checksum of all chunks so far.
+/// @remark Uses the SSE4.2 crc32 instruction on three interleaved streams when the CPU supports
+///         it, otherwise a table-driven slicing-by-8 version. Both give the same results.
+/// @code
+/// uint32_t crc = crc32c(block0, size0);
+/// crc = crc32c(block1, size1, crc);
+/// @endcode
+DLL_CPPCORE_EXPORT uint32_t crc32c(const void *buffer, size_t len, uint32_t crc = 0);
+
+/// @brief  Computes the Adler-32 checksum of a buffer, as used by zlib.
+/// @param  buffer  [in] The buffer.
+/// @param  len     [in] The buffer size in bytes.
+/// @param  adler   [in] The checksum of the previous chunks, 1 for the first one.
+/// @return The checksum of all chunks so far.
+DLL_CPPCORE_EXPORT uint32_t adler32(const void *buffer, size_t len, uint32_t adler = 1);
+
+/// @brief  Computes the XXH64 hash of a buffer.
+/// @param  buffer  [in] The buffer.
+/// @param  len     [in] The buffer size in bytes.
+/// @param  seed    [in] The seed.
+/// @return The 64-bit hash, compatible to the reference implementation of xxHash.
+DLL_CPPCORE_EXPORT uint64_t xxh64(const void *buffer, size_t len, uint64_t seed = 0);
+
+//-------------------------------------------------------------------------------------------------
+///	@class		Xxh64Hasher
+///	@ingroup	CPPCore
+///
+///	@brief  Computes the XXH64 hash of chunked data.
+///
+/// The result is the same as xxh64 of all data in one buffer, independent of the chunk sizes.
+//-------------------------------------------------------------------------------------------------
+class DLL_CPPCORE_EXPORT Xxh64Hasher {
+public:
+    /// @brief  The class constructor.
+    /// @param  seed    [in] The seed.
+    explicit Xxh64Hasher(uint64_t seed = 0);
+
+    /// @brief  Will restart the hashing.
+    /// @param  seed    [in] The seed.
+    void reset(uint64_t seed = 0);
+
+    /// @brief  Will add data.
+    /// @param  buffer  [in] The data.
+    /// @param  len     [in] The data size in bytes.
+    void update(const void *buffer, size_t len);
+
+    /// @brief  Will return the hash of all data added so far, more data can be added afterwards.
+    /// @return The 64-bit hash.
+    uint64_t finish() const;
+
+private:
+    uint64_t mSeed;
+    uint64_t mLanes[4];
+    uint64_t mTotalLen;
+    uint8_t mBuffer[32];
+    size_t mBufferLen;
+};
+
+} // namespace cppcore
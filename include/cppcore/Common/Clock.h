@@ -0,0 +1,176 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+
+namespace cppcore {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		Clock
+///	@ingroup	CPPCore
+///
+///	@brief  A monotonic high-resolution clock to measure durations.
+///
+/// now() returns nanoseconds of the monotonic system clock. ticks() is cheaper: it reads the
+/// time stamp counter of the CPU, when it runs with a constant rate, and falls back to now()
+/// otherwise. The ticks are converted into nanoseconds by toNanoseconds, the rate of the counter
+/// will be calibrated against the system clock on the first call.
+/// @code
+/// const uint64_t start = Clock::ticks();
+/// ...
+/// const uint64_t ns = Clock::toNanoseconds(Clock::ticks() - start);
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+class DLL_CPPCORE_EXPORT Clock {
+public:
+    /// @brief  Will return the time of the monotonic system clock.
+    /// @return The time in nanoseconds since an unspecified start.
+    static uint64_t now();
+
+    /// @brief  Will return the ticks of the fastest available monotonic counter.
+    /// @return The ticks since an unspecified start.
+    static uint64_t ticks();
+
+    /// @brief  Will convert ticks or a difference of ticks into nanoseconds.
+    /// @param[in] ticks    The ticks.
+    /// @return The nanoseconds.
+    static uint64_t toNanoseconds(uint64_t ticks);
+
+    /// @brief  Will return true, if ticks reads the time stamp counter of the CPU.
+    /// @return true for the time stamp counter, false if ticks are nanoseconds.
+    static bool usesTimeStampCounter();
+
+    Clock() = delete;
+    ~Clock() = delete;
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@class		Stopwatch
+///	@ingroup	CPPCore
+///
+///	@brief  Measures the time since it was started.
+//-------------------------------------------------------------------------------------------------
+class Stopwatch {
+public:
+    /// @brief  The class constructor, the stopwatch will be started.
+    Stopwatch();
+
+    /// @brief  Will restart the stopwatch.
+    void restart();
+
+    /// @brief  Will return the elapsed ticks since the start.
+    /// @return The elapsed ticks, see Clock::ticks.
+    uint64_t elapsedTicks() const;
+
+    /// @brief  Will return the elapsed time since the start.
+    /// @return The elapsed time in nanoseconds.
+    uint64_t elapsedNanoseconds() const;
+
+    /// @brief  Will return the elapsed time since the start.
+    /// @return The elapsed time in seconds.
+    double elapsedSeconds() const;
+
+private:
+    uint64_t mStart;
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TimerSink
+///	@ingroup	CPPCore
+///
+///	@brief  This pure abstract interface class receives the measurements of scoped timers.
+//-------------------------------------------------------------------------------------------------
+class TimerSink {
+public:
+    /// @brief  The default class destructor, virtual.
+    virtual ~TimerSink() = default;
+
+    /// @brief  Will be called with the duration of a scope.
+    /// @param[in] name         The name of the timer.
+    /// @param[in] nanoseconds  The duration of the scope.
+    virtual void report(const char *name, uint64_t nanoseconds) = 0;
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@class		ScopedTimer
+///	@ingroup	CPPCore
+///
+///	@brief  Measures the lifetime of a scope and reports it into a sink.
+/// @code
+/// void update() {
+///     ScopedTimer timer(profileSink, "update");
+///     ...
+/// }
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+class ScopedTimer {
+public:
+    /// @brief  The class constructor, the measurement starts.
+    /// @param[in] sink     The sink, must live longer than the timer.
+    /// @param[in] name     The name of the timer, must live longer than the timer.
+    ScopedTimer(TimerSink &sink, const char *name);
+
+    /// @brief  The class destructor, the duration will be reported.
+    ~ScopedTimer();
+
+    /// No copying allowed
+    CPPCORE_NONE_COPYING(ScopedTimer)
+
+private:
+    TimerSink &mSink;
+    const char *mName;
+    uint64_t mStart;
+};
+
+inline Stopwatch::Stopwatch() :
+        mStart(Clock::ticks()) {
+    // empty
+}
+
+inline void Stopwatch::restart() {
+    mStart = Clock::ticks();
+}
+
+inline uint64_t Stopwatch::elapsedTicks() const {
+    return Clock::ticks() - mStart;
+}
+
+inline uint64_t Stopwatch::elapsedNanoseconds() const {
+    return Clock::toNanoseconds(elapsedTicks());
+}
+
+inline double Stopwatch::elapsedSeconds() const {
+    return static_cast<double>(elapsedNanoseconds()) * 1e-9;
+}
+
+inline ScopedTimer::ScopedTimer(TimerSink &sink, const char *name) :
+        mSink(sink), mName(name), mStart(Clock::ticks()) {
+    // empty
+}
+
+inline ScopedTimer::~ScopedTimer() {
+    mSink.report(mName, Clock::toNanoseconds(Clock::ticks() - mStart));
+}
+
+} // namespace cppcore
@@ -24,8 +24,349 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <cppcore/CPPCoreCommon.h>
 
+#include <cstring>
+
 namespace cppcore {
 
+/// @brief  The offset basis of the 64-bit FNV-1a hash.
+static constexpr HashId Fnv1aOffsetBasis = 14695981039346656037ull;
+
+/// @brief  The prime of the 64-bit FNV-1a hash.
+static constexpr HashId Fnv1aPrime = 1099511628211ull;
+
+/// @brief  Computes the 64-bit FNV-1a hash for a byte buffer.
+/// @param  buffer  [in] The buffer.
+/// @param  len     [in] The buffer size in bytes.
+/// @param  seed    [in] The start value, use it to chain several buffers.
+/// @return The full 64-bit hash value, not reduced to any table size.
+inline HashId fnv1aHash(const void *buffer, size_t len, HashId seed = Fnv1aOffsetBasis) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(buffer);
+    HashId hash = seed;
+    for (size_t i = 0; i < len; ++i) {
+        hash = (hash ^ bytes[i]) * Fnv1aPrime;
+    }
+
+    return hash;
+}
+
+/// @brief  Mixes the bits of an integer, so every input bit changes each output bit with a
+///         probability of about 50%. Uses the finalizer of MurmurHash3.
+/// @param  value   [in] The value to mix.
+/// @return The mixed value, the mixing is a bijection.
+inline HashId mix64(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ull;
+    value ^= value >> 33;
+    return value;
+}
+
+/// @brief  Combines a hash value with the hash of another value, use it for compound keys.
+/// @param  seed    [in] The hash so far.
+/// @param  value   [in] The value to add.
+/// @return The combined hash value.
+inline HashId hashCombine(HashId seed, uint64_t value) {
+    return mix64(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)));
+}
+
+namespace Details {
+
+    static constexpr uint64_t HashSecret0 = 0xa0761d6478bd642full;
+    static constexpr uint64_t HashSecret1 = 0xe7037ed1a0b428dbull;
+    static constexpr uint64_t HashSecret2 = 0x8ebc6af09c88c6e3ull;
+    static constexpr uint64_t HashSecret3 = 0x589965cc75374cc3ull;
+
+    /// @brief The block size of hash64.
+    static constexpr size_t HashBlockSize = 32;
+
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 HashUInt128;
+#endif
+
+    // Multiplies to 128 bits without a native 128-bit type and folds the halves.
+    constexpr uint64_t hashMumPortable(uint64_t a, uint64_t b) {
+        const uint64_t aLo = a & 0xffffffffull, aHi = a >> 32;
+        const uint64_t bLo = b & 0xffffffffull, bHi = b >> 32;
+        const uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+        const uint64_t mid = (ll >> 32) + (lh & 0xffffffffull) + (hl & 0xffffffffull);
+        const uint64_t lo = (ll & 0xffffffffull) | (mid << 32);
+        const uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        return lo ^ hi;
+    }
+
+    // The loads and the multiply of hash64 at runtime. Loads are little-endian, so the hash is
+    // the same on all targets and matches constHash.
+    struct HashRuntimeOps {
+        // Multiplies to 128 bits and folds the halves, the core of wyhash.
+        static uint64_t mum(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+            const HashUInt128 r = static_cast<HashUInt128>(a) * b;
+            return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            uint64_t hi = 0;
+            const uint64_t lo = _umul128(a, b, &hi);
+            return lo ^ hi;
+#else
+            return hashMumPortable(a, b);
+#endif
+        }
+
+        static uint64_t read64(const uint8_t *p) {
+            uint64_t value;
+            ::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap64(value);
+#endif
+            return value;
+        }
+
+        static uint64_t read32(const uint8_t *p) {
+            uint32_t value;
+            ::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap32(value);
+#endif
+            return value;
+        }
+    };
+
+    // The same operations for constant evaluation, the bytes are assembled one by one.
+    struct HashConstOps {
+        static constexpr uint64_t mum(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+            return static_cast<uint64_t>(static_cast<HashUInt128>(a) * b) ^
+                   static_cast<uint64_t>((static_cast<HashUInt128>(a) * b) >> 64);
+#else
+            return hashMumPortable(a, b);
+#endif
+        }
+
+        static constexpr uint64_t read64(const char *p) {
+            uint64_t value = 0;
+            for (size_t i = 8; i > 0; --i) {
+                value = (value << 8) | static_cast<uint8_t>(p[i - 1]);
+            }
+            return value;
+        }
+
+        static constexpr uint64_t read32(const char *p) {
+            uint64_t value = 0;
+            for (size_t i = 4; i > 0; --i) {
+                value = (value << 8) | static_cast<uint8_t>(p[i - 1]);
+            }
+            return value;
+        }
+    };
+
+    template <class TOps>
+    constexpr uint64_t hashSeed(HashId seed) {
+        return seed ^ TOps::mum(seed ^ HashSecret0, HashSecret1);
+    }
+
+    // Up to 32 bytes are read with overlapping loads instead of a loop.
+    template <class TOps, class TByte>
+    constexpr HashId hashShort(const TByte *p, size_t len, uint64_t seed) {
+        uint64_t a = 0, b = 0;
+        if (len > 16) {
+            a = TOps::mum(TOps::read64(p) ^ HashSecret1, TOps::read64(p + 8) ^ seed);
+            b = TOps::mum(TOps::read64(p + len - 16) ^ HashSecret2, TOps::read64(p + len - 8) ^ seed);
+        } else if (len >= 4) {
+            const size_t shift = (len >> 3) << 2;
+            a = (TOps::read32(p) << 32) | TOps::read32(p + shift);
+            b = (TOps::read32(p + len - 4) << 32) | TOps::read32(p + len - 4 - shift);
+        } else if (len > 0) {
+            a = (static_cast<uint64_t>(static_cast<uint8_t>(p[0])) << 16) |
+                (static_cast<uint64_t>(static_cast<uint8_t>(p[len >> 1])) << 8) | static_cast<uint8_t>(p[len - 1]);
+        }
+        return TOps::mum(TOps::mum(a ^ HashSecret1, b ^ seed) ^ HashSecret0 ^ len, seed ^ HashSecret1);
+    }
+
+    template <class TOps, class TByte>
+    constexpr void hashBlock(const TByte *p, uint64_t &lane0, uint64_t &lane1) {
+        lane0 = TOps::mum(TOps::read64(p) ^ HashSecret1, TOps::read64(p + 8) ^ lane0);
+        lane1 = TOps::mum(TOps::read64(p + 16) ^ HashSecret2, TOps::read64(p + 24) ^ lane1);
+    }
+
+    template <class TOps>
+    constexpr HashId hashFinish(uint64_t lane0, uint64_t lane1, uint64_t len) {
+        return TOps::mum(TOps::mum(lane0 ^ HashSecret0 ^ len, lane1 ^ HashSecret3), HashSecret1 ^ len);
+    }
+
+} // namespace Details
+
+/// @brief  Computes a fast 64-bit hash for a byte buffer in the style of wyhash.
+/// @param  buffer  [in] The buffer.
+/// @param  len     [in] The buffer size in bytes.
+/// @param  seed    [in] The seed, different seeds give independent hash functions.
+/// @return The full 64-bit hash value, not reduced to any table size.
+/// @remark Keys up to 32 bytes are hashed without a loop, longer ones in blocks of 32 bytes
+///         with two independent multiply chains. Not suitable for cryptographic use.
+inline HashId hash64(const void *buffer, size_t len, HashId seed = 0) {
+    using Ops = Details::HashRuntimeOps;
+    const uint8_t *p = static_cast<const uint8_t *>(buffer);
+    const uint64_t s = Details::hashSeed<Ops>(seed);
+    if (len <= Details::HashBlockSize) {
+        return Details::hashShort<Ops>(p, len, s);
+    }
+
+    uint64_t lane0 = s, lane1 = s ^ Details::HashSecret2;
+    size_t i = 0;
+    for (; i + Details::HashBlockSize <= len; i += Details::HashBlockSize) {
+        Details::hashBlock<Ops>(p + i, lane0, lane1);
+    }
+    if (i < len) {
+        uint8_t tail[Details::HashBlockSize] = {};
+        ::memcpy(tail, p + i, len - i);
+        Details::hashBlock<Ops>(tail, lane0, lane1);
+    }
+
+    return Details::hashFinish<Ops>(lane0, lane1, len);
+}
+
+/// @brief  Computes hash64 of a string at compile time.
+/// @param  str     [in] The string.
+/// @param  len     [in] The string length.
+/// @param  seed    [in] The seed, see hash64.
+/// @return The hash value, the same as hash64 of the same bytes at runtime.
+constexpr HashId constHash(const char *str, size_t len, HashId seed = 0) {
+    using Ops = Details::HashConstOps;
+    const uint64_t s = Details::hashSeed<Ops>(seed);
+    if (len <= Details::HashBlockSize) {
+        return Details::hashShort<Ops>(str, len, s);
+    }
+
+    uint64_t lane0 = s, lane1 = s ^ Details::HashSecret2;
+    size_t i = 0;
+    for (; i + Details::HashBlockSize <= len; i += Details::HashBlockSize) {
+        Details::hashBlock<Ops>(str + i, lane0, lane1);
+    }
+    if (i < len) {
+        char tail[Details::HashBlockSize] = {};
+        for (size_t j = 0; i + j < len; ++j) {
+            tail[j] = str[i + j];
+        }
+        Details::hashBlock<Ops>(tail, lane0, lane1);
+    }
+
+    return Details::hashFinish<Ops>(lane0, lane1, len);
+}
+
+/// @brief  Computes hash64 of a zero-terminated string at compile time.
+/// @param  str     [in] The string.
+/// @return The hash value, the same as hash64 of the same bytes at runtime.
+constexpr HashId constHash(const char *str) {
+    size_t len = 0;
+    while (str[len] != '\0') {
+        ++len;
+    }
+
+    return constHash(str, len);
+}
+
+/// @brief  The hash literal, "name"_hash is the compile time constant of constHash("name").
+/// @code
+/// switch (constHash(eventName)) {
+///     case "keyDown"_hash: ...
+/// }
+/// @endcode
+constexpr HashId operator""_hash(const char *str, size_t len) {
+    return constHash(str, len);
+}
+
+//-------------------------------------------------------------------------------------------------
+///	@class		Hasher64
+///	@ingroup	CPPCore
+///
+///	@brief  Computes hash64 incrementally for data which is not available as one buffer.
+///
+/// The result is the same as hash64 of all data in one buffer, independent of the chunk sizes.
+/// @code
+/// Hasher64 hasher;
+/// hasher.update(header, headerSize);
+/// hasher.update(payload, payloadSize);
+/// HashId hash = hasher.finish();
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+class Hasher64 {
+public:
+    /// @brief  The class constructor.
+    /// @param  seed    [in] The seed, see hash64.
+    explicit Hasher64(HashId seed = 0);
+
+    /// @brief  Will restart the hashing.
+    /// @param  seed    [in] The seed, see hash64.
+    void reset(HashId seed = 0);
+
+    /// @brief  Will add data.
+    /// @param  buffer  [in] The data.
+    /// @param  len     [in] The data size in bytes.
+    void update(const void *buffer, size_t len);
+
+    /// @brief  Will return the hash of all data added so far, more data can be added afterwards.
+    /// @return The full 64-bit hash value.
+    HashId finish() const;
+
+private:
+    uint64_t mSeed;
+    uint64_t mLane0;
+    uint64_t mLane1;
+    uint64_t mTotalLen;
+    // The pending block, it will be processed when more data follows
+    uint8_t mBuffer[Details::HashBlockSize];
+    size_t mBufferLen;
+};
+
+inline Hasher64::Hasher64(HashId seed) {
+    reset(seed);
+}
+
+inline void Hasher64::reset(HashId seed) {
+    mSeed = Details::hashSeed<Details::HashRuntimeOps>(seed);
+    mLane0 = mSeed;
+    mLane1 = mSeed ^ Details::HashSecret2;
+    mTotalLen = 0;
+    mBufferLen = 0;
+}
+
+inline void Hasher64::update(const void *buffer, size_t len) {
+    const uint8_t *p = static_cast<const uint8_t *>(buffer);
+    mTotalLen += len;
+    if (mBufferLen + len <= Details::HashBlockSize) {
+        ::memcpy(mBuffer + mBufferLen, p, len);
+        mBufferLen += len;
+        return;
+    }
+
+    // Complete the pending block, more data follows so it is not the last one
+    const size_t fill = Details::HashBlockSize - mBufferLen;
+    ::memcpy(mBuffer + mBufferLen, p, fill);
+    Details::hashBlock<Details::HashRuntimeOps>(mBuffer, mLane0, mLane1);
+    p += fill;
+    len -= fill;
+
+    // The last block is kept back, a short key must be hashed as a whole by finish
+    while (len > Details::HashBlockSize) {
+        Details::hashBlock<Details::HashRuntimeOps>(p, mLane0, mLane1);
+        p += Details::HashBlockSize;
+        len -= Details::HashBlockSize;
+    }
+    ::memcpy(mBuffer, p, len);
+    mBufferLen = len;
+}
+
+inline HashId Hasher64::finish() const {
+    if (mTotalLen <= Details::HashBlockSize) {
+        return Details::hashShort<Details::HashRuntimeOps>(mBuffer, static_cast<size_t>(mTotalLen), mSeed);
+    }
+
+    uint64_t lane0 = mLane0, lane1 = mLane1;
+    uint8_t tail[Details::HashBlockSize] = {};
+    ::memcpy(tail, mBuffer, mBufferLen);
+    Details::hashBlock<Details::HashRuntimeOps>(tail, lane0, lane1);
+    return Details::hashFinish<Details::HashRuntimeOps>(lane0, lane1, mTotalLen);
+}
+
 //-------------------------------------------------------------------------------------------------
 ///	@class		THash
 ///	@ingroup	CPPCore
@@ -99,7 +440,8 @@ inline T THash<T>::toHash(const char *buffer, T base) {
 
     // using division-rest method
     // see http://de.wikipedia.org/wiki/Divisionsrestmethode
-    for (size_t i = 0; i < strlen(buffer); ++i) {
+    const size_t len = strlen(buffer);
+    for (size_t i = 0; i < len; ++i) {
         hash = (hash * 128 + buffer[i]) % base;
     }
 
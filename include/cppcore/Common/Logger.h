@@ -28,8 +28,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace cppcore {
 
-/// @brief  The default log tag, used for all log messages if no other tag is specified.
-#define DECL_LOG_MODULE(name) static constexpr char Tag[] = #name;
+/// @brief  The default log tag, used for all log messages if no other tag is specified. TagId is
+///         the hash of the tag, computed at compile time, use it to compare domains as integers.
+#define DECL_LOG_MODULE(name) \
+    static constexpr char Tag[] = #name; \
+    static constexpr ::cppcore::HashId TagId = ::cppcore::constHash(#name);
 
 using String = TStringBase<char>;
 
@@ -0,0 +1,101 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/TStringView.h>
+
+namespace cppcore {
+
+/// @brief  The buffer size which fits any integer formatted by formatInt, including the zero.
+static constexpr size_t MaxIntChars = 21;
+
+/// @brief  The buffer size which fits any number formatted by formatFloat, including the zero.
+static constexpr size_t MaxFloatChars = 25;
+
+/// @brief  Parses a decimal integer at the start of a view, an optional sign is accepted.
+/// @param  str     [in] The view, whitespaces will not be skipped.
+/// @param  value   [out] The parsed value, will not be changed on failure.
+/// @return The number of parsed chars, 0 for no number or an overflow. The whole view was a number,
+///         if it is equal to the view size.
+/// @code
+/// int64_t value = 0;
+/// if (parseInt(field, value) == field.size()) {
+///     ...
+/// }
+/// @endcode
+DLL_CPPCORE_EXPORT size_t parseInt(const TStringView<char> &str, int64_t &value);
+
+/// @brief  Parses a decimal integer at the start of a view, see the int64_t version.
+DLL_CPPCORE_EXPORT size_t parseInt(const TStringView<char> &str, int32_t &value);
+
+/// @brief  Parses an unsigned decimal integer at the start of a view, see the int64_t version.
+DLL_CPPCORE_EXPORT size_t parseInt(const TStringView<char> &str, uint64_t &value);
+
+/// @brief  Parses an unsigned decimal integer at the start of a view, see the int64_t version.
+DLL_CPPCORE_EXPORT size_t parseInt(const TStringView<char> &str, uint32_t &value);
+
+/// @brief  Parses a floating point number at the start of a view.
+/// @param  str     [in] The view, whitespaces will not be skipped.
+/// @param  value   [out] The correctly rounded value, will not be changed on failure.
+/// @return The number of parsed chars, 0 for no number.
+/// @remark Accepts the format of strtod without hex floats, independent from the locale. The
+///         Eisel-Lemire algorithm will find the result for almost all inputs, strtod is only used
+///         as a fallback for rare halfway cases.
+DLL_CPPCORE_EXPORT size_t parseFloat(const TStringView<char> &str, double &value);
+
+/// @brief  Parses a floating point number at the start of a view, see the double version.
+DLL_CPPCORE_EXPORT size_t parseFloat(const TStringView<char> &str, float &value);
+
+/// @brief  Formats an integer in decimal notation.
+/// @param  value   [in] The value.
+/// @param  buffer  [out] The target buffer, a zero will be appended.
+/// @param  size    [in] The buffer size, MaxIntChars will always be enough.
+/// @return The number of chars without the zero, 0 if the buffer is too small.
+DLL_CPPCORE_EXPORT size_t formatInt(int64_t value, char *buffer, size_t size);
+
+/// @brief  Formats an integer in decimal notation, see the int64_t version.
+DLL_CPPCORE_EXPORT size_t formatInt(int32_t value, char *buffer, size_t size);
+
+/// @brief  Formats an integer in decimal notation, see the int64_t version.
+DLL_CPPCORE_EXPORT size_t formatInt(uint64_t value, char *buffer, size_t size);
+
+/// @brief  Formats an integer in decimal notation, see the int64_t version.
+DLL_CPPCORE_EXPORT size_t formatInt(uint32_t value, char *buffer, size_t size);
+
+/// @brief  Formats a floating point number with the shortest digits which will be parsed back to
+///         the same value.
+/// @param  value   [in] The value.
+/// @param  buffer  [out] The target buffer, a zero will be appended.
+/// @param  size    [in] The buffer size, MaxFloatChars will always be enough.
+/// @return The number of chars without the zero, 0 if the buffer is too small.
+/// @remark Uses the Schubfach algorithm. Decimal exponents in [-5, 16] are written in fixed
+///         notation like 0.001 or 1500, others in scientific notation like 1e+20. nan and inf
+///         are written as nan, inf and -inf.
+DLL_CPPCORE_EXPORT size_t formatFloat(double value, char *buffer, size_t size);
+
+/// @brief  Formats a floating point number with the shortest digits which will be parsed back to
+///         the same float value, see the double version.
+DLL_CPPCORE_EXPORT size_t formatFloat(float value, char *buffer, size_t size);
+
+} // namespace cppcore
@@ -23,6 +23,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/ThreadPool.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
 
 namespace cppcore {
 
@@ -131,20 +137,817 @@ namespace cppcore {
         quicksortImpl(pivot, _data, num, stride, func);
     }
 
+    /// @brief Compares two values with operator <, the default for the sort templates.
+    /// @tparam T The type of the value
+    template <class T>
+    struct TLess {
+        /// @brief Returns true, if lhs is lower than rhs.
+        bool operator()(const T &lhs, const T &rhs) const {
+            return lhs < rhs;
+        }
+    };
+
+    namespace Details {
+
+        /// @brief Partitions up to this size will be sorted by insertion sort.
+        static constexpr size_t InsertionSortThreshold = 16;
+
+        template <class T, class TCompare>
+        inline void insertionSort(T *data, size_t num, TCompare &comp) {
+            for (size_t i = 1; i < num; ++i) {
+                if (!comp(data[i], data[i - 1])) {
+                    continue;
+                }
+                T value = std::move(data[i]);
+                size_t j = i;
+                do {
+                    data[j] = std::move(data[j - 1]);
+                    --j;
+                } while (j > 0 && comp(value, data[j - 1]));
+                data[j] = std::move(value);
+            }
+        }
+
+        template <class T, class TCompare>
+        inline void siftDown(T *data, size_t root, size_t num, TCompare &comp) {
+            T value = std::move(data[root]);
+            size_t child = 2 * root + 1;
+            while (child < num) {
+                if (child + 1 < num && comp(data[child], data[child + 1])) {
+                    ++child;
+                }
+                if (!comp(value, data[child])) {
+                    break;
+                }
+                data[root] = std::move(data[child]);
+                root = child;
+                child = 2 * root + 1;
+            }
+            data[root] = std::move(value);
+        }
+
+        template <class T, class TCompare>
+        inline void makeHeap(T *data, size_t num, TCompare &comp) {
+            for (size_t i = num / 2; i > 0; --i) {
+                siftDown(data, i - 1, num, comp);
+            }
+        }
+
+        template <class T, class TCompare>
+        inline void sortHeap(T *data, size_t num, TCompare &comp) {
+            for (size_t i = num; i > 1; --i) {
+                std::swap(data[0], data[i - 1]);
+                siftDown(data, 0, i - 1, comp);
+            }
+        }
+
+        template <class T, class TCompare>
+        inline void heapSort(T *data, size_t num, TCompare &comp) {
+            makeHeap(data, num, comp);
+            sortHeap(data, num, comp);
+        }
+
+        // Moves the k lowest elements into a max-heap at the front.
+        template <class T, class TCompare>
+        inline void heapSelect(T *data, size_t num, size_t k, TCompare &comp) {
+            makeHeap(data, k, comp);
+            for (size_t i = k; i < num; ++i) {
+                if (comp(data[i], data[0])) {
+                    std::swap(data[i], data[0]);
+                    siftDown(data, 0, k, comp);
+                }
+            }
+        }
+
+        // Moves the median of a, b and c to result.
+        template <class T, class TCompare>
+        inline void moveMedianToFirst(T *result, T *a, T *b, T *c, TCompare &comp) {
+            if (comp(*a, *b)) {
+                if (comp(*b, *c)) {
+                    std::swap(*result, *b);
+                } else if (comp(*a, *c)) {
+                    std::swap(*result, *c);
+                } else {
+                    std::swap(*result, *a);
+                }
+            } else if (comp(*a, *c)) {
+                std::swap(*result, *a);
+            } else if (comp(*b, *c)) {
+                std::swap(*result, *c);
+            } else {
+                std::swap(*result, *b);
+            }
+        }
+
+        // The pivot is data[0], the median of three guarantees sentinels on both sides, so the
+        // inner loops need no bounds checks.
+        template <class T, class TCompare>
+        inline size_t partitionUnguarded(T *data, size_t num, TCompare &comp) {
+            T *lo = data + 1;
+            T *hi = data + num;
+            for (;;) {
+                while (comp(*lo, *data)) {
+                    ++lo;
+                }
+                --hi;
+                while (comp(*data, *hi)) {
+                    --hi;
+                }
+                if (!(lo < hi)) {
+                    return static_cast<size_t>(lo - data);
+                }
+                std::swap(*lo, *hi);
+                ++lo;
+            }
+        }
+
+        template <class T, class TCompare>
+        inline void introsortLoop(T *data, size_t num, size_t depthLimit, TCompare &comp) {
+            while (num > InsertionSortThreshold) {
+                if (depthLimit == 0) {
+                    // Too many bad pivots, the input is adversarial
+                    heapSort(data, num, comp);
+                    return;
+                }
+                --depthLimit;
+
+                moveMedianToFirst(data, data + 1, data + num / 2, data + num - 1, comp);
+                const size_t cut = partitionUnguarded(data, num, comp);
+
+                // Recurse into the smaller part to bound the stack depth
+                if (cut < num - cut) {
+                    introsortLoop(data, cut, depthLimit, comp);
+                    data += cut;
+                    num -= cut;
+                } else {
+                    introsortLoop(data + cut, num - cut, depthLimit, comp);
+                    num = cut;
+                }
+            }
+            insertionSort(data, num, comp);
+        }
+
+        inline size_t log2Floor(size_t num) {
+            size_t result = 0;
+            while (num > 1) {
+                num >>= 1;
+                ++result;
+            }
+            return result;
+        }
+
+    } // namespace Details
+
+    namespace Details {
+
+        /// @brief The maximum number of elements for sortNetwork.
+        static constexpr size_t SortNetworkMaxSize = 32;
+
+    } // namespace Details
+
+    /// @brief Sorts up to 32 int32 values with a SIMD sorting network.
+    /// @param data     The data to sort
+    /// @param num      The number of elements, must not be bigger than SortNetworkMaxSize
+    /// @remark Falls back to insertion sort, when the CPU does not support SSE4.2.
+    DLL_CPPCORE_EXPORT void sortNetwork(int32_t *data, size_t num);
+
+    /// @brief Sorts up to 32 float values with a SIMD sorting network.
+    /// @param data     The data to sort
+    /// @param num      The number of elements, must not be bigger than SortNetworkMaxSize
+    /// @remark -0 is ordered before +0, NaNs will be kept but have no defined position.
+    DLL_CPPCORE_EXPORT void sortNetwork(float *data, size_t num);
+
+    namespace Details {
+
+        // The generic version returns false, the overloads below use the sorting networks for
+        // the default order of int32 and float.
+        template <class T, class TCompare>
+        inline bool sortSmall(T *, size_t, TCompare &) {
+            return false;
+        }
+
+        inline bool sortSmall(int32_t *data, size_t num, TLess<int32_t> &) {
+            sortNetwork(data, num);
+            return true;
+        }
+
+        inline bool sortSmall(float *data, size_t num, TLess<float> &) {
+            sortNetwork(data, num);
+            return true;
+        }
+
+    } // namespace Details
+
+    /// @brief Sorts the data with introsort: quicksort with median-of-three pivots, insertion sort
+    ///        for small partitions and heapsort, when the recursion gets too deep.
+    /// @tparam T           The type of the value
+    /// @tparam TCompare    The compare type, returns true if the first value is lower
+    /// @param data     The data to sort
+    /// @param num      The number of elements to sort
+    /// @param comp     The compare function
+    /// @remark The sort is not stable. In contrast to quicksort the compare will be inlined.
+    ///         Up to 32 int32 or float values in the default order will be sorted by sortNetwork.
+    template <class T, class TCompare = TLess<T>>
+    inline void sort(T *data, size_t num, TCompare comp = TCompare()) {
+        if (data == nullptr || num < 2) {
+            return;
+        }
+        if (num >= 4 && num <= Details::SortNetworkMaxSize && Details::sortSmall(data, num, comp)) {
+            return;
+        }
+        Details::introsortLoop(data, num, 2 * Details::log2Floor(num), comp);
+    }
+
+    /// @brief Reorders the data, so the k lowest elements are sorted at the front.
+    /// @tparam T           The type of the value
+    /// @tparam TCompare    The compare type, returns true if the first value is lower
+    /// @param data     The data
+    /// @param num      The number of elements
+    /// @param k        The number of elements to sort
+    /// @param comp     The compare function
+    /// @remark Runs in O(num * log(k)), the order of the other elements is unspecified.
+    template <class T, class TCompare = TLess<T>>
+    inline void partialSort(T *data, size_t num, size_t k, TCompare comp = TCompare()) {
+        if (k > num) {
+            k = num;
+        }
+        if (k == 0) {
+            return;
+        }
+        Details::heapSelect(data, num, k, comp);
+        Details::sortHeap(data, k, comp);
+    }
+
+    /// @brief Reorders the data, so the element at index n is the one which would be there after
+    ///        sorting. No element before it is greater, no element behind it is lower.
+    /// @tparam T           The type of the value
+    /// @tparam TCompare    The compare type, returns true if the first value is lower
+    /// @param data     The data
+    /// @param num      The number of elements
+    /// @param n        The index of the element to select
+    /// @param comp     The compare function
+    /// @remark Implements introselect, O(num) on average and never worse than O(num * log(num)).
+    template <class T, class TCompare = TLess<T>>
+    inline void nthElement(T *data, size_t num, size_t n, TCompare comp = TCompare()) {
+        if (n >= num) {
+            return;
+        }
+
+        T *first = data;
+        T *last = data + num;
+        T *nth = data + n;
+        size_t depthLimit = 2 * Details::log2Floor(num);
+        while (last - first > 3) {
+            const size_t size = static_cast<size_t>(last - first);
+            if (depthLimit == 0) {
+                Details::heapSelect(first, size, static_cast<size_t>(nth - first) + 1, comp);
+                std::swap(*first, *nth);
+                return;
+            }
+            --depthLimit;
+
+            Details::moveMedianToFirst(first, first + 1, first + size / 2, last - 1, comp);
+            T *cut = first + Details::partitionUnguarded(first, size, comp);
+            if (cut <= nth) {
+                first = cut;
+            } else {
+                last = cut;
+            }
+        }
+        Details::insertionSort(first, static_cast<size_t>(last - first), comp);
+    }
+
+    namespace Details {
+
+        /// @brief Shorter runs will be extended by insertion sort.
+        static constexpr size_t MinMerge = 64;
+
+        /// @brief The maximal number of pending runs, enough for 2^64 elements.
+        static constexpr size_t MaxMergeRuns = 85;
+
+        inline size_t minRunLength(size_t num) {
+            size_t rest = 0;
+            while (num >= MinMerge) {
+                rest |= num & 1;
+                num >>= 1;
+            }
+            return num + rest;
+        }
+
+        template <class T>
+        inline void reverse(T *data, size_t num) {
+            for (size_t i = 0, j = num; i + 1 < j; ++i, --j) {
+                std::swap(data[i], data[j - 1]);
+            }
+        }
+
+        // Returns the length of the run at the front, a strictly descending run will be reversed.
+        // Strictly, so the reversal cannot change the order of equal elements.
+        template <class T, class TCompare>
+        inline size_t countRunAndMakeAscending(T *data, size_t num, TCompare &comp) {
+            if (num < 2) {
+                return num;
+            }
+            size_t runEnd = 2;
+            if (comp(data[1], data[0])) {
+                while (runEnd < num && comp(data[runEnd], data[runEnd - 1])) {
+                    ++runEnd;
+                }
+                reverse(data, runEnd);
+            } else {
+                while (runEnd < num && !comp(data[runEnd], data[runEnd - 1])) {
+                    ++runEnd;
+                }
+            }
+            return runEnd;
+        }
+
+        // Returns the first index in [0, num) with comp(value, data[i]).
+        template <class T, class TCompare>
+        inline size_t upperBound(const T *data, size_t num, const T &value, TCompare &comp) {
+            size_t lo = 0;
+            while (num > 0) {
+                const size_t half = num / 2;
+                if (comp(value, data[lo + half])) {
+                    num = half;
+                } else {
+                    lo += half + 1;
+                    num -= half + 1;
+                }
+            }
+            return lo;
+        }
+
+        // Returns the first index in [0, num) with !comp(data[i], value).
+        template <class T, class TCompare>
+        inline size_t lowerBound(const T *data, size_t num, const T &value, TCompare &comp) {
+            size_t lo = 0;
+            while (num > 0) {
+                const size_t half = num / 2;
+                if (comp(data[lo + half], value)) {
+                    lo += half + 1;
+                    num -= half + 1;
+                } else {
+                    num = half;
+                }
+            }
+            return lo;
+        }
+
+        // Stable insertion sort, the first sorted elements are already in order.
+        template <class T, class TCompare>
+        inline void binaryInsertionSort(T *data, size_t num, size_t sorted, TCompare &comp) {
+            for (size_t i = sorted < 1 ? 1 : sorted; i < num; ++i) {
+                const size_t pos = Details::upperBound(data, i, data[i], comp);
+                if (pos == i) {
+                    continue;
+                }
+                T value = std::move(data[i]);
+                for (size_t j = i; j > pos; --j) {
+                    data[j] = std::move(data[j - 1]);
+                }
+                data[pos] = std::move(value);
+            }
+        }
+
+        // Merges the sorted runs [0, mid) and [mid, num), the smaller one is moved to the buffer.
+        template <class T, class TCompare>
+        inline void mergeRuns(T *data, size_t mid, size_t num, T *buffer, TCompare &comp) {
+            if (!comp(data[mid], data[mid - 1])) {
+                return;
+            }
+
+            // Elements of the left run lower than the right run and elements of the right run
+            // greater than the left run are in place already
+            const size_t first = Details::upperBound(data, mid, data[mid], comp);
+            const size_t last = mid + Details::lowerBound(data + mid, num - mid, data[mid - 1], comp);
+            T *left = data + first;
+            T *right = data + mid;
+            const size_t numLeft = mid - first;
+            const size_t numRight = last - mid;
+
+            if (numLeft <= numRight) {
+                for (size_t i = 0; i < numLeft; ++i) {
+                    buffer[i] = std::move(left[i]);
+                }
+                size_t i = 0, j = 0;
+                T *out = left;
+                while (i < numLeft && j < numRight) {
+                    // Ties take the left element to stay stable
+                    if (comp(right[j], buffer[i])) {
+                        *out++ = std::move(right[j++]);
+                    } else {
+                        *out++ = std::move(buffer[i++]);
+                    }
+                }
+                while (i < numLeft) {
+                    *out++ = std::move(buffer[i++]);
+                }
+            } else {
+                for (size_t j = 0; j < numRight; ++j) {
+                    buffer[j] = std::move(right[j]);
+                }
+                size_t i = numLeft, j = numRight;
+                T *out = data + last;
+                while (i > 0 && j > 0) {
+                    if (comp(buffer[j - 1], left[i - 1])) {
+                        *--out = std::move(left[--i]);
+                    } else {
+                        *--out = std::move(buffer[--j]);
+                    }
+                }
+                while (j > 0) {
+                    *--out = std::move(buffer[--j]);
+                }
+            }
+        }
+
+        template <class T, class TCompare>
+        struct TMergeState {
+            T *data;
+            T *buffer;
+            TCompare &comp;
+            size_t runBase[MaxMergeRuns];
+            size_t runLength[MaxMergeRuns];
+            size_t numRuns;
+
+            void mergeAt(size_t idx) {
+                const size_t base = runBase[idx];
+                const size_t mid = runLength[idx];
+                const size_t num = mid + runLength[idx + 1];
+                mergeRuns(data + base, mid, num, buffer, comp);
+                runLength[idx] = num;
+                for (size_t i = idx + 1; i + 1 < numRuns; ++i) {
+                    runBase[i] = runBase[i + 1];
+                    runLength[i] = runLength[i + 1];
+                }
+                --numRuns;
+            }
+
+            // Keeps the run lengths growing like the Fibonacci numbers, so merges stay balanced
+            void mergeCollapse() {
+                while (numRuns > 1) {
+                    size_t idx = numRuns - 2;
+                    if ((idx > 0 && runLength[idx - 1] <= runLength[idx] + runLength[idx + 1]) ||
+                            (idx > 1 && runLength[idx - 2] <= runLength[idx - 1] + runLength[idx])) {
+                        if (runLength[idx - 1] < runLength[idx + 1]) {
+                            --idx;
+                        }
+                        mergeAt(idx);
+                    } else if (runLength[idx] <= runLength[idx + 1]) {
+                        mergeAt(idx);
+                    } else {
+                        break;
+                    }
+                }
+            }
+
+            void mergeForceCollapse() {
+                while (numRuns > 1) {
+                    size_t idx = numRuns - 2;
+                    if (idx > 0 && runLength[idx - 1] < runLength[idx + 1]) {
+                        --idx;
+                    }
+                    mergeAt(idx);
+                }
+            }
+        };
+
+    } // namespace Details
+
+    /// @brief Sorts the data stable with an adaptive merge sort in the style of Timsort.
+    /// @tparam T           The type of the value
+    /// @tparam TCompare    The compare type, returns true if the first value is lower
+    /// @param data     The data to sort
+    /// @param num      The number of elements to sort
+    /// @param buffer   A buffer for num / 2 elements, used for merging
+    /// @param comp     The compare function
+    /// @remark Existing ascending and strictly descending runs will be used, so presorted data
+    ///         will be sorted in O(num). Equal elements keep their order.
+    template <class T, class TCompare = TLess<T>>
+    inline void stableSort(T *data, size_t num, T *buffer, TCompare comp = TCompare()) {
+        if (data == nullptr || num < 2) {
+            return;
+        }
+
+        if (num < Details::MinMerge) {
+            const size_t runLength = Details::countRunAndMakeAscending(data, num, comp);
+            Details::binaryInsertionSort(data, num, runLength, comp);
+            return;
+        }
+
+        assert(buffer != nullptr);
+        Details::TMergeState<T, TCompare> state{ data, buffer, comp, {}, {}, 0 };
+        const size_t minRun = Details::minRunLength(num);
+        size_t base = 0;
+        while (base < num) {
+            const size_t rest = num - base;
+            size_t runLength = Details::countRunAndMakeAscending(data + base, rest, comp);
+            if (runLength < minRun) {
+                const size_t forced = rest < minRun ? rest : minRun;
+                Details::binaryInsertionSort(data + base, forced, runLength, comp);
+                runLength = forced;
+            }
+
+            state.runBase[state.numRuns] = base;
+            state.runLength[state.numRuns] = runLength;
+            ++state.numRuns;
+            state.mergeCollapse();
+            base += runLength;
+        }
+        state.mergeForceCollapse();
+    }
+
+    namespace Details {
+
+        /// @brief Below this number of elements the parallel sorts will sort sequentially.
+        static constexpr size_t ParallelSortThreshold = 1 << 15;
+
+        inline size_t chunkOffset(size_t chunk, size_t numChunks, size_t num) {
+            return num / numChunks * chunk + (chunk < num % numChunks ? chunk : num % numChunks);
+        }
+
+        // Returns the number of elements from left in the first d merged elements. Equal
+        // elements are taken from left first, like the sequential merge does.
+        template <class T, class TCompare>
+        inline size_t mergeCoRank(size_t d, const T *left, size_t numLeft, const T *right, size_t numRight, TCompare &comp) {
+            size_t lo = d > numRight ? d - numRight : 0;
+            size_t hi = d < numLeft ? d : numLeft;
+            while (lo < hi) {
+                const size_t i = lo + (hi - lo) / 2;
+                const size_t j = d - i;
+                if (j > 0 && i < numLeft && !comp(right[j - 1], left[i])) {
+                    lo = i + 1;
+                } else {
+                    hi = i;
+                }
+            }
+            return lo;
+        }
+
+        // Merges the output range [first, last) of two sorted runs into dst.
+        template <class T, class TCompare>
+        inline void mergeSegment(T *left, size_t numLeft, T *right, size_t numRight, T *dst,
+                size_t first, size_t last, TCompare &comp) {
+            size_t i = mergeCoRank(first, left, numLeft, right, numRight, comp);
+            size_t j = first - i;
+            const size_t iEnd = mergeCoRank(last, left, numLeft, right, numRight, comp);
+            const size_t jEnd = last - iEnd;
+            T *out = dst + first;
+            while (i < iEnd && j < jEnd) {
+                if (comp(right[j], left[i])) {
+                    *out++ = std::move(right[j++]);
+                } else {
+                    *out++ = std::move(left[i++]);
+                }
+            }
+            while (i < iEnd) {
+                *out++ = std::move(left[i++]);
+            }
+            while (j < jEnd) {
+                *out++ = std::move(right[j++]);
+            }
+        }
+
+        // Sorts the chunks in parallel, then merges pairs of runs. Each merge is split by the
+        // output position, so all threads stay busy in the last rounds as well.
+        template <class T, class TCompare, class TChunkSort>
+        inline void parallelMergeSort(T *data, size_t num, T *buffer, TCompare &comp, ThreadPool &pool, TChunkSort chunkSort) {
+            const size_t numChunks = pool.getNumThreads() + 1;
+            if (num < ParallelSortThreshold || numChunks == 1) {
+                chunkSort(data, num, buffer);
+                return;
+            }
+
+            pool.parallelFor(0, numChunks, 1, [&](size_t firstChunk, size_t lastChunk) {
+                for (size_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+                    const size_t first = chunkOffset(chunk, numChunks, num);
+                    const size_t last = chunkOffset(chunk + 1, numChunks, num);
+                    chunkSort(data + first, last - first, buffer + first);
+                }
+            });
+
+            T *src = data;
+            T *dst = buffer;
+            for (size_t width = 1; width < numChunks; width *= 2) {
+                const size_t numPairs = (numChunks + 2 * width - 1) / (2 * width);
+                const size_t segmentsPerPair = numChunks / numPairs > 0 ? numChunks / numPairs : 1;
+                pool.parallelFor(0, numPairs * segmentsPerPair, 1, [&](size_t firstTask, size_t lastTask) {
+                    for (size_t task = firstTask; task < lastTask; ++task) {
+                        const size_t pair = task / segmentsPerPair;
+                        const size_t segment = task % segmentsPerPair;
+                        const size_t lo = chunkOffset(std::min(pair * 2 * width, numChunks), numChunks, num);
+                        const size_t mid = chunkOffset(std::min(pair * 2 * width + width, numChunks), numChunks, num);
+                        const size_t hi = chunkOffset(std::min(pair * 2 * width + 2 * width, numChunks), numChunks, num);
+                        const size_t total = hi - lo;
+                        mergeSegment(src + lo, mid - lo, src + mid, hi - mid, dst + lo,
+                                chunkOffset(segment, segmentsPerPair, total), chunkOffset(segment + 1, segmentsPerPair, total), comp);
+                    }
+                });
+                std::swap(src, dst);
+            }
+
+            if (src != data) {
+                pool.parallelFor(0, num, 0, [src, data](size_t first, size_t last) {
+                    for (size_t i = first; i < last; ++i) {
+                        data[i] = std::move(src[i]);
+                    }
+                });
+            }
+        }
+
+    } // namespace Details
+
+    /// @brief Sorts the data on a thread pool, the chunks are sorted by introsort and merged in
+    ///        parallel afterwards.
+    /// @tparam T           The type of the value
+    /// @tparam TCompare    The compare type, returns true if the first value is lower
+    /// @param data     The data to sort
+    /// @param num      The number of elements to sort
+    /// @param buffer   A buffer for num elements
+    /// @param comp     The compare function, must not throw
+    /// @param pool     The thread pool, nullptr for the default pool
+    /// @remark Small inputs will be sorted sequentially. The sort is not stable.
+    template <class T, class TCompare = TLess<T>>
+    inline void parallelSort(T *data, size_t num, T *buffer, TCompare comp = TCompare(), ThreadPool *pool = nullptr) {
+        if (data == nullptr || num < 2) {
+            return;
+        }
+        assert(buffer != nullptr);
+        Details::parallelMergeSort(data, num, buffer, comp, pool != nullptr ? *pool : ThreadPool::getDefault(),
+                [&comp](T *chunk, size_t chunkSize, T *) {
+                    sort(chunk, chunkSize, comp);
+                });
+    }
+
+    /// @brief Sorts the data stable on a thread pool.
+    /// @tparam T           The type of the value
+    /// @tparam TCompare    The compare type, returns true if the first value is lower
+    /// @param data     The data to sort
+    /// @param num      The number of elements to sort
+    /// @param buffer   A buffer for num elements
+    /// @param comp     The compare function, must not throw
+    /// @param pool     The thread pool, nullptr for the default pool
+    /// @remark Equal elements keep their order, so the result does not depend on the number of
+    ///         threads.
+    template <class T, class TCompare = TLess<T>>
+    inline void parallelStableSort(T *data, size_t num, T *buffer, TCompare comp = TCompare(), ThreadPool *pool = nullptr) {
+        if (data == nullptr || num < 2) {
+            return;
+        }
+        assert(buffer != nullptr);
+        Details::parallelMergeSort(data, num, buffer, comp, pool != nullptr ? *pool : ThreadPool::getDefault(),
+                [&comp](T *chunk, size_t chunkSize, T *chunkBuffer) {
+                    stableSort(chunk, chunkSize, chunkBuffer, comp);
+                });
+    }
+
+    namespace Details {
+
+        /// @brief The number of buckets per radix sort pass, one byte per pass.
+        static constexpr size_t RadixBuckets = 256;
+
+        /// @brief Maps the keys to unsigned integers with the same order.
+        template <class TKey, class TEnable = void>
+        struct RadixTraits;
+
+        template <class TKey>
+        struct RadixTraits<TKey, typename std::enable_if<std::is_integral<TKey>::value && std::is_unsigned<TKey>::value>::type> {
+            using Bits = TKey;
+            static Bits toBits(TKey key) {
+                return key;
+            }
+        };
+
+        // Flipping the sign bit moves the negative values in front of the positive ones
+        template <class TKey>
+        struct RadixTraits<TKey, typename std::enable_if<std::is_integral<TKey>::value && std::is_signed<TKey>::value>::type> {
+            using Bits = typename std::make_unsigned<TKey>::type;
+            static Bits toBits(TKey key) {
+                return static_cast<Bits>(static_cast<Bits>(key) ^ (Bits(1) << (sizeof(Bits) * 8 - 1)));
+            }
+        };
+
+        // Positive IEEE values get the sign bit set, negative values are inverted to reverse their order
+        template <class TKey>
+        struct RadixTraits<TKey, typename std::enable_if<std::is_floating_point<TKey>::value>::type> {
+            static_assert(sizeof(TKey) == 4 || sizeof(TKey) == 8, "Only float and double are supported.");
+            using Bits = typename std::conditional<sizeof(TKey) == 4, uint32_t, uint64_t>::type;
+            static Bits toBits(TKey key) {
+                Bits bits;
+                ::memcpy(&bits, &key, sizeof(Bits));
+                const Bits signBit = Bits(1) << (sizeof(Bits) * 8 - 1);
+                return (bits & signBit) != 0 ? ~bits : (bits | signBit);
+            }
+        };
+
+        template <class TKey, class TValue>
+        inline void radixSortImpl(TKey *keys, TValue *values, size_t num, TKey *keyScratch, TValue *valueScratch) {
+            using Traits = RadixTraits<TKey>;
+            using Bits = typename Traits::Bits;
+            constexpr size_t NumPasses = sizeof(Bits);
+
+            // All histograms are built in one read pass
+            size_t histograms[NumPasses][RadixBuckets] = {};
+            for (size_t i = 0; i < num; ++i) {
+                const Bits bits = Traits::toBits(keys[i]);
+                for (size_t pass = 0; pass < NumPasses; ++pass) {
+                    ++histograms[pass][(bits >> (pass * 8)) & 0xFF];
+                }
+            }
+
+            TKey *srcKeys = keys, *dstKeys = keyScratch;
+            TValue *srcValues = values, *dstValues = valueScratch;
+            for (size_t pass = 0; pass < NumPasses; ++pass) {
+                size_t *offsets = histograms[pass];
+                const size_t shift = pass * 8;
+
+                // All keys share this digit, the pass would not change the order
+                if (offsets[(Traits::toBits(srcKeys[0]) >> shift) & 0xFF] == num) {
+                    continue;
+                }
+
+                size_t offset = 0;
+                for (size_t bucket = 0; bucket < RadixBuckets; ++bucket) {
+                    const size_t count = offsets[bucket];
+                    offsets[bucket] = offset;
+                    offset += count;
+                }
+
+                if (srcValues != nullptr) {
+                    for (size_t i = 0; i < num; ++i) {
+                        const size_t dst = offsets[(Traits::toBits(srcKeys[i]) >> shift) & 0xFF]++;
+                        dstKeys[dst] = srcKeys[i];
+                        dstValues[dst] = std::move(srcValues[i]);
+                    }
+                } else {
+                    for (size_t i = 0; i < num; ++i) {
+                        dstKeys[offsets[(Traits::toBits(srcKeys[i]) >> shift) & 0xFF]++] = srcKeys[i];
+                    }
+                }
+                std::swap(srcKeys, dstKeys);
+                std::swap(srcValues, dstValues);
+            }
+
+            if (srcKeys != keys) {
+                ::memcpy(keys, srcKeys, num * sizeof(TKey));
+                for (size_t i = 0; srcValues != nullptr && i < num; ++i) {
+                    values[i] = std::move(srcValues[i]);
+                }
+            }
+        }
+
+    } // namespace Details
+
+    /// @brief Sorts integer or floating point keys in ascending order with an LSD radix sort.
+    /// @tparam TKey    The key type, an integer type, float or double
+    /// @param keys     The keys to sort
+    /// @param num      The number of keys
+    /// @param scratch  A buffer for num keys, used for the passes
+    /// @remark The sort is stable and does not allocate. Passes in which all keys have the same
+    ///         byte are skipped. -0.0 is sorted before 0.0, NaNs are sorted to the front or the end
+    ///         depending on their sign bit.
+    template <class TKey>
+    inline void radixSort(TKey *keys, size_t num, TKey *scratch) {
+        if (num < 2) {
+            return;
+        }
+        assert(keys != nullptr && scratch != nullptr);
+        Details::radixSortImpl<TKey, TKey>(keys, nullptr, num, scratch, nullptr);
+    }
+
+    /// @brief Sorts key-value pairs by the keys with an LSD radix sort.
+    /// @tparam TKey    The key type, an integer type, float or double
+    /// @tparam TValue  The value type
+    /// @param keys         The keys to sort
+    /// @param values       The values, will be moved with their keys
+    /// @param num          The number of pairs
+    /// @param keyScratch   A buffer for num keys, used for the passes
+    /// @param valueScratch A buffer for num values, used for the passes
+    /// @remark The sort is stable and does not allocate.
+    template <class TKey, class TValue>
+    inline void radixSort(TKey *keys, TValue *values, size_t num, TKey *keyScratch, TValue *valueScratch) {
+        if (num < 2) {
+            return;
+        }
+        assert(keys != nullptr && values != nullptr && keyScratch != nullptr && valueScratch != nullptr);
+        Details::radixSortImpl(keys, values, num, keyScratch, valueScratch);
+    }
+
     /// @brief Checks if the data is sorted.
     /// @param data     The data to check
     /// @param num      The number of elements to check
     /// @param stride   The stride of the data, i.e. the size of each element
     /// @param func     The comparison function
     /// @return true if the data is sorted, false otherwise
-    bool isSorted(const void *data, size_t num, size_t stride, ComparisonFn func) {
+    inline bool isSorted(const void *data, size_t num, size_t stride, ComparisonFn func) {
         if (num  < 2) {
             return true;
         }
         auto *data_ = (uint8_t *)data;
         for (size_t i=1; i<num; ++i) {
             const int32_t result = func(&data_[(i-1)*stride], &data_[i * stride]);
-            if (result == -1) {
+            if (result < 0) {
                 return false;
             }
         }
@@ -152,6 +955,23 @@ namespace cppcore {
         return true;
     }
 
+    /// @brief Checks if the data is sorted.
+    /// @tparam T           The type of the value
+    /// @tparam TCompare    The compare type, returns true if the first value is lower
+    /// @param data     The data to check
+    /// @param num      The number of elements to check
+    /// @param comp     The compare function
+    /// @return true if no element is lower than its predecessor
+    template <class T, class TCompare = TLess<T>>
+    inline bool isSorted(const T *data, size_t num, TCompare comp = TCompare()) {
+        for (size_t i = 1; i < num; ++i) {
+            if (comp(data[i], data[i - 1])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /// @brief Implements a binary search algorithm.
     /// @param key      The key to search for
     /// @param data     The data to search in
@@ -187,4 +1007,33 @@ namespace cppcore {
     inline int32_t binSearch(const T &key, const void *array, size_t num, ComparisonFn func) {
         return binSearchImpl(&key, array, num, sizeof(T), func);
     }
+
+    /// @brief Returns the position of the first element which is not lower than the key.
+    /// @tparam T           The type of the value
+    /// @tparam TCompare    The compare type, returns true if the first value is lower
+    /// @param data     The sorted data to search in
+    /// @param num      The number of elements
+    /// @param key      The key to search for
+    /// @param comp     The compare function
+    /// @return The position, num if all elements are lower than the key
+    /// @remark The search is branchless, the compare result selects the next half by a
+    ///         conditional move. Both possible next probes are prefetched, so big arrays are
+    ///         bound by the memory latency instead of branch mispredictions.
+    template <class T, class TCompare = TLess<T>>
+    inline size_t lowerBound(const T *data, size_t num, const T &key, TCompare comp = TCompare()) {
+        if (num == 0) {
+            return 0;
+        }
+
+        const T *base = data;
+        size_t len = num;
+        while (len > 1) {
+            const size_t half = len / 2;
+            CPPCORE_PREFETCH(base + half / 2);
+            CPPCORE_PREFETCH(base + half + half / 2);
+            base = comp(base[half], key) ? base + half : base;
+            len -= half;
+        }
+        return static_cast<size_t>(base - data) + (comp(*base, key) ? 1 : 0);
+    }
 } // namespace cppcore
@@ -0,0 +1,295 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/BitUtils.h>
+#include <cppcore/Memory/TDefaultAllocator.h>
+
+#include <atomic>
+
+namespace cppcore {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TAtomicBitSet
+///	@ingroup	CPPCore
+///
+///	@brief  A fixed-size bitset which can be modified by several threads without any lock.
+///
+/// The bits are stored in 64-bit atomic words. A second summary level stores one bit per data
+/// word, which is set when the word is full. findAndSetFirstZero will use it to skip full words,
+/// so looking for a free slot in a mostly-full set will only touch a few cache lines.
+/// @code
+/// TAtomicBitSet<> slots(1024);
+/// size_t slot = 0;
+/// if (slots.findAndSetFirstZero(slot)) {
+///     ...
+///     slots.clear(slot);
+/// }
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+template <class TAlloc = TDefaultAllocator<std::atomic<uint64_t>>>
+class TAtomicBitSet {
+public:
+    /// @brief  The number of bits per storage word.
+    static constexpr size_t BitsPerWord = 64;
+
+    /// @brief  The default class constructor.
+    TAtomicBitSet() = default;
+
+    /// @brief  The class constructor with the number of bits.
+    /// @param[in] numBits  The number of bits, all will be cleared.
+    explicit TAtomicBitSet(size_t numBits);
+
+    /// @brief  The class destructor.
+    ~TAtomicBitSet();
+
+    /// @brief  Will init the bitset with the given number of bits, all will be cleared.
+    /// @param[in] numBits  The number of bits.
+    /// @remark Not thread-safe, do not call while other threads are using the bitset.
+    void init(size_t numBits);
+
+    /// @brief  Will return the number of bits.
+    /// @return The number of bits.
+    size_t size() const;
+
+    /// @brief  Will return the bit at the given position.
+    /// @param[in] pos  The bit position for readout.
+    /// @return true for bit is set, false for not.
+    bool test(size_t pos) const;
+
+    /// @brief  Will try to set the bit at the given position.
+    /// @param[in] pos  The bit position for write.
+    /// @return true, if the bit was changed by this call, false if it was already set.
+    bool trySet(size_t pos);
+
+    /// @brief  Will clear the bit at the given position.
+    /// @param[in] pos  The bit position for write.
+    /// @return true, if the bit was set before.
+    bool clear(size_t pos);
+
+    /// @brief  Will look for the first cleared bit and set it.
+    /// @param[out] pos The position of the claimed bit.
+    /// @return true, if a bit was claimed, false if all bits are set.
+    bool findAndSetFirstZero(size_t &pos);
+
+    /// @brief  Will clear all bits.
+    /// @remark Not a snapshot, concurrent writers may see a partially cleared set.
+    void clearAll();
+
+    /// @brief  Will return the number of set bits.
+    /// @return The number of set bits.
+    size_t count() const;
+
+    /// No copying allowed
+    CPPCORE_NONE_COPYING(TAtomicBitSet)
+
+private:
+    static size_t numWords(size_t numBits);
+    static uint64_t tailMask(size_t numBits);
+    bool claimInWord(size_t wordIdx, size_t &pos);
+    void markFull(size_t wordIdx);
+    void release();
+
+private:
+    TAlloc mAllocator;
+    std::atomic<uint64_t> *mWords{nullptr};
+    std::atomic<uint64_t> *mSummary{nullptr};
+    size_t mNumBits{0u};
+    size_t mNumWords{0u};
+    size_t mNumSummaryWords{0u};
+};
+
+template <class TAlloc>
+inline TAtomicBitSet<TAlloc>::TAtomicBitSet(size_t numBits) {
+    init(numBits);
+}
+
+template <class TAlloc>
+inline TAtomicBitSet<TAlloc>::~TAtomicBitSet() {
+    release();
+}
+
+template <class TAlloc>
+inline void TAtomicBitSet<TAlloc>::init(size_t numBits) {
+    release();
+    if (numBits == 0) {
+        return;
+    }
+
+    mNumBits = numBits;
+    mNumWords = numWords(numBits);
+    mNumSummaryWords = numWords(mNumWords);
+    mWords = mAllocator.alloc(mNumWords);
+    mSummary = mAllocator.alloc(mNumSummaryWords);
+    clearAll();
+}
+
+template <class TAlloc>
+inline size_t TAtomicBitSet<TAlloc>::size() const {
+    return mNumBits;
+}
+
+template <class TAlloc>
+inline bool TAtomicBitSet<TAlloc>::test(size_t pos) const {
+    assert(pos < mNumBits);
+    const uint64_t mask = 1ull << (pos % BitsPerWord);
+    return (mWords[pos / BitsPerWord].load(std::memory_order_acquire) & mask) != 0;
+}
+
+template <class TAlloc>
+inline bool TAtomicBitSet<TAlloc>::trySet(size_t pos) {
+    assert(pos < mNumBits);
+    const size_t wordIdx = pos / BitsPerWord;
+    const uint64_t mask = 1ull << (pos % BitsPerWord);
+    const uint64_t old = mWords[wordIdx].fetch_or(mask, std::memory_order_acq_rel);
+    if ((old & mask) != 0) {
+        return false;
+    }
+
+    if ((old | mask) == ~0ull) {
+        markFull(wordIdx);
+    }
+
+    return true;
+}
+
+template <class TAlloc>
+inline bool TAtomicBitSet<TAlloc>::clear(size_t pos) {
+    assert(pos < mNumBits);
+    const size_t wordIdx = pos / BitsPerWord;
+    const uint64_t mask = 1ull << (pos % BitsPerWord);
+    const uint64_t old = mWords[wordIdx].fetch_and(~mask, std::memory_order_acq_rel);
+    if ((old & mask) == 0) {
+        return false;
+    }
+
+    // The summary bit must be cleared after the data bit, see markFull
+    if (old == ~0ull) {
+        const uint64_t summaryMask = 1ull << (wordIdx % BitsPerWord);
+        mSummary[wordIdx / BitsPerWord].fetch_and(~summaryMask, std::memory_order_acq_rel);
+    }
+
+    return true;
+}
+
+template <class TAlloc>
+inline bool TAtomicBitSet<TAlloc>::findAndSetFirstZero(size_t &pos) {
+    for (size_t summaryIdx = 0; summaryIdx < mNumSummaryWords; ++summaryIdx) {
+        uint64_t full = mSummary[summaryIdx].load(std::memory_order_acquire);
+        while (full != ~0ull) {
+            const uint32_t bit = countTrailingZeros(~full);
+            if (claimInWord(summaryIdx * BitsPerWord + bit, pos)) {
+                return true;
+            }
+            // The word was filled by another thread meanwhile, skip it
+            full |= 1ull << bit;
+        }
+    }
+
+    return false;
+}
+
+template <class TAlloc>
+inline void TAtomicBitSet<TAlloc>::clearAll() {
+    for (size_t i = 0; i < mNumWords; ++i) {
+        mWords[i].store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < mNumSummaryWords; ++i) {
+        mSummary[i].store(0, std::memory_order_relaxed);
+    }
+
+    // Bits behind the end are marked as set, so they will never be claimed
+    if (mNumWords != 0) {
+        mWords[mNumWords - 1].store(~tailMask(mNumBits), std::memory_order_relaxed);
+        mSummary[mNumSummaryWords - 1].store(~tailMask(mNumWords), std::memory_order_release);
+    }
+}
+
+template <class TAlloc>
+inline size_t TAtomicBitSet<TAlloc>::count() const {
+    size_t numSet = 0;
+    for (size_t i = 0; i < mNumWords; ++i) {
+        numSet += popCount(mWords[i].load(std::memory_order_relaxed));
+    }
+
+    return numSet - (mNumWords * BitsPerWord - mNumBits);
+}
+
+template <class TAlloc>
+inline size_t TAtomicBitSet<TAlloc>::numWords(size_t numBits) {
+    return (numBits + BitsPerWord - 1) / BitsPerWord;
+}
+
+template <class TAlloc>
+inline uint64_t TAtomicBitSet<TAlloc>::tailMask(size_t numBits) {
+    const size_t rest = numBits % BitsPerWord;
+    return rest == 0 ? ~0ull : (1ull << rest) - 1;
+}
+
+template <class TAlloc>
+inline bool TAtomicBitSet<TAlloc>::claimInWord(size_t wordIdx, size_t &pos) {
+    std::atomic<uint64_t> &word = mWords[wordIdx];
+    uint64_t current = word.load(std::memory_order_relaxed);
+    while (current != ~0ull) {
+        const uint32_t bit = countTrailingZeros(~current);
+        const uint64_t desired = current | (1ull << bit);
+        if (word.compare_exchange_weak(current, desired, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            if (desired == ~0ull) {
+                markFull(wordIdx);
+            }
+            pos = wordIdx * BitsPerWord + bit;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <class TAlloc>
+inline void TAtomicBitSet<TAlloc>::markFull(size_t wordIdx) {
+    const uint64_t summaryMask = 1ull << (wordIdx % BitsPerWord);
+    std::atomic<uint64_t> &summary = mSummary[wordIdx / BitsPerWord];
+    summary.fetch_or(summaryMask, std::memory_order_acq_rel);
+
+    // A concurrent clear may have freed a bit before the summary was updated. The summary must
+    // never claim a word to be full when it is not, so recheck and undo.
+    if (mWords[wordIdx].load(std::memory_order_acquire) != ~0ull) {
+        summary.fetch_and(~summaryMask, std::memory_order_acq_rel);
+    }
+}
+
+template <class TAlloc>
+inline void TAtomicBitSet<TAlloc>::release() {
+    if (mWords != nullptr) {
+        mAllocator.release(mWords);
+        mAllocator.release(mSummary);
+        mWords = nullptr;
+        mSummary = nullptr;
+    }
+    mNumBits = 0u;
+    mNumWords = 0u;
+    mNumSummaryWords = 0u;
+}
+
+} // namespace cppcore
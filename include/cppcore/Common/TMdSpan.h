@@ -0,0 +1,258 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+
+#include <initializer_list>
+
+namespace cppcore {
+
+template <class T, size_t First, size_t... Rest>
+class TMdSpan;
+
+namespace Details {
+
+    template <size_t... Extents>
+    struct MdExtents;
+
+    template <>
+    struct MdExtents<> {
+        static constexpr size_t get(size_t) {
+            return 0;
+        }
+
+        static constexpr size_t product() {
+            return 1;
+        }
+    };
+
+    template <size_t First, size_t... Rest>
+    struct MdExtents<First, Rest...> {
+        static constexpr size_t get(size_t dim) {
+            return dim == 0 ? First : MdExtents<Rest...>::get(dim - 1);
+        }
+
+        static constexpr size_t product() {
+            return First * MdExtents<Rest...>::product();
+        }
+    };
+
+    // The type of a slice, the slice of a single dimension is the item itself
+    template <class T, size_t... Extents>
+    struct MdSlice {
+        using Type = TMdSpan<T, Extents...>;
+
+        static Type make(T *ptr, const size_t *strides) {
+            return Type(ptr, strides);
+        }
+    };
+
+    template <class T>
+    struct MdSlice<T> {
+        using Type = T &;
+
+        static Type make(T *ptr, const size_t *) {
+            return *ptr;
+        }
+    };
+
+} // namespace Details
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TMdSpan
+///	@ingroup	CPPCore
+///
+///	@brief  This class implements a multi-dimensional view onto array data with fixed extents.
+///
+/// The extents are known at compile time, so the index computation can be unrolled and loops
+/// over them can be vectorized. The items are stored row-major by default, the strides can be
+/// set to view a tile of a larger array. The indices are only checked in debug builds. Use a
+/// const type for a read-only view.
+/// @code
+/// // A 16x16 tile at (x, y) of an image with the given width
+/// TMdSpan<float, 16, 16> tile(image + y * width + x, {width, 1});
+/// for (size_t row = 0; row < tile.extent(0); ++row) {
+///     for (size_t col = 0; col < tile.extent(1); ++col) {
+///         tile(row, col) *= 0.5f;
+///     }
+/// }
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+template <class T, size_t First, size_t... Rest>
+class TMdSpan {
+public:
+    /// @brief The number of dimensions.
+    static constexpr size_t Rank = 1 + sizeof...(Rest);
+
+    /// @brief The type of a slice along the first dimension.
+    using SliceType = typename Details::MdSlice<T, Rest...>::Type;
+
+    /// @brief The default class constructor.
+    TMdSpan();
+
+    /// @brief The class constructor for row-major items without gaps.
+    /// @param[in] ptr      The pointer to the first item.
+    explicit TMdSpan(T *ptr);
+
+    /// @brief The class constructor with the strides.
+    /// @param[in] ptr      The pointer to the first item.
+    /// @param[in] strides  The distance between two items in each dimension, in items.
+    TMdSpan(T *ptr, std::initializer_list<size_t> strides);
+
+    /// @brief The class constructor with the strides.
+    /// @param[in] ptr      The pointer to the first item.
+    /// @param[in] strides  Rank distances between two items in each dimension, in items.
+    TMdSpan(T *ptr, const size_t *strides);
+
+    /// @brief The class destructor.
+    ~TMdSpan() = default;
+
+    /// @brief Will return the number of items in a dimension.
+    /// @param[in] dim  The dimension.
+    /// @return The number of items.
+    static constexpr size_t extent(size_t dim);
+
+    /// @brief Will return the number of items.
+    /// @return The number of items.
+    static constexpr size_t size();
+
+    /// @brief Will return the distance between two items in a dimension.
+    /// @param[in] dim  The dimension.
+    /// @return The distance in items.
+    size_t stride(size_t dim) const;
+
+    /// @brief Will return true, if the items are stored row-major without gaps.
+    /// @return true for contiguous items.
+    bool isContiguous() const;
+
+    /// @brief Will return the pointer to the first item.
+    /// @return The pointer or nullptr, if no data was set.
+    T *data() const;
+
+    /// @brief Will return the item at the given indices.
+    /// @param[in] indices  Rank indices, each must be less than its extent.
+    /// @return The item.
+    template <class... TIndices>
+    T &operator()(TIndices... indices) const;
+
+    /// @brief Will return the slice at the given index of the first dimension.
+    /// @param[in] index  The index, must be less than the first extent.
+    /// @return The view with one dimension less, or the item for a single dimension.
+    SliceType operator[](size_t index) const;
+
+private:
+    T *mData;
+    size_t mStrides[Rank];
+};
+
+template <class T, size_t First, size_t... Rest>
+constexpr size_t TMdSpan<T, First, Rest...>::Rank;
+
+template <class T, size_t First, size_t... Rest>
+inline TMdSpan<T, First, Rest...>::TMdSpan() :
+        TMdSpan(nullptr) {
+    // empty
+}
+
+template <class T, size_t First, size_t... Rest>
+inline TMdSpan<T, First, Rest...>::TMdSpan(T *ptr) :
+        mData(ptr) {
+    size_t stride = 1;
+    for (size_t dim = Rank; dim-- > 0;) {
+        mStrides[dim] = stride;
+        stride *= extent(dim);
+    }
+}
+
+template <class T, size_t First, size_t... Rest>
+inline TMdSpan<T, First, Rest...>::TMdSpan(T *ptr, std::initializer_list<size_t> strides) :
+        mData(ptr) {
+    assert(strides.size() == Rank);
+    size_t dim = 0;
+    for (size_t stride : strides) {
+        mStrides[dim++] = stride;
+    }
+}
+
+template <class T, size_t First, size_t... Rest>
+inline TMdSpan<T, First, Rest...>::TMdSpan(T *ptr, const size_t *strides) :
+        mData(ptr) {
+    for (size_t dim = 0; dim < Rank; ++dim) {
+        mStrides[dim] = strides[dim];
+    }
+}
+
+template <class T, size_t First, size_t... Rest>
+inline constexpr size_t TMdSpan<T, First, Rest...>::extent(size_t dim) {
+    return Details::MdExtents<First, Rest...>::get(dim);
+}
+
+template <class T, size_t First, size_t... Rest>
+inline constexpr size_t TMdSpan<T, First, Rest...>::size() {
+    return Details::MdExtents<First, Rest...>::product();
+}
+
+template <class T, size_t First, size_t... Rest>
+inline size_t TMdSpan<T, First, Rest...>::stride(size_t dim) const {
+    assert(dim < Rank);
+    return mStrides[dim];
+}
+
+template <class T, size_t First, size_t... Rest>
+inline bool TMdSpan<T, First, Rest...>::isContiguous() const {
+    size_t stride = 1;
+    for (size_t dim = Rank; dim-- > 0;) {
+        if (mStrides[dim] != stride) {
+            return false;
+        }
+        stride *= extent(dim);
+    }
+    return true;
+}
+
+template <class T, size_t First, size_t... Rest>
+inline T *TMdSpan<T, First, Rest...>::data() const {
+    return mData;
+}
+
+template <class T, size_t First, size_t... Rest>
+template <class... TIndices>
+inline T &TMdSpan<T, First, Rest...>::operator()(TIndices... indices) const {
+    static_assert(sizeof...(TIndices) == Rank, "One index per dimension is required.");
+    const size_t index[] = { static_cast<size_t>(indices)... };
+    size_t offset = 0;
+    for (size_t dim = 0; dim < Rank; ++dim) {
+        assert(index[dim] < extent(dim));
+        offset += index[dim] * mStrides[dim];
+    }
+    return mData[offset];
+}
+
+template <class T, size_t First, size_t... Rest>
+inline typename TMdSpan<T, First, Rest...>::SliceType TMdSpan<T, First, Rest...>::operator[](size_t index) const {
+    assert(index < First);
+    return Details::MdSlice<T, Rest...>::make(mData + index * mStrides[0], mStrides + 1);
+}
+
+} // namespace cppcore
@@ -0,0 +1,716 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/TStringBase.h>
+#include <cppcore/Common/TStringView.h>
+#include <cppcore/Container/TArray.h>
+#include <cppcore/Memory/TPoolAllocator.h>
+
+#include <string.h>
+
+namespace cppcore {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TRope
+///	@ingroup	CPPCore
+///
+///	@brief  A string for large editable texts, stored as a balanced tree of chunks.
+///
+/// insert, erase and substring are O(log n) and never copy more than a few chunks. The tree is
+/// immutable, modifications create new nodes along the changed path and share all others. So a
+/// copy of a rope is a cheap snapshot, which will not see later modifications of the original.
+/// Nodes and chunks are allocated from pools, which are shared by a rope and all its copies.
+/// @code
+/// TRope<char> text(fileData, fileSize);
+/// TRope<char> undo = text;                     // O(1) snapshot
+/// text.insert(1024, "inserted", 8);
+/// text.erase(0, 16);
+/// TRope<char>::ChunkIterator chunks = text.chunks();
+/// for (const TStringView<char> &chunk : chunks) {
+///     fwrite(chunk.data(), 1, chunk.size(), file);
+/// }
+/// @endcode
+/// @remark Not thread-safe, even copies may not be used by different threads at the same time.
+//-------------------------------------------------------------------------------------------------
+template <class T>
+class TRope {
+    struct Node;
+
+public:
+    /// @brief  The maximal number of chars per chunk.
+    static constexpr size_t ChunkSize = 1024;
+
+    /// @brief  Iterates over the chunks of a rope as views, which point into the rope.
+    /// @remark The rope must not be modified or destroyed while iterating.
+    class ChunkIterator {
+    public:
+        /// @brief  The input iterator over the chunks.
+        class Iterator {
+        public:
+            Iterator() = default;
+            explicit Iterator(ChunkIterator *chunks);
+            const TStringView<T> &operator*() const;
+            const TStringView<T> *operator->() const;
+            Iterator &operator++();
+            bool operator == (const Iterator &rhs) const;
+            bool operator != (const Iterator &rhs) const;
+
+        private:
+            ChunkIterator *mChunks{nullptr};
+            TStringView<T> mChunk;
+        };
+
+        /// @brief Will return the next chunk.
+        /// @param chunk    The next chunk.
+        /// @return false, if there are no more chunks.
+        bool next(TStringView<T> &chunk);
+
+        /// @brief Will return the iterator to the next chunk.
+        Iterator begin();
+
+        /// @brief Will return the end iterator.
+        Iterator end();
+
+    private:
+        friend class TRope;
+        explicit ChunkIterator(const Node *root);
+
+        // An AVL tree of this height would need more than 2^64 chars
+        static constexpr size_t MaxHeight = 96;
+
+        const Node *mStack[MaxHeight];
+        size_t mDepth;
+    };
+
+    /// @brief  The default class constructor.
+    TRope() = default;
+
+    /// @brief  The class constructor with the initial text.
+    /// @param[in] ptr   Pointer to the chars.
+    /// @param[in] size  The number of chars.
+    TRope(const T *ptr, size_t size);
+
+    /// @brief  The copy constructor, creates a snapshot in O(1).
+    /// @param[in] rhs  The rope to copy.
+    TRope(const TRope &rhs);
+
+    /// @brief  The move constructor, rhs will be empty afterwards.
+    /// @param[in] rhs  The rope to move.
+    TRope(TRope &&rhs) noexcept;
+
+    /// @brief  The class destructor.
+    ~TRope();
+
+    /// @brief  The copy assignment operator, creates a snapshot in O(1).
+    TRope &operator = (const TRope &rhs);
+
+    /// @brief  The move assignment operator, rhs will be empty afterwards.
+    TRope &operator = (TRope &&rhs) noexcept;
+
+    /// @brief  Will return the number of chars.
+    /// @return The number of chars.
+    size_t size() const;
+
+    /// @brief  Will return true, if the rope is empty.
+    /// @return true for empty.
+    bool isEmpty() const;
+
+    /// @brief  Will return the char at the given index in O(log n).
+    /// @param[in] index  The index, must be less than size.
+    /// @return The char.
+    T operator[](size_t index) const;
+
+    /// @brief  Will insert chars.
+    /// @param[in] pos   The position, will be clamped to the size.
+    /// @param[in] ptr   Pointer to the chars.
+    /// @param[in] size  The number of chars.
+    void insert(size_t pos, const T *ptr, size_t size);
+
+    /// @brief  Will insert another rope, its chunks are shared if both use the same pools.
+    /// @param[in] pos   The position, will be clamped to the size.
+    /// @param[in] rope  The rope to insert.
+    void insert(size_t pos, const TRope &rope);
+
+    /// @brief  Will append chars.
+    /// @param[in] ptr   Pointer to the chars.
+    /// @param[in] size  The number of chars.
+    void append(const T *ptr, size_t size);
+
+    /// @brief  Will erase chars.
+    /// @param[in] pos  The position of the first char to erase.
+    /// @param[in] len  The number of chars, will be clamped to the rest of the rope.
+    void erase(size_t pos, size_t len);
+
+    /// @brief  Will return a part of the rope in O(log n), it shares the chunks.
+    /// @param[in] pos  The start position, will be clamped to the size.
+    /// @param[in] len  The number of chars, will be clamped to the rest of the rope.
+    /// @return The part of the rope.
+    TRope substring(size_t pos, size_t len) const;
+
+    /// @brief  Will remove all chars.
+    void clear();
+
+    /// @brief  Will copy the whole text into one string.
+    /// @return The string.
+    TStringBase<T> toString() const;
+
+    /// @brief  Will return the iterator over the chunks.
+    /// @return The iterator.
+    ChunkIterator chunks() const;
+
+private:
+    // Leaves have no children and own a chunk, the height of a leaf is 1.
+    struct Node {
+        Node *left;
+        Node *right;
+        T *chars;
+        size_t size;
+        uint32_t refCount;
+        uint32_t height;
+    };
+
+    struct Chunk {
+        T chars[ChunkSize];
+    };
+
+    // A pool which recycles released items. TPoolAllocator can only release all items at once.
+    template <class TItem>
+    class FreeListPool {
+    public:
+        explicit FreeListPool(size_t numItemsPerBlock) :
+                mAllocator(numItemsPerBlock), mFree(nullptr) {
+            // empty
+        }
+
+        TItem *alloc() {
+            Slot *slot = mFree;
+            if (slot != nullptr) {
+                mFree = slot->next;
+            } else {
+                slot = mAllocator.alloc();
+            }
+            return &slot->item;
+        }
+
+        void release(TItem *item) {
+            Slot *slot = reinterpret_cast<Slot *>(item);
+            slot->next = mFree;
+            mFree = slot;
+        }
+
+    private:
+        union Slot {
+            TItem item;
+            Slot *next;
+        };
+
+        TPoolAllocator<Slot> mAllocator;
+        Slot *mFree;
+    };
+
+    // Shared by a rope and all ropes created from it
+    struct Storage {
+        FreeListPool<Node> nodes{1024};
+        FreeListPool<Chunk> chunks{64};
+        size_t refCount{1};
+    };
+
+    TRope(Storage *storage, Node *root);
+    void ensureStorage();
+    void setRoot(Node *root);
+    Node *build(const T *ptr, size_t size) const;
+    Node *buildBalanced(Node **leaves, size_t numLeaves) const;
+    Node *copyNodes(const TRope &rope) const;
+    Node *makeLeaf(const T *first, size_t firstSize, const T *second, size_t secondSize) const;
+    Node *makeInternal(Node *left, Node *right) const;
+    Node *balance(Node *left, Node *right) const;
+    Node *join(Node *left, Node *right) const;
+    void split(Node *node, size_t pos, Node *&left, Node *&right) const;
+    void releaseNode(Node *node) const;
+    void releaseAll();
+    static Node *retain(Node *node);
+    static uint32_t height(const Node *node);
+
+private:
+    Storage *mStorage{nullptr};
+    Node *mRoot{nullptr};
+};
+
+template <class T>
+constexpr size_t TRope<T>::ChunkSize;
+
+template <class T>
+constexpr size_t TRope<T>::ChunkIterator::MaxHeight;
+
+template <class T>
+inline TRope<T>::ChunkIterator::Iterator::Iterator(ChunkIterator *chunks) :
+        mChunks(chunks) {
+    ++(*this);
+}
+
+template <class T>
+inline const TStringView<T> &TRope<T>::ChunkIterator::Iterator::operator*() const {
+    return mChunk;
+}
+
+template <class T>
+inline const TStringView<T> *TRope<T>::ChunkIterator::Iterator::operator->() const {
+    return &mChunk;
+}
+
+template <class T>
+inline typename TRope<T>::ChunkIterator::Iterator &TRope<T>::ChunkIterator::Iterator::operator++() {
+    if (mChunks != nullptr && !mChunks->next(mChunk)) {
+        mChunks = nullptr;
+    }
+    return *this;
+}
+
+template <class T>
+inline bool TRope<T>::ChunkIterator::Iterator::operator == (const Iterator &rhs) const {
+    return mChunks == rhs.mChunks;
+}
+
+template <class T>
+inline bool TRope<T>::ChunkIterator::Iterator::operator != (const Iterator &rhs) const {
+    return !(*this == rhs);
+}
+
+template <class T>
+inline TRope<T>::ChunkIterator::ChunkIterator(const Node *root) :
+        mDepth(0) {
+    if (root != nullptr) {
+        mStack[mDepth++] = root;
+    }
+}
+
+template <class T>
+inline bool TRope<T>::ChunkIterator::next(TStringView<T> &chunk) {
+    while (mDepth != 0) {
+        const Node *node = mStack[--mDepth];
+        if (node->chars != nullptr) {
+            chunk = TStringView<T>(node->chars, node->size);
+            return true;
+        }
+        mStack[mDepth++] = node->right;
+        mStack[mDepth++] = node->left;
+    }
+    return false;
+}
+
+template <class T>
+inline typename TRope<T>::ChunkIterator::Iterator TRope<T>::ChunkIterator::begin() {
+    return Iterator(this);
+}
+
+template <class T>
+inline typename TRope<T>::ChunkIterator::Iterator TRope<T>::ChunkIterator::end() {
+    return Iterator();
+}
+
+template <class T>
+inline TRope<T>::TRope(const T *ptr, size_t size) {
+    insert(0, ptr, size);
+}
+
+template <class T>
+inline TRope<T>::TRope(const TRope &rhs) :
+        mStorage(rhs.mStorage), mRoot(retain(rhs.mRoot)) {
+    if (mStorage != nullptr) {
+        ++mStorage->refCount;
+    }
+}
+
+template <class T>
+inline TRope<T>::TRope(TRope &&rhs) noexcept :
+        mStorage(rhs.mStorage), mRoot(rhs.mRoot) {
+    rhs.mStorage = nullptr;
+    rhs.mRoot = nullptr;
+}
+
+template <class T>
+inline TRope<T>::TRope(Storage *storage, Node *root) :
+        mStorage(storage), mRoot(root) {
+    ++mStorage->refCount;
+}
+
+template <class T>
+inline TRope<T>::~TRope() {
+    releaseAll();
+}
+
+template <class T>
+inline TRope<T> &TRope<T>::operator = (const TRope &rhs) {
+    if (this != &rhs) {
+        // Retain first, rhs may be a part of this rope
+        Storage *storage = rhs.mStorage;
+        Node *root = retain(rhs.mRoot);
+        if (storage != nullptr) {
+            ++storage->refCount;
+        }
+        releaseAll();
+        mStorage = storage;
+        mRoot = root;
+    }
+    return *this;
+}
+
+template <class T>
+inline TRope<T> &TRope<T>::operator = (TRope &&rhs) noexcept {
+    if (this != &rhs) {
+        releaseAll();
+        mStorage = rhs.mStorage;
+        mRoot = rhs.mRoot;
+        rhs.mStorage = nullptr;
+        rhs.mRoot = nullptr;
+    }
+    return *this;
+}
+
+template <class T>
+inline size_t TRope<T>::size() const {
+    return mRoot == nullptr ? 0 : mRoot->size;
+}
+
+template <class T>
+inline bool TRope<T>::isEmpty() const {
+    return size() == 0;
+}
+
+template <class T>
+inline T TRope<T>::operator[](size_t index) const {
+    assert(index < size());
+    const Node *node = mRoot;
+    while (node->chars == nullptr) {
+        if (index < node->left->size) {
+            node = node->left;
+        } else {
+            index -= node->left->size;
+            node = node->right;
+        }
+    }
+    return node->chars[index];
+}
+
+template <class T>
+inline void TRope<T>::insert(size_t pos, const T *ptr, size_t size) {
+    if (ptr == nullptr || size == 0) {
+        return;
+    }
+
+    ensureStorage();
+    Node *middle = build(ptr, size);
+    Node *left = nullptr, *right = nullptr;
+    split(mRoot, pos, left, right);
+    Node *head = join(left, middle);
+    setRoot(join(head, right));
+    releaseNode(head);
+    releaseNode(left);
+    releaseNode(middle);
+    releaseNode(right);
+}
+
+template <class T>
+inline void TRope<T>::insert(size_t pos, const TRope &rope) {
+    if (rope.isEmpty()) {
+        return;
+    }
+    if (mStorage == nullptr) {
+        mStorage = rope.mStorage;
+        ++mStorage->refCount;
+    }
+
+    // Nodes can only be shared within the same pools
+    Node *middle = rope.mStorage == mStorage ? retain(rope.mRoot) : copyNodes(rope);
+    Node *left = nullptr, *right = nullptr;
+    split(mRoot, pos, left, right);
+    Node *head = join(left, middle);
+    setRoot(join(head, right));
+    releaseNode(head);
+    releaseNode(left);
+    releaseNode(middle);
+    releaseNode(right);
+}
+
+template <class T>
+inline void TRope<T>::append(const T *ptr, size_t size) {
+    insert(this->size(), ptr, size);
+}
+
+template <class T>
+inline void TRope<T>::erase(size_t pos, size_t len) {
+    if (mRoot == nullptr || len == 0 || pos >= mRoot->size) {
+        return;
+    }
+
+    Node *left = nullptr, *rest = nullptr;
+    split(mRoot, pos, left, rest);
+    Node *erased = nullptr, *right = nullptr;
+    split(rest, len, erased, right);
+    setRoot(join(left, right));
+    releaseNode(left);
+    releaseNode(rest);
+    releaseNode(erased);
+    releaseNode(right);
+}
+
+template <class T>
+inline TRope<T> TRope<T>::substring(size_t pos, size_t len) const {
+    if (mRoot == nullptr || len == 0 || pos >= mRoot->size) {
+        return TRope();
+    }
+
+    Node *left = nullptr, *rest = nullptr;
+    split(mRoot, pos, left, rest);
+    Node *middle = nullptr, *right = nullptr;
+    split(rest, len, middle, right);
+    releaseNode(left);
+    releaseNode(rest);
+    releaseNode(right);
+
+    return TRope(mStorage, middle);
+}
+
+template <class T>
+inline void TRope<T>::clear() {
+    setRoot(nullptr);
+}
+
+template <class T>
+inline TStringBase<T> TRope<T>::toString() const {
+    TStringBase<T> result;
+    result.reserve(size());
+    ChunkIterator iterator = chunks();
+    TStringView<T> chunk;
+    while (iterator.next(chunk)) {
+        result.append(chunk.data(), chunk.size());
+    }
+    return result;
+}
+
+template <class T>
+inline typename TRope<T>::ChunkIterator TRope<T>::chunks() const {
+    return ChunkIterator(mRoot);
+}
+
+template <class T>
+inline void TRope<T>::ensureStorage() {
+    if (mStorage == nullptr) {
+        mStorage = new Storage;
+    }
+}
+
+template <class T>
+inline void TRope<T>::setRoot(Node *root) {
+    releaseNode(mRoot);
+    mRoot = root;
+}
+
+template <class T>
+inline typename TRope<T>::Node *TRope<T>::build(const T *ptr, size_t size) const {
+    TArray<Node *> leaves;
+    leaves.reserve((size + ChunkSize - 1) / ChunkSize);
+    for (size_t offset = 0; offset < size; offset += ChunkSize) {
+        const size_t len = size - offset < ChunkSize ? size - offset : ChunkSize;
+        leaves.add(makeLeaf(ptr + offset, len, nullptr, 0));
+    }
+    return buildBalanced(&leaves[0], leaves.size());
+}
+
+template <class T>
+inline typename TRope<T>::Node *TRope<T>::buildBalanced(Node **leaves, size_t numLeaves) const {
+    if (numLeaves == 1) {
+        return leaves[0];
+    }
+    const size_t half = numLeaves / 2;
+    Node *left = buildBalanced(leaves, half);
+    return makeInternal(left, buildBalanced(leaves + half, numLeaves - half));
+}
+
+template <class T>
+inline typename TRope<T>::Node *TRope<T>::copyNodes(const TRope &rope) const {
+    TArray<Node *> leaves;
+    ChunkIterator iterator = rope.chunks();
+    TStringView<T> chunk;
+    while (iterator.next(chunk)) {
+        leaves.add(makeLeaf(chunk.data(), chunk.size(), nullptr, 0));
+    }
+    return buildBalanced(&leaves[0], leaves.size());
+}
+
+template <class T>
+inline typename TRope<T>::Node *TRope<T>::makeLeaf(const T *first, size_t firstSize, const T *second, size_t secondSize) const {
+    Node *node = mStorage->nodes.alloc();
+    node->left = nullptr;
+    node->right = nullptr;
+    node->chars = mStorage->chunks.alloc()->chars;
+    node->size = firstSize + secondSize;
+    node->refCount = 1;
+    node->height = 1;
+    ::memcpy(node->chars, first, firstSize * sizeof(T));
+    if (secondSize != 0) {
+        ::memcpy(node->chars + firstSize, second, secondSize * sizeof(T));
+    }
+    return node;
+}
+
+template <class T>
+inline typename TRope<T>::Node *TRope<T>::makeInternal(Node *left, Node *right) const {
+    // Takes over the references of the children
+    Node *node = mStorage->nodes.alloc();
+    node->left = left;
+    node->right = right;
+    node->chars = nullptr;
+    node->size = left->size + right->size;
+    node->refCount = 1;
+    node->height = 1 + (left->height > right->height ? left->height : right->height);
+    return node;
+}
+
+template <class T>
+inline typename TRope<T>::Node *TRope<T>::balance(Node *left, Node *right) const {
+    // Takes over both references, the heights differ by at most 2
+    const uint32_t leftHeight = height(left), rightHeight = height(right);
+    if (leftHeight > rightHeight + 1) {
+        Node *result = nullptr;
+        if (height(left->left) >= height(left->right)) {
+            result = makeInternal(retain(left->left), makeInternal(retain(left->right), right));
+        } else {
+            Node *inner = left->right;
+            result = makeInternal(makeInternal(retain(left->left), retain(inner->left)),
+                    makeInternal(retain(inner->right), right));
+        }
+        releaseNode(left);
+        return result;
+    }
+    if (rightHeight > leftHeight + 1) {
+        Node *result = nullptr;
+        if (height(right->right) >= height(right->left)) {
+            result = makeInternal(makeInternal(left, retain(right->left)), retain(right->right));
+        } else {
+            Node *inner = right->left;
+            result = makeInternal(makeInternal(left, retain(inner->left)),
+                    makeInternal(retain(inner->right), retain(right->right)));
+        }
+        releaseNode(right);
+        return result;
+    }
+    return makeInternal(left, right);
+}
+
+template <class T>
+inline typename TRope<T>::Node *TRope<T>::join(Node *left, Node *right) const {
+    // Borrows both trees, returns a new reference
+    if (left == nullptr) {
+        return retain(right);
+    }
+    if (right == nullptr) {
+        return retain(left);
+    }
+    // Small neighbours are merged, so typing char by char will not create tiny chunks
+    if (left->chars != nullptr && right->chars != nullptr && left->size + right->size <= ChunkSize) {
+        return makeLeaf(left->chars, left->size, right->chars, right->size);
+    }
+    if (left->height > right->height + 1) {
+        return balance(retain(left->left), join(left->right, right));
+    }
+    if (right->height > left->height + 1) {
+        return balance(join(left, right->left), retain(right->right));
+    }
+    return makeInternal(retain(left), retain(right));
+}
+
+template <class T>
+inline void TRope<T>::split(Node *node, size_t pos, Node *&left, Node *&right) const {
+    // Borrows the tree, returns new references
+    if (node == nullptr || pos == 0) {
+        left = nullptr;
+        right = retain(node);
+        return;
+    }
+    if (pos >= node->size) {
+        left = retain(node);
+        right = nullptr;
+        return;
+    }
+    if (node->chars != nullptr) {
+        left = makeLeaf(node->chars, pos, nullptr, 0);
+        right = makeLeaf(node->chars + pos, node->size - pos, nullptr, 0);
+        return;
+    }
+
+    const size_t leftSize = node->left->size;
+    if (pos <= leftSize) {
+        Node *rest = nullptr;
+        split(node->left, pos, left, rest);
+        right = join(rest, node->right);
+        releaseNode(rest);
+    } else {
+        Node *rest = nullptr;
+        split(node->right, pos - leftSize, rest, right);
+        left = join(node->left, rest);
+        releaseNode(rest);
+    }
+}
+
+template <class T>
+inline void TRope<T>::releaseNode(Node *node) const {
+    if (node == nullptr || --node->refCount != 0) {
+        return;
+    }
+
+    if (node->chars != nullptr) {
+        mStorage->chunks.release(reinterpret_cast<Chunk *>(node->chars));
+    } else {
+        releaseNode(node->left);
+        releaseNode(node->right);
+    }
+    mStorage->nodes.release(node);
+}
+
+template <class T>
+inline void TRope<T>::releaseAll() {
+    releaseNode(mRoot);
+    mRoot = nullptr;
+    if (mStorage != nullptr && --mStorage->refCount == 0) {
+        delete mStorage;
+    }
+    mStorage = nullptr;
+}
+
+template <class T>
+inline typename TRope<T>::Node *TRope<T>::retain(Node *node) {
+    if (node != nullptr) {
+        ++node->refCount;
+    }
+    return node;
+}
+
+template <class T>
+inline uint32_t TRope<T>::height(const Node *node) {
+    return node == nullptr ? 0 : node->height;
+}
+
+} // namespace cppcore
@@ -26,13 +26,18 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <cppcore/CPPCoreCommon.h>
 
+#include <type_traits>
+
 namespace cppcore {
 
 //-------------------------------------------------------------------------------------------------
 ///	@class		TSpan
 ///	@ingroup	CPPCore
 ///
-///	@brief  This class implements a view onto array data.
+///	@brief  This class implements a read-only view onto array data.
+///
+/// The index is only checked by an assertion in debug builds, so the accesses in release builds
+/// are as cheap as raw pointer accesses.
 //-------------------------------------------------------------------------------------------------
 template<class T>
 class TSpan {
@@ -65,27 +70,210 @@ public:
 
     /// @brief Will return the begin iterator.
     /// @return The begin iterator.
-    Iterator begin();
+    Iterator begin() const;
 
     /// @brief Will return the end iterator.
     /// @return The end iterator.
-    Iterator end(); 
+    Iterator end() const;
 
-    /// @brief Will return the item at the given index. If the index is out of range, the maximum value of T will be returned.
-    /// @param index The item index.
-    /// @return The item at the given index or the maximum value of T, if the index is out of range.
-    T operator[] (size_t index);    
+    /// @brief Will return a view onto a part of the array.
+    /// @param[in] offset The index of the first item.
+    /// @param[in] count  The number of items.
+    /// @return The view.
+    TSpan subspan(size_t offset, size_t count) const;
 
-    /// @brief Will return the item at the given index. If the index is out of range, the maximum value of T will be returned.
-    /// @param index The item index.
-    /// @return The item at the given index or the maximum value of T, if the index is out of range.
-    const T operator[](size_t index) const;
+    /// @brief Will return the item at the given index.
+    /// @param index The item index, must be less than size.
+    /// @return The item at the given index.
+    const T &operator[](size_t index) const;
 
 private:
     const T *mData{nullptr};
     size_t mSize{0u};
 };
 
+//-------------------------------------------------------------------------------------------------
+///	@class		TMutableSpan
+///	@ingroup	CPPCore
+///
+///	@brief  This class implements a writable view onto array data.
+///
+/// It converts into a TSpan, so it can be passed to all read-only consumers.
+//-------------------------------------------------------------------------------------------------
+template<class T>
+class TMutableSpan {
+public:
+    /// @brief The iterator type.
+    using Iterator = T*;
+
+    /// @brief The default class constructor.
+    TMutableSpan() = default;
+
+    /// @brief The class constructor with the pointer and the size of the array.
+    /// @param[in] ptr  The pointer to the array.
+    /// @param[in] size The array size.
+    TMutableSpan(T *ptr, size_t size);
+
+    /// @brief The class destructor.
+    ~TMutableSpan() = default;
+
+    /// @brief Will return the data pointer showing to the first entry.
+    /// @return The array pointer or nullptr, if no array was set.
+    T* data() const;
+
+    /// @brief Will return the number of items in the view.
+    /// @return The number of items.
+    size_t size() const;
+
+    /// @brief Will return true, if the span view is empty.
+    /// @return true for empty.
+    bool empty() const;
+
+    /// @brief Will return the begin iterator.
+    /// @return The begin iterator.
+    Iterator begin() const;
+
+    /// @brief Will return the end iterator.
+    /// @return The end iterator.
+    Iterator end() const;
+
+    /// @brief Will return a view onto a part of the array.
+    /// @param[in] offset The index of the first item.
+    /// @param[in] count  The number of items.
+    /// @return The view.
+    TMutableSpan subspan(size_t offset, size_t count) const;
+
+    /// @brief Will return the item at the given index.
+    /// @param index The item index, must be less than size.
+    /// @return The item at the given index.
+    T &operator[](size_t index) const;
+
+    /// @brief Will return the read-only view.
+    operator TSpan<T>() const;
+
+private:
+    T *mData{nullptr};
+    size_t mSize{0u};
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TStridedSpan
+///	@ingroup	CPPCore
+///
+///	@brief  This class implements a view onto items, which are stored with a fixed byte distance.
+///
+/// Use it to walk a column of interleaved data, like one member of an array of structs, without
+/// copying it. Use a const type for a read-only view.
+/// @code
+/// struct Particle { float x, y, z; uint32_t flags; };
+/// TStridedSpan<float> heights = makeColumnSpan(particles, numParticles, &Particle::y);
+/// for (float &y : heights) {
+///     y -= 9.81f * dt;
+/// }
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+template<class T>
+class TStridedSpan {
+    using BytePtr = typename std::conditional<std::is_const<T>::value, const unsigned char *, unsigned char *>::type;
+
+public:
+    /// @brief The iterator, which steps by the stride.
+    class Iterator {
+    public:
+        Iterator() = default;
+        Iterator(BytePtr ptr, size_t stride);
+        T &operator*() const;
+        T *operator->() const;
+        Iterator &operator++();
+        bool operator == (const Iterator &rhs) const;
+        bool operator != (const Iterator &rhs) const;
+
+    private:
+        BytePtr mPtr{nullptr};
+        size_t mStride{0u};
+    };
+
+    /// @brief The default class constructor.
+    TStridedSpan() = default;
+
+    /// @brief The class constructor.
+    /// @param[in] ptr     The pointer to the first item.
+    /// @param[in] size    The number of items.
+    /// @param[in] stride  The distance between two items in bytes.
+    TStridedSpan(T *ptr, size_t size, size_t stride);
+
+    /// @brief The class constructor for contiguous items.
+    /// @param[in] span    The items.
+    TStridedSpan(const TMutableSpan<T> &span);
+
+    /// @brief The class destructor.
+    ~TStridedSpan() = default;
+
+    /// @brief Will return the pointer to the first item.
+    /// @return The pointer or nullptr, if no data was set.
+    T *data() const;
+
+    /// @brief Will return the number of items in the view.
+    /// @return The number of items.
+    size_t size() const;
+
+    /// @brief Will return the distance between two items in bytes.
+    /// @return The stride.
+    size_t stride() const;
+
+    /// @brief Will return true, if the items are stored without gaps.
+    /// @return true for contiguous items.
+    bool isContiguous() const;
+
+    /// @brief Will return true, if the span view is empty.
+    /// @return true for empty.
+    bool empty() const;
+
+    /// @brief Will return the begin iterator.
+    /// @return The begin iterator.
+    Iterator begin() const;
+
+    /// @brief Will return the end iterator.
+    /// @return The end iterator.
+    Iterator end() const;
+
+    /// @brief Will return the item at the given index.
+    /// @param index The item index, must be less than size.
+    /// @return The item at the given index.
+    T &operator[](size_t index) const;
+
+private:
+    BytePtr mData{nullptr};
+    size_t mSize{0u};
+    size_t mStride{sizeof(T)};
+};
+
+/// @brief Will return the view onto one member of an array of structs.
+/// @param[in] items   The array of structs.
+/// @param[in] count   The number of structs.
+/// @param[in] member  The member.
+/// @return The view onto the member column.
+template<class TStruct, class TMember>
+inline TStridedSpan<TMember> makeColumnSpan(TStruct *items, size_t count, TMember TStruct::*member) {
+    if (items == nullptr) {
+        return TStridedSpan<TMember>();
+    }
+    return TStridedSpan<TMember>(&(items->*member), count, sizeof(TStruct));
+}
+
+/// @brief Will return the read-only view onto one member of an array of structs.
+/// @param[in] items   The array of structs.
+/// @param[in] count   The number of structs.
+/// @param[in] member  The member.
+/// @return The view onto the member column.
+template<class TStruct, class TMember>
+inline TStridedSpan<const TMember> makeColumnSpan(const TStruct *items, size_t count, TMember TStruct::*member) {
+    if (items == nullptr) {
+        return TStridedSpan<const TMember>();
+    }
+    return TStridedSpan<const TMember>(&(items->*member), count, sizeof(TStruct));
+}
+
 template<class T>
 inline TSpan<T>::TSpan(const T *ptr, size_t size) : mData(ptr), mSize(size) {
     // empty
@@ -107,28 +295,158 @@ inline bool TSpan<T>::empty() const {
 }
 
 template<class T>
-inline typename TSpan<T>::Iterator TSpan<T>::begin() {
-    return &mData[0];
+inline typename TSpan<T>::Iterator TSpan<T>::begin() const {
+    return mData;
 }
 
 template<class T>
-inline typename TSpan<T>::Iterator TSpan<T>::end() {
+inline typename TSpan<T>::Iterator TSpan<T>::end() const {
     return mData + mSize;
 }
 
 template<class T>
-inline T TSpan<T>::operator[](size_t index) {
-    if (index >= mSize) {
-        return std::numeric_limits<T>::max();
-    }
-    return mData[index];
+inline TSpan<T> TSpan<T>::subspan(size_t offset, size_t count) const {
+    assert(offset <= mSize && count <= mSize - offset);
+    return TSpan(mData + offset, count);
 }
 
 template<class T>
-inline const T TSpan<T>::operator[](size_t index) const {
+inline const T &TSpan<T>::operator[](size_t index) const {
+    assert(index < mSize);
     return mData[index]; 
 }
 
+template<class T>
+inline TMutableSpan<T>::TMutableSpan(T *ptr, size_t size) : mData(ptr), mSize(size) {
+    // empty
+}
+
+template<class T>
+inline T *TMutableSpan<T>::data() const {
+    return mData;
+}
+
+template<class T>
+inline size_t TMutableSpan<T>::size() const {
+    return mSize;
+}
+
+template<class T>
+inline bool TMutableSpan<T>::empty() const {
+    return mSize == 0;
+}
+
+template<class T>
+inline typename TMutableSpan<T>::Iterator TMutableSpan<T>::begin() const {
+    return mData;
+}
+
+template<class T>
+inline typename TMutableSpan<T>::Iterator TMutableSpan<T>::end() const {
+    return mData + mSize;
+}
+
+template<class T>
+inline TMutableSpan<T> TMutableSpan<T>::subspan(size_t offset, size_t count) const {
+    assert(offset <= mSize && count <= mSize - offset);
+    return TMutableSpan(mData + offset, count);
+}
+
+template<class T>
+inline T &TMutableSpan<T>::operator[](size_t index) const {
+    assert(index < mSize);
+    return mData[index];
+}
+
+template<class T>
+inline TMutableSpan<T>::operator TSpan<T>() const {
+    return TSpan<T>(mData, mSize);
+}
+
+template<class T>
+inline TStridedSpan<T>::Iterator::Iterator(BytePtr ptr, size_t stride) : mPtr(ptr), mStride(stride) {
+    // empty
+}
+
+template<class T>
+inline T &TStridedSpan<T>::Iterator::operator*() const {
+    return *reinterpret_cast<T *>(mPtr);
+}
+
+template<class T>
+inline T *TStridedSpan<T>::Iterator::operator->() const {
+    return reinterpret_cast<T *>(mPtr);
+}
+
+template<class T>
+inline typename TStridedSpan<T>::Iterator &TStridedSpan<T>::Iterator::operator++() {
+    mPtr += mStride;
+    return *this;
+}
+
+template<class T>
+inline bool TStridedSpan<T>::Iterator::operator == (const Iterator &rhs) const {
+    return mPtr == rhs.mPtr;
+}
+
+template<class T>
+inline bool TStridedSpan<T>::Iterator::operator != (const Iterator &rhs) const {
+    return mPtr != rhs.mPtr;
+}
+
+template<class T>
+inline TStridedSpan<T>::TStridedSpan(T *ptr, size_t size, size_t stride) :
+        mData(reinterpret_cast<BytePtr>(ptr)), mSize(size), mStride(stride) {
+    assert(stride >= sizeof(T) || size <= 1);
+}
+
+template<class T>
+inline TStridedSpan<T>::TStridedSpan(const TMutableSpan<T> &span) :
+        mData(reinterpret_cast<BytePtr>(span.data())), mSize(span.size()), mStride(sizeof(T)) {
+    // empty
+}
+
+template<class T>
+inline T *TStridedSpan<T>::data() const {
+    return reinterpret_cast<T *>(mData);
+}
+
+template<class T>
+inline size_t TStridedSpan<T>::size() const {
+    return mSize;
+}
+
+template<class T>
+inline size_t TStridedSpan<T>::stride() const {
+    return mStride;
+}
+
+template<class T>
+inline bool TStridedSpan<T>::isContiguous() const {
+    return mStride == sizeof(T);
+}
+
+template<class T>
+inline bool TStridedSpan<T>::empty() const {
+    return mSize == 0;
+}
+
+template<class T>
+inline typename TStridedSpan<T>::Iterator TStridedSpan<T>::begin() const {
+    return Iterator(mData, mStride);
+}
+
+template<class T>
+inline typename TStridedSpan<T>::Iterator TStridedSpan<T>::end() const {
+    return Iterator(mData + mSize * mStride, mStride);
+}
+
+template<class T>
+inline T &TStridedSpan<T>::operator[](size_t index) const {
+    assert(index < mSize);
+    return *reinterpret_cast<T *>(mData + index * mStride);
+}
+
 } // namespace cppcore
 
 #endif // CPPCORE_COMMON_TSPAN_H
\ No newline at end of file
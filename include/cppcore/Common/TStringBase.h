@@ -22,9 +22,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #pragma once
 
-#include "string.h"
-#include <cppcore/Common/Hash.h>
 #include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/Hash.h>
+
+#include <atomic>
+#include <string.h>
+#include <utility>
 
 namespace cppcore {
 
@@ -33,18 +36,33 @@ namespace cppcore {
 ///	@ingroup    CPPCore
 ///
 ///	@brief  This class is used to describe the inner data of a string.
+///
+/// The object has a size of 32 bytes. Short strings are stored inline, up to 23 chars for char
+/// strings, longer ones in a heap buffer which grows geometrically. The 64-bit hash of heap strings
+/// is cached until the next modification, short strings will compute it on demand.
 //-------------------------------------------------------------------------------------------------
 template <class T>
 class TStringBase {
 public:
+    /// @brief  The number of characters which are stored without a heap allocation.
+    static constexpr size_t InlineCapacity = (32 - sizeof(size_t)) / sizeof(T) - 1;
+
     /// @brief  The default class constructor.
-    TStringBase() noexcept = default;
+    TStringBase() noexcept;
 
     /// @brief  The class constructor with a pointer showing to the data buffer.
     /// @param[in] ptr    The data buffer.
     /// @param[in] size    The buffer size.
     TStringBase(const T *ptr, size_t size);
 
+    /// @brief  The copy constructor.
+    /// @param[in] rhs  The string to copy.
+    TStringBase(const TStringBase<T> &rhs);
+
+    /// @brief  The move constructor, rhs will be empty afterwards.
+    /// @param[in] rhs  The string to move.
+    TStringBase(TStringBase<T> &&rhs) noexcept;
+
     /// @brief  The class destructor.
     ~TStringBase();
 
@@ -53,7 +71,7 @@ public:
     /// @param size     Size of the buffer.
     void set(const T *ptr, size_t size);
 
-    /// @brief Will clear the string buffer.
+    /// @brief Will clear the string buffer, the heap buffer will be released.
     void clear();
 
     /// @brief Will reset the string buffer, not internal storage will be released.
@@ -71,6 +89,21 @@ public:
     /// @return The capacity of the string
     size_t capacity() const;
 
+    /// @brief Will ensure that the string can store the given number of chars without growing.
+    /// @param capacity The requested capacity.
+    void reserve(size_t capacity);
+
+    /// @brief Will append chars to the string, the buffer grows geometrically.
+    /// @param ptr      Pointer to the chars, may point into the string itself.
+    /// @param size     The number of chars.
+    void append(const T *ptr, size_t size);
+
+    /// @brief  Will return the 64-bit hash of the string, see hash64.
+    /// @return The hash.
+    /// @remark Can be called from several threads on a shared const string, the cache is a
+    ///         relaxed atomic. Threads computing it at the same time will store the same value.
+    HashId hash() const;
+
     /// @brief  Will return the string pointer.
     /// @return The string pointer. 
     const T *c_str() const;
@@ -79,121 +112,257 @@ public:
     /// @param  base        [inout] The string data to copy in.
     /// @param  pPtr        [in] The data source.
     static void copyFrom(TStringBase<T> &base, const T *pPtr, size_t size);
-     
+
+    /// @brief  The copy assignment operator.
+    TStringBase<T> &operator = (const TStringBase<T> &rhs);
+
+    /// @brief  The move assignment operator, rhs will be empty afterwards.
+    TStringBase<T> &operator = (TStringBase<T> &&rhs) noexcept;
+
     /// @brief Compare operator.
     bool operator == (const TStringBase<T> &rhs) const;
 
     /// @brief Not equal operator.
     bool operator != (const TStringBase<T> &rhs) const;
 
+    /// @brief Will append a string.
     TStringBase<T> &operator += (const TStringBase<T> &rhs);
+
+    /// @brief Will append a single char.
     TStringBase<T> &operator+=(char c);
+
     T operator[](size_t index) const;
 
 private:
-    static constexpr size_t InitSize = 512;
-    T mBuffer[InitSize] = {'\0'};
-    T *mStringBuffer{nullptr};
-    size_t mSize{0};
-    size_t mCapacity{InitSize};
-    HashId mHashId{0};
+    bool isHeap() const;
+    T *data();
+    void invalidateHash();
+    size_t growCapacity(size_t required) const;
+    void adopt(T *ptr, size_t capacity);
+    void release();
+
+private:
+    static constexpr size_t HeapFlag = static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1);
+
+    struct HeapStorage {
+        T *mPtr;
+        size_t mCapacity;
+        // 0 means not computed yet
+        mutable std::atomic<HashId> mHash;
+    };
+
+    union {
+        T mInline[InlineCapacity + 1];
+        HeapStorage mHeap;
+    };
+    // The highest bit marks heap storage
+    size_t mSize;
 };
 
 template <class T>
-inline TStringBase<T>::TStringBase(const T *ptr, size_t size) {
+constexpr size_t TStringBase<T>::InlineCapacity;
+
+template <class T>
+constexpr size_t TStringBase<T>::HeapFlag;
+
+template <class T>
+inline TStringBase<T>::TStringBase() noexcept :
+        mSize(0) {
+    mInline[0] = '\0';
+}
+
+template <class T>
+inline TStringBase<T>::TStringBase(const T *ptr, size_t size) :
+        TStringBase() {
     copyFrom(*this, ptr, size);
-    mHashId = THash<HashId>::toHash(c_str(), size);
+}
+
+template <class T>
+inline TStringBase<T>::TStringBase(const TStringBase<T> &rhs) :
+        TStringBase() {
+    copyFrom(*this, rhs.c_str(), rhs.size());
+}
+
+template <class T>
+inline TStringBase<T>::TStringBase(TStringBase<T> &&rhs) noexcept :
+        TStringBase() {
+    *this = std::move(rhs);
 }
 
 template <class T>
 inline TStringBase<T>::~TStringBase() {
-    clear();
+    release();
 }
 
 template <class T>
 inline void TStringBase<T>::set(const T *ptr, size_t size) {
-    reset();
-    if (nullptr != ptr) {
-        copyFrom(*this, ptr, size);
-    }
+    // No reset before, ptr may point into this string
+    copyFrom(*this, ptr, size);
 }
 
 template <class T>
 inline void TStringBase<T>::reset() {
-    mSize = 0u;
-    mHashId = 0;
+    mSize &= HeapFlag;
+    data()[0] = '\0';
+    invalidateHash();
 }
 
 template <class T>
 inline size_t TStringBase<T>::size() const {
-    return mSize;
+    return mSize & ~HeapFlag;
 }
 
 template <class T>
 inline bool TStringBase<T>::isEmpty() const {
-    return mSize == 0;
+    return size() == 0;
 }
 
 template <class T>
 inline size_t TStringBase<T>::capacity() const {
-    return mCapacity;
+    return isHeap() ? mHeap.mCapacity : InlineCapacity;
 }
 
 template <class T>
-inline const T *TStringBase<T>::c_str() const {
-    if (mStringBuffer != nullptr) {
-        return mStringBuffer;
+inline void TStringBase<T>::reserve(size_t capacity) {
+    if (capacity <= this->capacity()) {
+        return;
     }
 
-    return mBuffer;
+    const size_t oldSize = size();
+    T *newPtr = new T[capacity + 1];
+    memcpy(newPtr, c_str(), (oldSize + 1) * sizeof(T));
+    adopt(newPtr, capacity);
+    mSize |= oldSize;
 }
 
 template <class T>
-inline void TStringBase<T>::clear() {
-    if (mStringBuffer != nullptr) {
-        delete [] mStringBuffer;
-        mStringBuffer = nullptr;
-        mCapacity = InitSize;
+inline void TStringBase<T>::append(const T *ptr, size_t size) {
+    if (ptr == nullptr || size == 0) {
+        return;
+    }
+
+    const size_t oldSize = this->size();
+    const size_t newSize = oldSize + size;
+    if (newSize > capacity()) {
+        const size_t newCapacity = growCapacity(newSize);
+        T *newPtr = new T[newCapacity + 1];
+        if (isHeap()) {
+            memcpy(newPtr, mHeap.mPtr, oldSize * sizeof(T));
+        } else {
+            // The new buffer is bigger than the inline one, a fixed size copy is cheaper
+            memcpy(newPtr, mInline, sizeof(mInline));
+        }
+        // Copy before releasing, ptr may point into the old buffer
+        memcpy(newPtr + oldSize, ptr, size * sizeof(T));
+        adopt(newPtr, newCapacity);
+    } else {
+        memmove(data() + oldSize, ptr, size * sizeof(T));
+        invalidateHash();
     }
-    reset();
+    data()[newSize] = '\0';
+    mSize = (mSize & HeapFlag) | newSize;
+}
+
+template <class T>
+inline HashId TStringBase<T>::hash() const {
+    if (!isHeap()) {
+        // Inline strings are never longer, the bound keeps the compiler from assuming otherwise
+        const size_t len = size();
+        return hash64(mInline, (len < InlineCapacity ? len : InlineCapacity) * sizeof(T));
+    }
+
+    HashId hash = mHeap.mHash.load(std::memory_order_relaxed);
+    if (hash == 0) {
+        hash = hash64(mHeap.mPtr, size() * sizeof(T));
+        mHeap.mHash.store(hash, std::memory_order_relaxed);
+    }
+
+    return hash;
+}
+
+template <class T>
+inline const T *TStringBase<T>::c_str() const {
+    return isHeap() ? mHeap.mPtr : mInline;
+}
+
+template <class T>
+inline void TStringBase<T>::clear() {
+    release();
+    mSize = 0;
+    mInline[0] = '\0';
 }
 
 template <class T>
 inline void TStringBase<T>::copyFrom(TStringBase<T> &base, const T *ptr, size_t size) {
-    if (ptr == nullptr) {
+    if (ptr == nullptr || size == 0) {
+        base.reset();
         return;
     }
 
-    T *targetPtr = base.mBuffer;
-    if (size == 0) {
-        return;
+    if (size > base.capacity()) {
+        const size_t newCapacity = base.growCapacity(size);
+        T *newPtr = new T[newCapacity + 1];
+        memcpy(newPtr, ptr, size * sizeof(T));
+        newPtr[size] = '\0';
+        base.adopt(newPtr, newCapacity);
+    } else if (base.isHeap()) {
+        // The source may be a part of this string
+        memmove(base.mHeap.mPtr, ptr, size * sizeof(T));
+        base.mHeap.mPtr[size] = '\0';
+        base.invalidateHash();
+    } else {
+        memmove(base.mInline, ptr, size * sizeof(T));
+        base.mInline[size] = '\0';
     }
+    base.mSize = (base.mSize & HeapFlag) | size;
+}
 
-    if (size > base.mCapacity) {
-        if (base.mStringBuffer != nullptr) {
-            delete [] base.mStringBuffer;
-        }
-        base.mStringBuffer = new T[size + 1];
-        base.mCapacity = size + 1;
-        targetPtr = base.mStringBuffer;
+template <class T>
+inline TStringBase<T> &TStringBase<T>::operator = (const TStringBase<T> &rhs) {
+    if (this != &rhs) {
+        copyFrom(*this, rhs.c_str(), rhs.size());
     }
-    memcpy(targetPtr, ptr, size * sizeof(T));
-    targetPtr[size] = '\0';
-    base.mSize = size;
+
+    return *this;
+}
+
+template <class T>
+inline TStringBase<T> &TStringBase<T>::operator = (TStringBase<T> &&rhs) noexcept {
+    if (this == &rhs) {
+        return *this;
+    }
+
+    release();
+    if (rhs.isHeap()) {
+        mHeap.mPtr = rhs.mHeap.mPtr;
+        mHeap.mCapacity = rhs.mHeap.mCapacity;
+        mHeap.mHash.store(rhs.mHeap.mHash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    } else {
+        memcpy(mInline, rhs.mInline, (rhs.size() + 1) * sizeof(T));
+    }
+    mSize = rhs.mSize;
+    rhs.mSize = 0;
+    rhs.mInline[0] = '\0';
+
+    return *this;
 }
 
 template <class T>
 inline bool TStringBase<T>::operator == (const TStringBase<T> &rhs) const {
-    if (rhs.mSize != mSize) {
+    if (rhs.size() != size()) {
         return false;
     }
 
-    if (mHashId != rhs.mHashId) {
-        return false;
+    // Cached hashes are cheap to compare, computing them is not worth it here
+    if (isHeap() && rhs.isHeap()) {
+        const HashId hash = mHeap.mHash.load(std::memory_order_relaxed);
+        const HashId rhsHash = rhs.mHeap.mHash.load(std::memory_order_relaxed);
+        if (hash != 0 && rhsHash != 0 && hash != rhsHash) {
+            return false;
+        }
     }
-    
-    // Fallback to actual comparison in case of hash collision
-    return memcmp(c_str(), rhs.c_str(), mSize * sizeof(T)) == 0;
+
+    return memcmp(c_str(), rhs.c_str(), size() * sizeof(T)) == 0;
 }
 
 template <class T>
@@ -207,23 +376,66 @@ inline TStringBase<T> &TStringBase<T>::operator += (const TStringBase<T> &rhs) {
         return *this;
     }
 
-    copyFrom(*this, rhs.c_str(), rhs.size());
+    append(rhs.c_str(), rhs.size());
 
     return *this;
 }
 
 template <class T>
 inline TStringBase<T>& TStringBase<T>::operator+=(char c) {
-    copyFrom(*this, &c, 1);
+    const T value = static_cast<T>(c);
+    append(&value, 1);
     return *this;
 }
 
 template <class T>
 inline T TStringBase<T>::operator[](size_t index) const {
-    if (index >= mSize) {
+    if (index >= size()) {
         return 0;
     }
-    return mBuffer[index];
+    return c_str()[index];
+}
+
+template <class T>
+inline bool TStringBase<T>::isHeap() const {
+    return (mSize & HeapFlag) != 0;
+}
+
+template <class T>
+inline T *TStringBase<T>::data() {
+    return isHeap() ? mHeap.mPtr : mInline;
+}
+
+template <class T>
+inline void TStringBase<T>::invalidateHash() {
+    if (isHeap()) {
+        mHeap.mHash.store(0, std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+inline size_t TStringBase<T>::growCapacity(size_t required) const {
+    // Grow geometrically, so repeated appending has amortized constant costs
+    const size_t doubled = 2 * capacity();
+    return required > doubled ? required : doubled;
+}
+
+template <class T>
+inline void TStringBase<T>::adopt(T *ptr, size_t capacity) {
+    release();
+    mHeap.mPtr = ptr;
+    mHeap.mCapacity = capacity;
+    mHeap.mHash.store(0, std::memory_order_relaxed);
+    mSize = HeapFlag;
+}
+
+template <class T>
+inline void TStringBase<T>::release() {
+    if (isHeap()) {
+        delete [] mHeap.mPtr;
+        mSize = 0;
+        mInline[0] = '\0';
+    }
 }
 
 } // namespace cppcore
@@ -0,0 +1,253 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/NumberConversion.h>
+#include <cppcore/Common/TStringBase.h>
+#include <cppcore/Common/TStringView.h>
+
+#include <stdio.h>
+#include <type_traits>
+
+namespace cppcore {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TStringBuilder
+///	@ingroup	CPPCore
+///
+///	@brief  Accumulates strings, views, integers and floats in one growing buffer.
+///
+/// build will return the final string with at most one allocation, strings which fit into the
+/// inline buffer of TStringBase need none.
+/// @code
+/// TStringBuilder<char> builder;
+/// builder << "frame " << frameId << ": " << deltaMs << " ms";
+/// TStringBase<char> msg = builder.build();
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+template <class T>
+class TStringBuilder {
+public:
+    /// @brief  The default class constructor.
+    TStringBuilder() = default;
+
+    /// @brief  The class constructor with the initial capacity.
+    /// @param[in] capacity  The number of chars to reserve.
+    explicit TStringBuilder(size_t capacity);
+
+    /// @brief  The class destructor.
+    ~TStringBuilder() = default;
+
+    /// @brief  Will append chars.
+    /// @param[in] ptr   Pointer to the chars.
+    /// @param[in] size  The number of chars.
+    /// @return The builder itself.
+    TStringBuilder &append(const T *ptr, size_t size);
+
+    /// @brief  Will append a zero-terminated string.
+    /// @param[in] str  The string, nullptr will be ignored.
+    /// @return The builder itself.
+    TStringBuilder &append(const T *str);
+
+    /// @brief  Will append a string.
+    /// @param[in] str  The string.
+    /// @return The builder itself.
+    TStringBuilder &append(const TStringBase<T> &str);
+
+    /// @brief  Will append the content of a view.
+    /// @param[in] view  The view.
+    /// @return The builder itself.
+    TStringBuilder &append(const TStringView<T> &view);
+
+    /// @brief  Will append a single char.
+    /// @param[in] c  The char.
+    /// @return The builder itself.
+    TStringBuilder &append(T c);
+
+    /// @brief  Will append the decimal representation of an integer.
+    /// @param[in] value  The integer.
+    /// @return The builder itself.
+    template <class TInt>
+    typename std::enable_if<std::is_integral<TInt>::value, TStringBuilder &>::type append(TInt value);
+
+    /// @brief  Will append a floating point number, formatted like printf with %g.
+    /// @param[in] value      The number.
+    /// @param[in] precision  The number of significant digits, a negative value will write the
+    ///                       shortest digits which parse back to the same value, see formatFloat.
+    /// @return The builder itself.
+    TStringBuilder &append(double value, int precision = 6);
+
+    /// @brief  Will append any of the supported types.
+    template <class TValue>
+    TStringBuilder &operator << (const TValue &value);
+
+    /// @brief  Will return the number of accumulated chars.
+    /// @return The number of chars.
+    size_t size() const;
+
+    /// @brief  Will return true, if nothing was appended.
+    /// @return true for empty.
+    bool isEmpty() const;
+
+    /// @brief  Will reserve buffer space for the given number of chars.
+    /// @param[in] capacity  The number of chars.
+    void reserve(size_t capacity);
+
+    /// @brief  Will remove all chars, the buffer will be kept for reuse.
+    void reset();
+
+    /// @brief  Will return a view onto the accumulated chars.
+    /// @return The view, valid until the next modification.
+    TStringView<T> view() const;
+
+    /// @brief  Will create the final string.
+    /// @return The string, with at most one allocation.
+    TStringBase<T> build() const;
+
+private:
+    TStringBase<T> mBuffer;
+};
+
+template <class T>
+inline TStringBuilder<T>::TStringBuilder(size_t capacity) {
+    mBuffer.reserve(capacity);
+}
+
+template <class T>
+inline TStringBuilder<T> &TStringBuilder<T>::append(const T *ptr, size_t size) {
+    mBuffer.append(ptr, size);
+    return *this;
+}
+
+template <class T>
+inline TStringBuilder<T> &TStringBuilder<T>::append(const T *str) {
+    if (str == nullptr) {
+        return *this;
+    }
+
+    size_t len = 0;
+    while (str[len] != '\0') {
+        ++len;
+    }
+    mBuffer.append(str, len);
+    return *this;
+}
+
+template <class T>
+inline TStringBuilder<T> &TStringBuilder<T>::append(const TStringBase<T> &str) {
+    mBuffer.append(str.c_str(), str.size());
+    return *this;
+}
+
+template <class T>
+inline TStringBuilder<T> &TStringBuilder<T>::append(const TStringView<T> &view) {
+    mBuffer.append(view.data(), view.size());
+    return *this;
+}
+
+template <class T>
+inline TStringBuilder<T> &TStringBuilder<T>::append(T c) {
+    mBuffer.append(&c, 1);
+    return *this;
+}
+
+template <class T>
+template <class TInt>
+inline typename std::enable_if<std::is_integral<TInt>::value, TStringBuilder<T> &>::type
+TStringBuilder<T>::append(TInt value) {
+    using TUnsigned = typename std::make_unsigned<TInt>::type;
+    // The negation is done unsigned, so the minimum value will not overflow
+    const bool negative = value < static_cast<TInt>(0);
+    TUnsigned abs = negative ? static_cast<TUnsigned>(0u - static_cast<TUnsigned>(value)) : static_cast<TUnsigned>(value);
+
+    T digits[24];
+    size_t pos = sizeof(digits) / sizeof(T);
+    do {
+        digits[--pos] = static_cast<T>('0' + abs % 10u);
+        abs /= 10u;
+    } while (abs != 0u);
+    if (negative) {
+        digits[--pos] = static_cast<T>('-');
+    }
+    mBuffer.append(digits + pos, sizeof(digits) / sizeof(T) - pos);
+
+    return *this;
+}
+
+template <class T>
+inline TStringBuilder<T> &TStringBuilder<T>::append(double value, int precision) {
+    char buffer[64];
+    const int len = precision < 0 ? static_cast<int>(formatFloat(value, buffer, sizeof(buffer))) :
+            snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+    if (len <= 0) {
+        return *this;
+    }
+
+    T chars[64];
+    const size_t numChars = static_cast<size_t>(len) < sizeof(buffer) ? static_cast<size_t>(len) : sizeof(buffer) - 1;
+    for (size_t i = 0; i < numChars; ++i) {
+        chars[i] = static_cast<T>(buffer[i]);
+    }
+    mBuffer.append(chars, numChars);
+
+    return *this;
+}
+
+template <class T>
+template <class TValue>
+inline TStringBuilder<T> &TStringBuilder<T>::operator << (const TValue &value) {
+    return append(value);
+}
+
+template <class T>
+inline size_t TStringBuilder<T>::size() const {
+    return mBuffer.size();
+}
+
+template <class T>
+inline bool TStringBuilder<T>::isEmpty() const {
+    return mBuffer.isEmpty();
+}
+
+template <class T>
+inline void TStringBuilder<T>::reserve(size_t capacity) {
+    mBuffer.reserve(capacity);
+}
+
+template <class T>
+inline void TStringBuilder<T>::reset() {
+    mBuffer.reset();
+}
+
+template <class T>
+inline TStringView<T> TStringBuilder<T>::view() const {
+    return TStringView<T>(mBuffer.c_str(), mBuffer.size());
+}
+
+template <class T>
+inline TStringBase<T> TStringBuilder<T>::build() const {
+    return TStringBase<T>(mBuffer.c_str(), mBuffer.size());
+}
+
+} // namespace cppcore
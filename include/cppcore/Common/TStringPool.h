@@ -0,0 +1,277 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/Hash.h>
+#include <cppcore/Common/TStringBase.h>
+#include <cppcore/Common/TStringView.h>
+#include <cppcore/Container/TArray.h>
+
+#include <string.h>
+
+namespace cppcore {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TStringPool
+///	@ingroup	CPPCore
+///
+///	@brief  Interns strings, equal strings will be stored once and get the same id.
+///
+/// The chars are stored in chunks which will never move, so pointers returned by c_str stay valid
+/// until clear is called or the pool is destroyed. Interned strings can be compared by id or by
+/// pointer instead of comparing the chars.
+/// @code
+/// TStringPool<char> pool;
+/// const TStringPool<char>::Id id = pool.intern("textures/stone.png", 18);
+/// if (pool.intern(path.c_str(), path.size()) == id) {
+///     ...
+/// }
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+template <class T>
+class TStringPool {
+public:
+    /// @brief  The id type of interned strings.
+    using Id = uint32_t;
+
+    /// @brief  The id for strings which were not interned.
+    static constexpr Id InvalidId = ~0u;
+
+    /// @brief  The number of chars per storage chunk, longer strings get their own chunk.
+    static constexpr size_t ChunkSize = 4096;
+
+    /// @brief  The default class constructor.
+    TStringPool() = default;
+
+    /// @brief  The class destructor.
+    ~TStringPool();
+
+    /// @brief  Will intern a string.
+    /// @param[in] ptr   Pointer to the chars.
+    /// @param[in] size  The number of chars.
+    /// @return The id of the string, equal strings will get the same id.
+    Id intern(const T *ptr, size_t size);
+
+    /// @brief  Will intern a string.
+    /// @param[in] str  The string.
+    /// @return The id of the string, equal strings will get the same id.
+    Id intern(const TStringBase<T> &str);
+
+    /// @brief  Will look for a string without interning it.
+    /// @param[in] ptr   Pointer to the chars.
+    /// @param[in] size  The number of chars.
+    /// @return The id of the string or InvalidId, if it was not interned.
+    Id find(const T *ptr, size_t size) const;
+
+    /// @brief  Will return the zero-terminated chars of an interned string.
+    /// @param[in] id  The id of the string.
+    /// @return The chars, equal strings will return the same pointer.
+    const T *c_str(Id id) const;
+
+    /// @brief  Will return a view onto an interned string.
+    /// @param[in] id  The id of the string.
+    /// @return The view.
+    TStringView<T> view(Id id) const;
+
+    /// @brief  Will return the number of interned strings.
+    /// @return The number of strings.
+    size_t size() const;
+
+    /// @brief  Will return true, if no string was interned.
+    /// @return true for empty.
+    bool isEmpty() const;
+
+    /// @brief  Will release all strings, all ids and pointers will get invalid.
+    void clear();
+
+    /// No copying allowed
+    CPPCORE_NONE_COPYING(TStringPool)
+
+private:
+    struct Entry {
+        const T *mPtr;
+        size_t mSize;
+        HashId mHash;
+    };
+
+    static HashId hashOf(const T *ptr, size_t size);
+    Id internHashed(const T *ptr, size_t size, HashId hash);
+    size_t findSlot(const T *ptr, size_t size, HashId hash) const;
+    T *store(const T *ptr, size_t size);
+    void rehash(size_t numSlots);
+
+private:
+    TArray<Entry> mEntries;
+    // Open addressing with linear probing, the slots store ids
+    TArray<Id> mSlots;
+    TArray<T*> mChunks;
+    T *mChunkPtr{nullptr};
+    size_t mChunkFree{0};
+};
+
+template <class T>
+constexpr typename TStringPool<T>::Id TStringPool<T>::InvalidId;
+
+template <class T>
+constexpr size_t TStringPool<T>::ChunkSize;
+
+template <class T>
+inline TStringPool<T>::~TStringPool() {
+    clear();
+}
+
+template <class T>
+inline typename TStringPool<T>::Id TStringPool<T>::intern(const T *ptr, size_t size) {
+    return internHashed(ptr, size, hashOf(ptr, size));
+}
+
+template <class T>
+inline typename TStringPool<T>::Id TStringPool<T>::intern(const TStringBase<T> &str) {
+    // The cached hash of the string is the same hash64 over the same bytes
+    return internHashed(str.c_str(), str.size(), str.hash());
+}
+
+template <class T>
+inline typename TStringPool<T>::Id TStringPool<T>::internHashed(const T *ptr, size_t size, HashId hash) {
+    // Keep the load factor below 1/2
+    if (2 * (mEntries.size() + 1) > mSlots.size()) {
+        rehash(mSlots.isEmpty() ? 64 : 2 * mSlots.size());
+    }
+
+    const size_t slot = findSlot(ptr, size, hash);
+    if (mSlots[slot] != InvalidId) {
+        return mSlots[slot];
+    }
+
+    const Id id = static_cast<Id>(mEntries.size());
+    mEntries.add(Entry{ store(ptr, size), size, hash });
+    mSlots[slot] = id;
+
+    return id;
+}
+
+template <class T>
+inline typename TStringPool<T>::Id TStringPool<T>::find(const T *ptr, size_t size) const {
+    if (mSlots.isEmpty()) {
+        return InvalidId;
+    }
+
+    return mSlots[findSlot(ptr, size, hashOf(ptr, size))];
+}
+
+template <class T>
+inline const T *TStringPool<T>::c_str(Id id) const {
+    assert(id < mEntries.size());
+    return mEntries[id].mPtr;
+}
+
+template <class T>
+inline TStringView<T> TStringPool<T>::view(Id id) const {
+    assert(id < mEntries.size());
+    return TStringView<T>(mEntries[id].mPtr, mEntries[id].mSize);
+}
+
+template <class T>
+inline size_t TStringPool<T>::size() const {
+    return mEntries.size();
+}
+
+template <class T>
+inline bool TStringPool<T>::isEmpty() const {
+    return mEntries.isEmpty();
+}
+
+template <class T>
+inline void TStringPool<T>::clear() {
+    for (size_t i = 0; i < mChunks.size(); ++i) {
+        delete [] mChunks[i];
+    }
+    mChunks.clear();
+    mEntries.clear();
+    mSlots.clear();
+    mChunkPtr = nullptr;
+    mChunkFree = 0;
+}
+
+template <class T>
+inline HashId TStringPool<T>::hashOf(const T *ptr, size_t size) {
+    return hash64(ptr, size * sizeof(T));
+}
+
+template <class T>
+inline size_t TStringPool<T>::findSlot(const T *ptr, size_t size, HashId hash) const {
+    const size_t mask = mSlots.size() - 1;
+    size_t slot = static_cast<size_t>(hash) & mask;
+    while (mSlots[slot] != InvalidId) {
+        const Entry &entry = mEntries[mSlots[slot]];
+        if (entry.mHash == hash && entry.mSize == size && memcmp(entry.mPtr, ptr, size * sizeof(T)) == 0) {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+template <class T>
+inline T *TStringPool<T>::store(const T *ptr, size_t size) {
+    const size_t required = size + 1;
+    T *target = nullptr;
+    if (required > ChunkSize / 4) {
+        // Large strings get their own chunk, so the current chunk will not be wasted
+        target = new T[required];
+        mChunks.add(target);
+    } else {
+        if (required > mChunkFree) {
+            mChunkPtr = new T[ChunkSize];
+            mChunkFree = ChunkSize;
+            mChunks.add(mChunkPtr);
+        }
+        target = mChunkPtr;
+        mChunkPtr += required;
+        mChunkFree -= required;
+    }
+    if (size != 0) {
+        memcpy(target, ptr, size * sizeof(T));
+    }
+    target[size] = '\0';
+
+    return target;
+}
+
+template <class T>
+inline void TStringPool<T>::rehash(size_t numSlots) {
+    mSlots.resize(numSlots);
+    mSlots.set(InvalidId);
+    const size_t mask = numSlots - 1;
+    for (size_t id = 0; id < mEntries.size(); ++id) {
+        size_t slot = static_cast<size_t>(mEntries[id].mHash) & mask;
+        while (mSlots[slot] != InvalidId) {
+            slot = (slot + 1) & mask;
+        }
+        mSlots[slot] = static_cast<Id>(id);
+    }
+}
+
+} // namespace cppcore
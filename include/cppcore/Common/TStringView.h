@@ -24,19 +24,165 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <cppcore/CPPCoreCommon.h>
 
+#include <string.h>
+
 namespace cppcore {
 
+namespace Details {
+
+/// @brief  Byte search primitives with SSE4.2/AVX2 kernels, all return len if nothing was found.
+DLL_CPPCORE_EXPORT size_t findByte(const char *data, size_t len, char value);
+DLL_CPPCORE_EXPORT size_t findLastByte(const char *data, size_t len, char value);
+
+/// @brief  The smallest position buffer for findAllBytes.
+static constexpr size_t MinBatchSize = 32;
+
+/// @brief  Will collect the positions of a byte, returns the number of scanned bytes. All matches
+///         in the scanned range are stored in positions, the scan stops before it would overflow.
+DLL_CPPCORE_EXPORT size_t findAllBytes(const char *data, size_t len, char value, uint32_t *positions,
+        size_t maxPositions, size_t &numFound);
+DLL_CPPCORE_EXPORT size_t findBytes(const char *data, size_t len, const char *needle, size_t needleLen);
+DLL_CPPCORE_EXPORT size_t findFirstOfBytes(const char *data, size_t len, const char *chars, size_t numChars);
+
+/// @brief  Counts the bytes which are no UTF-8 continuation bytes, see Unicode.h.
+DLL_CPPCORE_EXPORT size_t countUtf8CodePoints(const char *data, size_t len);
+
+template <class T>
+inline size_t stringLength(const T *str) {
+    size_t len = 0;
+    while (str[len] != '\0') {
+        ++len;
+    }
+    return len;
+}
+
+inline size_t stringLength(const char *str) {
+    // Known to the compiler, so the length of literals is a constant
+    return ::strlen(str);
+}
+
+template <class T>
+inline size_t findChar(const T *data, size_t len, T value) {
+    for (size_t i = 0; i < len; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return len;
+}
+
+inline size_t findChar(const char *data, size_t len, char value) {
+    return findByte(data, len, value);
+}
+
+template <class T>
+inline size_t findAllChars(const T *data, size_t len, T value, uint32_t *positions, size_t maxPositions, size_t &numFound) {
+    numFound = 0;
+    for (size_t i = 0; i < len; ++i) {
+        if (data[i] == value) {
+            if (numFound == maxPositions) {
+                return i;
+            }
+            positions[numFound++] = static_cast<uint32_t>(i);
+        }
+    }
+    return len;
+}
+
+inline size_t findAllChars(const char *data, size_t len, char value, uint32_t *positions, size_t maxPositions, size_t &numFound) {
+    return findAllBytes(data, len, value, positions, maxPositions, numFound);
+}
+
+template <class T>
+inline size_t findLastChar(const T *data, size_t len, T value) {
+    for (size_t i = len; i > 0; --i) {
+        if (data[i - 1] == value) {
+            return i - 1;
+        }
+    }
+    return len;
+}
+
+inline size_t findLastChar(const char *data, size_t len, char value) {
+    return findLastByte(data, len, value);
+}
+
+template <class T>
+inline size_t findChars(const T *data, size_t len, const T *needle, size_t needleLen) {
+    for (size_t i = 0; i + needleLen <= len; ++i) {
+        if (memcmp(data + i, needle, needleLen * sizeof(T)) == 0) {
+            return i;
+        }
+    }
+    return len;
+}
+
+inline size_t findChars(const char *data, size_t len, const char *needle, size_t needleLen) {
+    return findBytes(data, len, needle, needleLen);
+}
+
+template <class T>
+inline size_t findFirstOfChars(const T *data, size_t len, const T *chars, size_t numChars) {
+    for (size_t i = 0; i < len; ++i) {
+        if (findChar(chars, numChars, data[i]) != numChars) {
+            return i;
+        }
+    }
+    return len;
+}
+
+inline size_t findFirstOfChars(const char *data, size_t len, const char *chars, size_t numChars) {
+    return findFirstOfBytes(data, len, chars, numChars);
+}
+
+template <class T>
+inline size_t countCodePoints(const T *, size_t len) {
+    return len;
+}
+
+inline size_t countCodePoints(const char *data, size_t len) {
+    return countUtf8CodePoints(data, len);
+}
+
+inline size_t countCodePoints(const char16_t *data, size_t len) {
+    // The low surrogate is the second unit of a pair
+    size_t numLow = 0;
+    for (size_t i = 0; i < len; ++i) {
+        numLow += (data[i] & 0xfc00) == 0xdc00 ? 1 : 0;
+    }
+    return len - numLow;
+}
+
+} // namespace Details
+
+template <class T>
+class TStringTokenizer;
+
 //-------------------------------------------------------------------------------------------------
 ///	@class		TStringView
 ///	@ingroup	CPPCore
 ///
-/// @brief  
+/// @brief  A non-owning view onto a string.
+///
+/// The search functions use SSE4.2/AVX2 kernels for char views, so large text buffers can be
+/// searched and split without copying them.
+/// @code
+/// TStringView<char> text(buffer, size);
+/// for (const TStringView<char> &line : text.split('\n')) {
+///     if (line.startsWith("error:")) {
+///         ...
+///     }
+/// }
+/// @endcode
 //-------------------------------------------------------------------------------------------------
 template <class T>
 class TStringView {
 public:
     using const_iterator = const T*;
 
+    /// @brief The position returned by the search functions, if nothing was found.
+    static constexpr size_t NotFound = ~static_cast<size_t>(0);
+
     /// @brief The default constructor.
     TStringView() = default;
 
@@ -44,7 +190,11 @@ public:
     /// @param ptr      Pointer to the buffer
     /// @param len      The buffer size
     TStringView(const T *ptr, size_t len);
-    
+
+    /// @brief The constructor with a zero-terminated string.
+    /// @param str      The string
+    TStringView(const T *str);
+
     /// @brief The class destructor.
     ~TStringView() = default;
 
@@ -69,6 +219,76 @@ public:
     /// @return The end entry
     const_iterator end() const;
 
+    /// @brief Will return the char at the given index.
+    /// @param index    The index, must be less than size.
+    /// @return The char
+    T operator[](size_t index) const;
+
+    /// @brief Will return a part of the view.
+    /// @param offset   The start offset, will be clamped to the size.
+    /// @param len      The length, will be clamped to the rest of the view.
+    /// @return The part of the view
+    TStringView subView(size_t offset, size_t len = NotFound) const;
+
+    /// @brief Will look for the first occurrence of a char.
+    /// @param c        The char to look for.
+    /// @param offset   The offset to start at.
+    /// @return The position or NotFound
+    size_t find(T c, size_t offset = 0) const;
+
+    /// @brief Will look for the first occurrence of a string.
+    /// @param needle   The string to look for.
+    /// @param offset   The offset to start at.
+    /// @return The position or NotFound
+    size_t find(const TStringView &needle, size_t offset = 0) const;
+
+    /// @brief Will look for the last occurrence of a char.
+    /// @param c        The char to look for.
+    /// @return The position or NotFound
+    size_t rfind(T c) const;
+
+    /// @brief Will look for the last occurrence of a string.
+    /// @param needle   The string to look for.
+    /// @return The position or NotFound
+    size_t rfind(const TStringView &needle) const;
+
+    /// @brief Will look for the first char which is one of the given chars.
+    /// @param chars    The chars to look for.
+    /// @param offset   The offset to start at.
+    /// @return The position or NotFound
+    size_t findFirstOf(const TStringView &chars, size_t offset = 0) const;
+
+    /// @brief Will return true, if the view starts with the given string.
+    /// @param prefix   The prefix.
+    /// @return true for a match
+    bool startsWith(const TStringView &prefix) const;
+
+    /// @brief Will return true, if the view ends with the given string.
+    /// @param suffix   The suffix.
+    /// @return true for a match
+    bool endsWith(const TStringView &suffix) const;
+
+    /// @brief Will count the code points, char views are UTF-8 and char16_t views UTF-16.
+    /// @return The number of code points
+    /// @remark The view must be valid, see isValidUtf8. Uses SSE4.2/AVX2 kernels for char views.
+    size_t countCodePoints() const;
+
+    /// @brief Will split the view at each separator, empty tokens will be kept.
+    /// @param separator    The separator.
+    /// @return The tokenizer, which returns views into this view
+    TStringTokenizer<T> split(T separator) const;
+
+    /// @brief Will split the view at any of the delimiters, empty tokens will be skipped.
+    /// @param delimiters   The delimiters.
+    /// @return The tokenizer, which returns views into this view
+    TStringTokenizer<T> tokenize(const TStringView &delimiters) const;
+
+    /// @brief Compares the chars of both views.
+    bool operator == (const TStringView &rhs) const;
+
+    /// @brief Compares the chars of both views.
+    bool operator != (const TStringView &rhs) const;
+
 private:
     const T *mPtr{nullptr};
     size_t mLen{0l};
@@ -80,6 +300,15 @@ inline TStringView<T>::TStringView(const T *ptr, size_t len) :
     // empty
 }
 
+template <class T>
+constexpr size_t TStringView<T>::NotFound;
+
+template <class T>
+inline TStringView<T>::TStringView(const T *str) :
+        mPtr(str), mLen(str != nullptr ? Details::stringLength(str) : 0) {
+    // empty
+}
+
 template <class T>
 inline size_t TStringView<T>::size() const {
     return mLen;
@@ -111,4 +340,305 @@ inline typename TStringView<T>::const_iterator TStringView<T>::end() const {
     return mPtr + mLen;
 }
 
+template <class T>
+inline T TStringView<T>::operator[](size_t index) const {
+    assert(index < mLen);
+    return mPtr[index];
+}
+
+template <class T>
+inline TStringView<T> TStringView<T>::subView(size_t offset, size_t len) const {
+    if (offset > mLen) {
+        offset = mLen;
+    }
+    const size_t rest = mLen - offset;
+    return TStringView<T>(mPtr + offset, len < rest ? len : rest);
+}
+
+template <class T>
+inline size_t TStringView<T>::find(T c, size_t offset) const {
+    if (offset >= mLen) {
+        return NotFound;
+    }
+    const size_t pos = Details::findChar(mPtr + offset, mLen - offset, c);
+    return pos == mLen - offset ? NotFound : offset + pos;
+}
+
+template <class T>
+inline size_t TStringView<T>::find(const TStringView &needle, size_t offset) const {
+    if (offset > mLen) {
+        return NotFound;
+    }
+    if (needle.isEmpty()) {
+        return offset;
+    }
+    const size_t pos = Details::findChars(mPtr + offset, mLen - offset, needle.mPtr, needle.mLen);
+    return pos == mLen - offset ? NotFound : offset + pos;
+}
+
+template <class T>
+inline size_t TStringView<T>::rfind(T c) const {
+    const size_t pos = Details::findLastChar(mPtr, mLen, c);
+    return pos == mLen ? NotFound : pos;
+}
+
+template <class T>
+inline size_t TStringView<T>::rfind(const TStringView &needle) const {
+    if (needle.mLen > mLen) {
+        return NotFound;
+    }
+    if (needle.isEmpty()) {
+        return mLen;
+    }
+
+    // Look for the first char backwards, the rest will only be compared for those candidates
+    size_t end = mLen - needle.mLen + 1;
+    while (end > 0) {
+        const size_t pos = Details::findLastChar(mPtr, end, needle.mPtr[0]);
+        if (pos == end) {
+            break;
+        }
+        if (memcmp(mPtr + pos, needle.mPtr, needle.mLen * sizeof(T)) == 0) {
+            return pos;
+        }
+        end = pos;
+    }
+
+    return NotFound;
+}
+
+template <class T>
+inline size_t TStringView<T>::findFirstOf(const TStringView &chars, size_t offset) const {
+    if (offset >= mLen) {
+        return NotFound;
+    }
+    const size_t pos = Details::findFirstOfChars(mPtr + offset, mLen - offset, chars.mPtr, chars.mLen);
+    return pos == mLen - offset ? NotFound : offset + pos;
+}
+
+template <class T>
+inline bool TStringView<T>::startsWith(const TStringView &prefix) const {
+    if (prefix.isEmpty()) {
+        return true;
+    }
+    return prefix.mLen <= mLen && memcmp(mPtr, prefix.mPtr, prefix.mLen * sizeof(T)) == 0;
+}
+
+template <class T>
+inline bool TStringView<T>::endsWith(const TStringView &suffix) const {
+    if (suffix.isEmpty()) {
+        return true;
+    }
+    return suffix.mLen <= mLen && memcmp(mPtr + mLen - suffix.mLen, suffix.mPtr, suffix.mLen * sizeof(T)) == 0;
+}
+
+template <class T>
+inline size_t TStringView<T>::countCodePoints() const {
+    return Details::countCodePoints(mPtr, mLen);
+}
+
+template <class T>
+inline TStringTokenizer<T> TStringView<T>::split(T separator) const {
+    return TStringTokenizer<T>(*this, separator);
+}
+
+template <class T>
+inline TStringTokenizer<T> TStringView<T>::tokenize(const TStringView &delimiters) const {
+    return TStringTokenizer<T>(*this, delimiters);
+}
+
+template <class T>
+inline bool TStringView<T>::operator == (const TStringView &rhs) const {
+    if (mLen != rhs.mLen) {
+        return false;
+    }
+    return mLen == 0 || memcmp(mPtr, rhs.mPtr, mLen * sizeof(T)) == 0;
+}
+
+template <class T>
+inline bool TStringView<T>::operator != (const TStringView &rhs) const {
+    return !(*this == rhs);
+}
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TStringTokenizer
+///	@ingroup	CPPCore
+///
+/// @brief  Splits a view into tokens without copying or allocating, see TStringView::split.
+///
+/// The tokens are views into the original buffer. It can be used with next or in a range-based
+/// for loop.
+//-------------------------------------------------------------------------------------------------
+template <class T>
+class TStringTokenizer {
+public:
+    /// @brief  The input iterator over the tokens.
+    class Iterator {
+    public:
+        Iterator() = default;
+        explicit Iterator(TStringTokenizer *tokenizer);
+        const TStringView<T> &operator*() const;
+        const TStringView<T> *operator->() const;
+        Iterator &operator++();
+        bool operator == (const Iterator &rhs) const;
+        bool operator != (const Iterator &rhs) const;
+
+    private:
+        TStringTokenizer *mTokenizer{nullptr};
+        TStringView<T> mToken;
+    };
+
+    /// @brief The constructor for a single separator, empty tokens will be kept.
+    /// @param view         The view to split.
+    /// @param separator    The separator.
+    TStringTokenizer(const TStringView<T> &view, T separator);
+
+    /// @brief The constructor for a set of delimiters, empty tokens will be skipped.
+    /// @param view         The view to split.
+    /// @param delimiters   The delimiters.
+    TStringTokenizer(const TStringView<T> &view, const TStringView<T> &delimiters);
+
+    /// @brief Will return the next token.
+    /// @param token    The next token.
+    /// @return false, if there are no more tokens.
+    bool next(TStringView<T> &token);
+
+    /// @brief Will return the iterator to the next token.
+    Iterator begin();
+
+    /// @brief Will return the end iterator.
+    Iterator end();
+
+private:
+    bool nextSeparated(TStringView<T> &token);
+
+private:
+    // Separator positions are found in batches, so short tokens do not pay a search call each
+    static constexpr size_t BatchSize = 64;
+
+    TStringView<T> mRest;
+    TStringView<T> mDelimiters;
+    T mSeparator;
+    bool mSkipEmpty;
+    bool mDone;
+    const T *mScanPtr;
+    const T *mBatchPtr;
+    size_t mNumPositions;
+    size_t mNextPosition;
+    uint32_t mPositions[BatchSize];
+};
+
+template <class T>
+constexpr size_t TStringTokenizer<T>::BatchSize;
+
+template <class T>
+inline TStringTokenizer<T>::Iterator::Iterator(TStringTokenizer *tokenizer) :
+        mTokenizer(tokenizer) {
+    ++(*this);
+}
+
+template <class T>
+inline const TStringView<T> &TStringTokenizer<T>::Iterator::operator*() const {
+    return mToken;
+}
+
+template <class T>
+inline const TStringView<T> *TStringTokenizer<T>::Iterator::operator->() const {
+    return &mToken;
+}
+
+template <class T>
+inline typename TStringTokenizer<T>::Iterator &TStringTokenizer<T>::Iterator::operator++() {
+    if (mTokenizer != nullptr && !mTokenizer->next(mToken)) {
+        mTokenizer = nullptr;
+    }
+    return *this;
+}
+
+template <class T>
+inline bool TStringTokenizer<T>::Iterator::operator == (const Iterator &rhs) const {
+    // All iterators share the state of the tokenizer, so only the end can be told apart
+    return mTokenizer == rhs.mTokenizer;
+}
+
+template <class T>
+inline bool TStringTokenizer<T>::Iterator::operator != (const Iterator &rhs) const {
+    return !(*this == rhs);
+}
+
+template <class T>
+inline TStringTokenizer<T>::TStringTokenizer(const TStringView<T> &view, T separator) :
+        mRest(view), mDelimiters(), mSeparator(separator), mSkipEmpty(false), mDone(view.isEmpty()),
+        mScanPtr(view.begin()), mBatchPtr(view.begin()), mNumPositions(0), mNextPosition(0) {
+    // empty
+}
+
+template <class T>
+inline TStringTokenizer<T>::TStringTokenizer(const TStringView<T> &view, const TStringView<T> &delimiters) :
+        mRest(view), mDelimiters(delimiters), mSeparator(), mSkipEmpty(true), mDone(view.isEmpty()),
+        mScanPtr(view.begin()), mBatchPtr(view.begin()), mNumPositions(0), mNextPosition(0) {
+    // empty
+}
+
+template <class T>
+inline bool TStringTokenizer<T>::next(TStringView<T> &token) {
+    if (!mSkipEmpty) {
+        return nextSeparated(token);
+    }
+
+    while (!mDone) {
+        const size_t pos = mRest.findFirstOf(mDelimiters);
+        if (pos == TStringView<T>::NotFound) {
+            token = mRest;
+            mDone = true;
+        } else {
+            token = mRest.subView(0, pos);
+            mRest = mRest.subView(pos + 1);
+        }
+        if (!token.isEmpty()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <class T>
+inline bool TStringTokenizer<T>::nextSeparated(TStringView<T> &token) {
+    if (mDone) {
+        return false;
+    }
+
+    const T *end = mRest.end();
+    while (mNextPosition == mNumPositions) {
+        if (mScanPtr == end) {
+            // No separator left, the rest is the last token
+            token = mRest;
+            mDone = true;
+            return true;
+        }
+        mBatchPtr = mScanPtr;
+        mScanPtr += Details::findAllChars(mScanPtr, static_cast<size_t>(end - mScanPtr), mSeparator,
+                mPositions, BatchSize, mNumPositions);
+        mNextPosition = 0;
+    }
+
+    const T *separator = mBatchPtr + mPositions[mNextPosition++];
+    const size_t len = static_cast<size_t>(separator - mRest.begin());
+    token = TStringView<T>(mRest.begin(), len);
+    mRest = mRest.subView(len + 1);
+
+    return true;
+}
+
+template <class T>
+inline typename TStringTokenizer<T>::Iterator TStringTokenizer<T>::begin() {
+    return Iterator(this);
+}
+
+template <class T>
+inline typename TStringTokenizer<T>::Iterator TStringTokenizer<T>::end() {
+    return Iterator();
+}
+
 } // namespace cppcore
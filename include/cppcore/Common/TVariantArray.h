@@ -0,0 +1,233 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/TSpan.h>
+#include <cppcore/Common/Variant.h>
+#include <cppcore/Container/TArray.h>
+
+namespace cppcore {
+
+namespace Details {
+
+    // The scalar type and the number of scalars of a variant value type
+    template <class T>
+    struct VariantComponents {
+        using Type = T;
+        static constexpr size_t Count = 1;
+    };
+
+    template <class T, size_t N>
+    struct VariantComponents<TVariantVector<T, N>> {
+        using Type = T;
+        static constexpr size_t Count = N;
+    };
+
+} // namespace Details
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TVariantArray
+///	@ingroup	CPPCore
+///
+///	@brief	An array of variants of the same type, which stores the values unboxed.
+///
+/// The values are stored without the type and size of each variant, so the components of all
+/// values can be processed as one array of scalars. Only fixed-size types are supported.
+/// @code
+/// TVariantArray<Variant::Float3Value> positions;
+/// if (positions.add(args, numArgs)) {
+///     for (float &component : positions.components()) {
+///         component *= scale;
+///     }
+/// }
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+template <class T>
+class TVariantArray {
+    static_assert(TVariantTraits<T>::Type != Variant::String, "Strings are not supported.");
+
+public:
+    /// @brief  The variant type of the values.
+    static constexpr Variant::Type Type = TVariantTraits<T>::Type;
+
+    /// @brief  The scalar type of the components, like float for Float3Value.
+    using ComponentType = typename Details::VariantComponents<T>::Type;
+
+    /// @brief  The number of components per value.
+    static constexpr size_t NumComponents = Details::VariantComponents<T>::Count;
+
+    /// @brief  The default class constructor.
+    TVariantArray() = default;
+
+    /// @brief  The class destructor.
+    ~TVariantArray() = default;
+
+    /// @brief  Will add a value.
+    /// @param[in] value    The value.
+    void add(const T &value);
+
+    /// @brief  Will add the value of a variant.
+    /// @param[in] value    The variant.
+    /// @return false, if the variant stores another type, nothing will be added then.
+    bool add(const Variant &value);
+
+    /// @brief  Will add the values of several variants.
+    /// @param[in] values   The variants.
+    /// @param[in] count    The number of variants.
+    /// @return false, if one variant stores another type, nothing will be added then.
+    bool add(const Variant *values, size_t count);
+
+    /// @brief  Will return the value at the given index as a variant.
+    /// @param[in] index    The index.
+    /// @return The variant.
+    Variant get(size_t index) const;
+
+    /// @brief  Will return the value at the given index.
+    /// @param[in] index    The index, must be less than size.
+    /// @return The value.
+    T &operator[](size_t index) const;
+
+    /// @brief  Will return the number of values.
+    /// @return The number of values.
+    size_t size() const;
+
+    /// @brief  Will return true, if there are no values.
+    /// @return true for empty.
+    bool isEmpty() const;
+
+    /// @brief  Will reserve memory for the given number of values.
+    /// @param[in] capacity The number of values.
+    void reserve(size_t capacity);
+
+    /// @brief  Will remove all values.
+    void clear();
+
+    /// @brief  Will return the view onto the values.
+    /// @return The view.
+    TMutableSpan<T> values() const;
+
+    /// @brief  Will return the view onto the components of all values.
+    /// @return The view, NumComponents * size scalars.
+    TMutableSpan<ComponentType> components() const;
+
+private:
+    void grow(size_t size);
+
+private:
+    TArray<T> mValues;
+};
+
+template <class T>
+constexpr Variant::Type TVariantArray<T>::Type;
+
+template <class T>
+constexpr size_t TVariantArray<T>::NumComponents;
+
+template <class T>
+inline void TVariantArray<T>::add(const T &value) {
+    grow(mValues.size() + 1);
+    mValues.add(value);
+}
+
+template <class T>
+inline bool TVariantArray<T>::add(const Variant &value) {
+    const T *ptr = value.tryGet<T>();
+    if (ptr == nullptr) {
+        return false;
+    }
+
+    add(*ptr);
+    return true;
+}
+
+template <class T>
+inline bool TVariantArray<T>::add(const Variant *values, size_t count) {
+    const size_t offset = mValues.size();
+    grow(offset + count);
+    for (size_t i = 0; i < count; ++i) {
+        const T *value = values[i].tryGet<T>();
+        if (value == nullptr) {
+            // Only shrinks, the values added so far are dropped
+            mValues.resize(offset);
+            return false;
+        }
+        mValues.add(*value);
+    }
+    return true;
+}
+
+template <class T>
+inline Variant TVariantArray<T>::get(size_t index) const {
+    Variant value;
+    value.set((*this)[index]);
+    return value;
+}
+
+template <class T>
+inline T &TVariantArray<T>::operator[](size_t index) const {
+    assert(index < mValues.size());
+    return mValues[index];
+}
+
+template <class T>
+inline size_t TVariantArray<T>::size() const {
+    return mValues.size();
+}
+
+template <class T>
+inline bool TVariantArray<T>::isEmpty() const {
+    return mValues.isEmpty();
+}
+
+template <class T>
+inline void TVariantArray<T>::reserve(size_t capacity) {
+    mValues.reserve(capacity);
+}
+
+template <class T>
+inline void TVariantArray<T>::clear() {
+    mValues.clear();
+}
+
+template <class T>
+inline TMutableSpan<T> TVariantArray<T>::values() const {
+    return TMutableSpan<T>(mValues.data(), mValues.size());
+}
+
+template <class T>
+inline TMutableSpan<typename TVariantArray<T>::ComponentType> TVariantArray<T>::components() const {
+    static_assert(sizeof(T) == sizeof(ComponentType) * NumComponents, "The components must not be padded.");
+    return TMutableSpan<ComponentType>(reinterpret_cast<ComponentType *>(mValues.data()), mValues.size() * NumComponents);
+}
+
+template <class T>
+inline void TVariantArray<T>::grow(size_t size) {
+    // TArray grows linearly for large sizes, so double the capacity here
+    if (size > mValues.capacity()) {
+        const size_t capacity = mValues.capacity() * 2;
+        mValues.reserve(size > capacity ? size : capacity);
+    }
+}
+
+} // namespace cppcore
@@ -0,0 +1,98 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+
+#include <functional>
+
+namespace cppcore {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		ThreadPool
+///	@ingroup	CPPCore
+///
+///	@brief  A pool of worker threads with one task queue per worker and work stealing.
+///
+/// A worker takes its own tasks from the back of its queue, so recently pushed and still cached work
+/// is done first. Idle workers steal from the front of the other queues. Threads waiting in
+/// parallelFor will execute pending tasks as well, so nested parallel loops cannot dead-lock.
+/// @code
+/// ThreadPool pool(4);
+/// pool.parallelFor(0, numItems, 0, [&](size_t first, size_t last) {
+///     for (size_t i = first; i < last; ++i) {
+///         process(i);
+///     }
+/// });
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+class DLL_CPPCORE_EXPORT ThreadPool {
+public:
+    /// @brief  The task type.
+    using Task = std::function<void()>;
+
+    /// @brief  The range function type, will get the first and the last + 1 index of a chunk.
+    using RangeFunc = std::function<void(size_t, size_t)>;
+
+    /// @brief  The class constructor.
+    /// @param[in] numThreads   The number of worker threads, 0 for none. The thread calling
+    ///                         parallelFor will do work as well.
+    explicit ThreadPool(size_t numThreads);
+
+    /// @brief  The class destructor, will finish all pending tasks and join the workers.
+    ~ThreadPool();
+
+    /// @brief  Will return the number of worker threads.
+    /// @return The number of worker threads.
+    size_t getNumThreads() const;
+
+    /// @brief  Will add a task, which will be executed by one of the workers.
+    /// @param[in] task     The task, must not throw.
+    /// @remark A pool without workers will execute the task directly.
+    void submit(Task task);
+
+    /// @brief  Will split the range into chunks and execute them in parallel, returns when all
+    ///         chunks are done.
+    /// @param[in] begin        The first index.
+    /// @param[in] end          The last index + 1.
+    /// @param[in] grainSize    The number of indices per chunk, 0 for an automatic size.
+    /// @param[in] func         The function to call per chunk, must not throw.
+    void parallelFor(size_t begin, size_t end, size_t grainSize, const RangeFunc &func);
+
+    /// @brief  Will try to execute one pending task in the calling thread.
+    /// @return true, if a task was executed.
+    bool runPendingTask();
+
+    /// @brief  Will return the default pool, using one worker less than hardware threads.
+    /// @return The default pool.
+    static ThreadPool &getDefault();
+
+    /// No copying allowed
+    CPPCORE_NONE_COPYING(ThreadPool)
+
+private:
+    struct Impl;
+    Impl *mImpl;
+};
+
+} // namespace cppcore
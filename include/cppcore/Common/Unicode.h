@@ -0,0 +1,67 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/TStringBase.h>
+#include <cppcore/Common/TStringView.h>
+
+namespace cppcore {
+
+/// @brief  Checks whether the view is valid UTF-8.
+/// @param  str     [in] The view.
+/// @return true, if there are no truncated or overlong sequences, surrogates, code points above
+///         U+10FFFF or stray continuation bytes.
+/// @remark Uses SSE4.2/AVX2 kernels, see "Validating UTF-8 In Less Than One Instruction Per Byte",
+///         John Keiser and Daniel Lemire, 2021.
+DLL_CPPCORE_EXPORT bool isValidUtf8(const TStringView<char> &str);
+
+/// @brief  Converts UTF-8 to UTF-16.
+/// @param  str     [in] The UTF-8 view.
+/// @param  result  [out] The UTF-16 string, will be replaced.
+/// @return true, if the input was valid UTF-8. result will be empty otherwise.
+/// @code
+/// TStringBase<char16_t> wide;
+/// if (utf8ToUtf16(TStringView<char>(path, pathLen), wide)) {
+///     ...
+/// }
+/// @endcode
+DLL_CPPCORE_EXPORT bool utf8ToUtf16(const TStringView<char> &str, TStringBase<char16_t> &result);
+
+/// @brief  Converts UTF-8 to UTF-32, see utf8ToUtf16.
+DLL_CPPCORE_EXPORT bool utf8ToUtf32(const TStringView<char> &str, TStringBase<char32_t> &result);
+
+/// @brief  Converts UTF-16 to UTF-8.
+/// @param  str     [in] The UTF-16 view.
+/// @param  result  [out] The UTF-8 string, will be replaced.
+/// @return true, if the input had no unpaired surrogates. result will be empty otherwise.
+DLL_CPPCORE_EXPORT bool utf16ToUtf8(const TStringView<char16_t> &str, TStringBase<char> &result);
+
+/// @brief  Converts UTF-32 to UTF-8.
+/// @param  str     [in] The UTF-32 view.
+/// @param  result  [out] The UTF-8 string, will be replaced.
+/// @return true, if the input had no surrogates or code points above U+10FFFF. result will be
+///         empty otherwise.
+DLL_CPPCORE_EXPORT bool utf32ToUtf8(const TStringView<char32_t> &str, TStringBase<char> &result);
+
+} // namespace cppcore
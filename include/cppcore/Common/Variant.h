@@ -26,10 +26,44 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <string.h>
 #include <cassert>
+#include <cstdlib>
 #include <string>
+#include <utility>
 
 namespace cppcore {
 
+//-------------------------------------------------------------------------------------------------
+///	@class		TVariantVector
+///	@ingroup	CPPCore
+///
+///	@brief	The value type of the vector and matrix types of a Variant.
+//-------------------------------------------------------------------------------------------------
+template <class T, size_t N>
+struct TVariantVector {
+    /// @brief  The number of components.
+    static constexpr size_t NumComponents = N;
+
+    T values[N];
+
+    /// @brief  Will return the component at the given index.
+    T &operator[](size_t index) {
+        assert(index < N);
+        return values[index];
+    }
+
+    /// @brief  Will return the component at the given index.
+    const T &operator[](size_t index) const {
+        assert(index < N);
+        return values[index];
+    }
+};
+
+template <class T, size_t N>
+constexpr size_t TVariantVector<T, N>::NumComponents;
+
+template <class T>
+struct TVariantTraits;
+
 //-------------------------------------------------------------------------------------------------
 ///	@class		Variant
 ///	@ingroup	CPPCore
@@ -42,6 +76,8 @@ namespace cppcore {
 ///	If you are trying to get a float value even if the instance stores currently an integer value
 ///	on a debug build an assertion will be thrown. On a release build it is possible to get values,
 ///	but an error will be logged.
+/// All types up to Float4x4 and strings up to 63 chars are stored inline, only longer strings
+/// will allocate memory.
 //-------------------------------------------------------------------------------------------------
 class Variant {
 public:
@@ -62,6 +98,19 @@ public:
         Count           ///< Upper limit.
     };
 
+    /// @brief  The size of the inline buffer in bytes, large enough for a Float4x4.
+    static constexpr size_t InlineSize = 64;
+
+    /// @brief  The value types of the vector and matrix types.
+    using Int3Value = TVariantVector<int32_t, 3>;
+    using Int4Value = TVariantVector<int32_t, 4>;
+    using Float3Value = TVariantVector<float, 3>;
+    using Float4Value = TVariantVector<float, 4>;
+    using Float4x4Value = TVariantVector<float, 16>;
+
+    /// @brief  Will be passed to the visitor for an invalid variant.
+    struct InvalidValue {};
+
     ///	@brief	The class default constructor.
     Variant() = default;
 
@@ -80,6 +129,10 @@ public:
     ///	@param	other	[in] Other instance to copy from.
     Variant(const Variant &other);
 
+    ///	@brief	The class move constructor, other will be invalid afterwards.
+    ///	@param	other	[in] Other instance to move from.
+    Variant(Variant &&other) noexcept;
+
     ///	@brief	The class destructor.
     ~Variant();
 
@@ -177,6 +230,11 @@ public:
     ///	@param	value   The new string value.
     void setStdString(const std::string &value);
 
+    ///	@brief	Sets a string value.
+    ///	@param	value   Pointer to the chars.
+    ///	@param	len     The number of chars.
+    void setString(const char *value, size_t len);
+
     ///	@brief	Returns a constant reference to the string value.
     ///	@return	A pointer showing to the data buffer of the string.
     const char *getString() const;
@@ -192,6 +250,33 @@ public:
     ///	@brief	Clears the variant data, type will set back to None.
     void clear();
 
+    /// @brief  Will call the visitor with the stored value, dispatched by a jump table.
+    /// @param  visitor     [in] Will be called with a const reference to one of uint8_t, int32_t,
+    ///                     Int3Value, Int4Value, float, Float3Value, Float4Value, Float4x4Value,
+    ///                     bool or InvalidValue, or with a const char pointer for strings. All
+    ///                     overloads must return the same type.
+    /// @return The result of the visitor.
+    template <class TVisitor>
+    auto visit(TVisitor &&visitor) const -> decltype(visitor(InvalidValue()));
+
+    /// @brief  Will return the stored value, if the variant stores the given type.
+    /// @tparam T   One of the value types, char for strings.
+    /// @return The pointer to the value, or nullptr for another type.
+    template <class T>
+    const T *tryGet() const;
+
+    /// @brief  Will return the stored value, if the variant stores the given type.
+    /// @tparam T   One of the value types, char for strings.
+    /// @return The pointer to the value, or nullptr for another type.
+    template <class T>
+    T *tryGet();
+
+    /// @brief  Will set a new value, old values will be released and destroyed.
+    /// @tparam T   One of the fixed-size value types.
+    /// @param  value   [in] The new value.
+    template <class T>
+    void set(const T &value);
+
     /// @brief  Static helper method to generate a new variant storing a std::string.
     /// @param  value   The std::string data.
     /// @return Thew new created variant as a pointer.
@@ -200,6 +285,7 @@ public:
     ///	@brief	Operator implementations.
     bool operator==(const Variant &rOther) const;
     Variant &operator=(const Variant &rOther);
+    Variant &operator=(Variant &&rOther) noexcept;
 
 protected:
     /// @brief  Performs a validation.
@@ -208,48 +294,62 @@ protected:
     /// @return true, if data is valid.
     bool isValid(Type type, size_t numItems) const;
 
-    /// @brief Will reserve a buffer for the requested types.
+    /// @brief Will reserve a buffer for the requested types, the old data must be cleared.
     /// @param type     The requested type.
-    /// @param size     The number of items.
+    /// @param size     The size in bytes, 0 for the size of the type.
     void reserve(Type type, size_t size);
 
+    /// @brief  Will return the size in bytes of a fixed-size type.
+    /// @param type     The type.
+    /// @return The size in bytes, 0 for strings and invalid types.
+    static size_t getTypeSize(Type type);
+
+private:
+    bool isOnHeap() const;
+    void copyFrom(const Variant &other);
+
+    template <class T>
+    static const T &visitArg(const Variant &variant, T *);
+    static const char *visitArg(const Variant &variant, char *);
+    static InvalidValue visitArg(const Variant &variant, InvalidValue *);
+
 private:
     Type mType{Invalid};
     size_t mBufferSize{0};
-    void *mData{nullptr};
+    union {
+        alignas(16) unsigned char mInline[InlineSize];
+        void *mHeap;
+    };
 };
 
 inline Variant::Variant(Type type, void *pData, size_t numItems) {
     if (isValid(type, numItems)) {
-        size_t size = 0;
-        mType = type;
         if (type == String) {
             assert(nullptr != pData);
-            std::string str((char *)pData);
-            setStdString(str);
-        } else {
-            reserve(type, size);
-            ::memcpy(mData, pData, mBufferSize);
+            const char *str = static_cast<const char *>(pData);
+            setString(str, ::strlen(str));
+        } else if (type != Invalid) {
+            reserve(type, 0);
+            ::memcpy(mInline, pData, mBufferSize);
         }
     }
 }
 
-inline Variant::Variant(bool value) : mType(Boolean) {
-    reserve(Boolean, 0);
-    ::memcpy(mData, &value, mBufferSize);
+inline Variant::Variant(bool value) {
+    setBool(value);
 }
 
-inline Variant::Variant(const Variant &other) :
-        mType(Invalid),
-        mBufferSize(0),
-        mData(nullptr) {
-    mType = other.mType;
-    if (String == mType) {
-        setStdString(other.getString());
-    } else {
-        reserve(mType, 0);
-        ::memcpy(mData, other.mData, mBufferSize);
-    }
+inline Variant::Variant(const Variant &other) {
+    copyFrom(other);
+}
+
+inline Variant::Variant(Variant &&other) noexcept :
+        mType(other.mType),
+        mBufferSize(other.mBufferSize) {
+    // Copies the heap pointer as well
+    ::memcpy(mInline, other.mInline, InlineSize);
+    other.mType = Invalid;
+    other.mBufferSize = 0;
 }
 
 inline Variant::~Variant() {
@@ -265,157 +365,155 @@ inline size_t Variant::getSize() const {
 }
 
 inline void *Variant::getPtr() const {
-    return mData;
+    if (mType == Invalid) {
+        return nullptr;
+    }
+    return isOnHeap() ? mHeap : const_cast<unsigned char *>(mInline);
 }
 
 inline void Variant::setByte(unsigned char value) {
     clear();
     reserve(Byte, 0);
-    ::memcpy(mData, &value, sizeof(unsigned char));
+    mInline[0] = value;
 }
 
 inline unsigned char Variant::getByte() const {
-    return (*reinterpret_cast<unsigned char *>(mData));
+    assert(mType == Byte);
+    return mInline[0];
 }
 
 inline void Variant::setInt(int32_t val) {
     clear();
     reserve(Int, 0);
-    ::memcpy(mData, &val, sizeof(int32_t));
+    ::memcpy(mInline, &val, sizeof(int32_t));
 }
 
 inline int Variant::getInt() const {
     assert(mType == Int);
-
-    return (*reinterpret_cast<int *>(mData));
+    int32_t val;
+    ::memcpy(&val, mInline, sizeof(int32_t));
+    return val;
 }
 
 inline void Variant::setInt3(int val1, int val2, int val3) {
     clear();
     reserve(Int3, 0);
-    int *ptr = reinterpret_cast<int *>(mData);
-    *ptr = val1;
-    ++ptr;
-    *ptr = val2;
-    ++ptr;
-    *ptr = val3;
+    const int32_t vals[3] = { val1, val2, val3 };
+    ::memcpy(mInline, vals, sizeof(vals));
 }
 
 inline int *Variant::getInt3() const {
     assert(mType == Int3);
-    return (reinterpret_cast<int *>(mData));
+    return reinterpret_cast<int *>(const_cast<unsigned char *>(mInline));
 }
 
 inline void Variant::setInt4(int val1, int val2, int val3, int val4) {
     clear();
     reserve(Int4, 0);
-    int *ptr = reinterpret_cast<int *>(mData);
-    *ptr = val1;
-    ++ptr;
-    *ptr = val2;
-    ++ptr;
-    *ptr = val3;
-    ++ptr;
-    *ptr = val4;
+    const int32_t vals[4] = { val1, val2, val3, val4 };
+    ::memcpy(mInline, vals, sizeof(vals));
 }
 
 inline int *Variant::getInt4() const {
     assert(mType == Int4);
-
-    return (reinterpret_cast<int *>(mData));
+    return reinterpret_cast<int *>(const_cast<unsigned char *>(mInline));
 }
 
 inline void Variant::setFloat(float val) {
     clear();
     reserve(Float, 0);
-    ::memcpy(mData, &val, sizeof(float));
+    ::memcpy(mInline, &val, sizeof(float));
 }
 
 inline float Variant::getFloat() const {
     assert(mType == Float);
-    return (*reinterpret_cast<float *>(mData));
+    float val;
+    ::memcpy(&val, mInline, sizeof(float));
+    return val;
 }
 
 inline void Variant::setFloat3(float val1, float val2, float val3) {
     clear();
     reserve(Float3, 0);
-    float *ptr = reinterpret_cast<float *>(mData);
-    *ptr = val1;
-    ++ptr;
-    *ptr = val2;
-    ++ptr;
-    *ptr = val3;
+    const float vals[3] = { val1, val2, val3 };
+    ::memcpy(mInline, vals, sizeof(vals));
 }
 
 inline float *Variant::getFloat3() const {
     assert(mType == Float3);
-    return (reinterpret_cast<float *>(mData));
+    return reinterpret_cast<float *>(const_cast<unsigned char *>(mInline));
 }
 
 inline void Variant::setFloat4(float val1, float val2, float val3, float val4) {
     clear();
     reserve(Float4, 0);
-    float *ptr = reinterpret_cast<float *>(mData);
-    *ptr = val1;
-    ++ptr;
-    *ptr = val2;
-    ++ptr;
-    *ptr = val3;
-    ++ptr;
-    *ptr = val4;
+    const float vals[4] = { val1, val2, val3, val4 };
+    ::memcpy(mInline, vals, sizeof(vals));
 }
 
 inline float *Variant::getFloat4() const {
     assert(mType == Float4);
-    return (reinterpret_cast<float *>(mData));
+    return reinterpret_cast<float *>(const_cast<unsigned char *>(mInline));
 }
 
 inline void Variant::setFloat4x4(float *pData) {
     clear();
     reserve(Float4x4, 0);
-    ::memcpy(mData, pData, sizeof(float) * 16);
+    ::memcpy(mInline, pData, sizeof(float) * 16);
 }
 
 inline float *Variant::getFloat4x4() const {
     assert(mType == Float4x4);
-    return (reinterpret_cast<float *>(mData));
+    return reinterpret_cast<float *>(const_cast<unsigned char *>(mInline));
 }
 
 inline void Variant::setStdString(const std::string &value) {
-    clear();
-    mType = String;
-    if (value.empty()) {
-        mData = nullptr;
-        mBufferSize = 0;
-    }
-    mBufferSize = sizeof(char) * (value.size() + 1);
-    mData = (char*) ::malloc(mBufferSize);
-    if (mData == nullptr) {
-        clear();
-        return;
+    setString(value.c_str(), value.size());
+}
+
+inline void Variant::setString(const char *value, size_t len) {
+    // value may point into the current string, so it is released after the copy
+    void *oldHeap = isOnHeap() ? mHeap : nullptr;
+    const size_t size = sizeof(char) * (len + 1);
+    char *ptr = reinterpret_cast<char *>(mInline);
+    if (size > InlineSize) {
+        ptr = static_cast<char *>(::malloc(size));
+        if (ptr == nullptr) {
+            clear();
+            return;
+        }
+        ::memcpy(ptr, value, sizeof(char) * len);
+    } else {
+        // Overwrites mHeap, the source may be the inline buffer itself
+        ::memmove(ptr, value, sizeof(char) * len);
     }
+    ptr[len] = '\0';
 
-    ::memcpy(mData, value.c_str(), sizeof(char) * value.size());
-    char *ptr = (char *) mData;
-    ptr[value.size()] = '\0';
+    ::free(oldHeap);
+    if (size > InlineSize) {
+        mHeap = ptr;
+    }
+    mBufferSize = size;
+    mType = String;
 }
 
 inline const char *Variant::getString() const {
     assert(mType == String);
 
-    return static_cast<char *>(mData);
+    return static_cast<const char *>(getPtr());
 }
 
 inline void Variant::setBool(bool value) {
     clear();
     reserve(Boolean, 0);
-    ::memcpy(mData, &value, sizeof(bool));
+    ::memcpy(mInline, &value, sizeof(bool));
 }
 
 inline bool Variant::getBool() const {
     assert(Boolean == mType);
-
-    return (*reinterpret_cast<bool *>(mData));
+    bool value;
+    ::memcpy(&value, mInline, sizeof(bool));
+    return value;
 }
 
 inline void Variant::clear() {
@@ -423,8 +521,10 @@ inline void Variant::clear() {
         return;
     }
 
-    ::free(mData);
-    mData = nullptr;
+    if (isOnHeap()) {
+        ::free(mHeap);
+    }
+    mBufferSize = 0;
     mType = Invalid;
 }
 
@@ -444,7 +544,7 @@ inline bool Variant::operator==(const Variant &rOther) const {
         return false;
     }
 
-    if (0 != ::memcmp(rOther.mData, mData, mBufferSize)) {
+    if (0 != ::memcmp(rOther.getPtr(), getPtr(), mBufferSize)) {
         return false;
     }
 
@@ -452,10 +552,22 @@ inline bool Variant::operator==(const Variant &rOther) const {
 }
 
 inline Variant &Variant::operator=(const Variant &rOther) {
-    if (!(rOther == *this)) {
+    if (this != &rOther) {
+        clear();
+        copyFrom(rOther);
+    }
+
+    return *this;
+}
+
+inline Variant &Variant::operator=(Variant &&rOther) noexcept {
+    if (this != &rOther) {
+        clear();
         mType = rOther.mType;
-        reserve(mType, 0);
-        ::memcpy(mData, rOther.mData, mBufferSize);
+        mBufferSize = rOther.mBufferSize;
+        ::memcpy(mInline, rOther.mInline, InlineSize);
+        rOther.mType = Invalid;
+        rOther.mBufferSize = 0;
     }
 
     return *this;
@@ -463,7 +575,7 @@ inline Variant &Variant::operator=(const Variant &rOther) {
 
 inline bool Variant::isValid(Type type, size_t numItems) const {
     bool res = false;
-    if (type == Byte) {
+    if (type == Byte || type == Boolean) {
         if (1 == numItems) {
             res = true;
         }
@@ -479,6 +591,10 @@ inline bool Variant::isValid(Type type, size_t numItems) const {
         if (4 == numItems) {
             res = true;
         }
+    } else if (type == Float4x4) {
+        if (16 == numItems) {
+            res = true;
+        }
     } else if (type == String) {
         if (0 != numItems) {
             res = true;
@@ -491,31 +607,195 @@ inline bool Variant::isValid(Type type, size_t numItems) const {
 }
 
 inline void Variant::reserve(Type type, size_t size) {
+    assert(mType == Invalid);
     if (0 == size) {
-        if (type == Int3) {
-            size = sizeof(int) * 3;
-        } else if (type == Float3) {
-            size = sizeof(float) * 3;
-        } else if (type == Int4) {
-            size = sizeof(int) * 4;
-        } else if (type == Float4) {
-            size = sizeof(float) * 4;
-        } else if (type == Float4x4) {
-            size = sizeof(float) * 4 * 4;
-        } else if (type == Byte) {
-            size = sizeof(unsigned char);
-        } else if (type == Int) {
-            size = sizeof(int);
-        } else if (type == Float) {
-            size = sizeof(float);
-        } else if (type == Boolean) {
-            size = sizeof(bool);
-        }
+        size = getTypeSize(type);
     }
 
     mBufferSize = size;
-    mData = ::malloc(size);
     mType = type;
+    if (isOnHeap()) {
+        mHeap = ::malloc(size);
+        if (mHeap == nullptr) {
+            mBufferSize = 0;
+            mType = Invalid;
+        }
+    }
+}
+
+inline size_t Variant::getTypeSize(Type type) {
+    switch (type) {
+        case Byte:
+            return sizeof(unsigned char);
+        case Int:
+            return sizeof(int32_t);
+        case Int3:
+            return sizeof(int32_t) * 3;
+        case Int4:
+            return sizeof(int32_t) * 4;
+        case Float:
+            return sizeof(float);
+        case Float3:
+            return sizeof(float) * 3;
+        case Float4:
+            return sizeof(float) * 4;
+        case Float4x4:
+            return sizeof(float) * 4 * 4;
+        case Boolean:
+            return sizeof(bool);
+        default:
+            return 0;
+    }
+}
+
+inline bool Variant::isOnHeap() const {
+    // Only strings can exceed the inline buffer
+    return mBufferSize > InlineSize;
+}
+
+inline void Variant::copyFrom(const Variant &other) {
+    if (other.isOnHeap()) {
+        reserve(other.mType, other.mBufferSize);
+        if (mType != Invalid) {
+            ::memcpy(mHeap, other.mHeap, mBufferSize);
+        }
+        return;
+    }
+
+    mType = other.mType;
+    mBufferSize = other.mBufferSize;
+    ::memcpy(mInline, other.mInline, InlineSize);
+}
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TVariantTraits
+///	@ingroup	CPPCore
+///
+///	@brief	Maps the value types to the Variant types.
+//-------------------------------------------------------------------------------------------------
+template <>
+struct TVariantTraits<uint8_t> {
+    static constexpr Variant::Type Type = Variant::Byte;
+};
+
+template <>
+struct TVariantTraits<int32_t> {
+    static constexpr Variant::Type Type = Variant::Int;
+};
+
+template <>
+struct TVariantTraits<Variant::Int3Value> {
+    static constexpr Variant::Type Type = Variant::Int3;
+};
+
+template <>
+struct TVariantTraits<Variant::Int4Value> {
+    static constexpr Variant::Type Type = Variant::Int4;
+};
+
+template <>
+struct TVariantTraits<float> {
+    static constexpr Variant::Type Type = Variant::Float;
+};
+
+template <>
+struct TVariantTraits<Variant::Float3Value> {
+    static constexpr Variant::Type Type = Variant::Float3;
+};
+
+template <>
+struct TVariantTraits<Variant::Float4Value> {
+    static constexpr Variant::Type Type = Variant::Float4;
+};
+
+template <>
+struct TVariantTraits<Variant::Float4x4Value> {
+    static constexpr Variant::Type Type = Variant::Float4x4;
+};
+
+template <>
+struct TVariantTraits<char> {
+    static constexpr Variant::Type Type = Variant::String;
+};
+
+template <>
+struct TVariantTraits<bool> {
+    static constexpr Variant::Type Type = Variant::Boolean;
+};
+
+template <class TVisitor>
+inline auto Variant::visit(TVisitor &&visitor) const -> decltype(visitor(InvalidValue())) {
+    // The cases are dense, so this compiles to a jump table and the visitor can be inlined
+    switch (mType) {
+        case Byte:
+            return visitor(visitArg(*this, static_cast<uint8_t *>(nullptr)));
+        case Int:
+            return visitor(visitArg(*this, static_cast<int32_t *>(nullptr)));
+        case Int3:
+            return visitor(visitArg(*this, static_cast<Int3Value *>(nullptr)));
+        case Int4:
+            return visitor(visitArg(*this, static_cast<Int4Value *>(nullptr)));
+        case Float:
+            return visitor(visitArg(*this, static_cast<float *>(nullptr)));
+        case Float3:
+            return visitor(visitArg(*this, static_cast<Float3Value *>(nullptr)));
+        case Float4:
+            return visitor(visitArg(*this, static_cast<Float4Value *>(nullptr)));
+        case Float4x4:
+            return visitor(visitArg(*this, static_cast<Float4x4Value *>(nullptr)));
+        case String:
+            return visitor(visitArg(*this, static_cast<char *>(nullptr)));
+        case Boolean:
+            return visitor(visitArg(*this, static_cast<bool *>(nullptr)));
+        default:
+            return visitor(InvalidValue());
+    }
+}
+
+template <class T>
+inline const T *Variant::tryGet() const {
+    if (mType != TVariantTraits<T>::Type) {
+        return nullptr;
+    }
+    // Only strings can be stored on the heap
+    if (TVariantTraits<T>::Type == String) {
+        return static_cast<const T *>(getPtr());
+    }
+    return reinterpret_cast<const T *>(mInline);
+}
+
+template <class T>
+inline T *Variant::tryGet() {
+    if (mType != TVariantTraits<T>::Type) {
+        return nullptr;
+    }
+    // Only strings can be stored on the heap
+    if (TVariantTraits<T>::Type == String) {
+        return static_cast<T *>(getPtr());
+    }
+    return reinterpret_cast<T *>(mInline);
+}
+
+template <class T>
+inline void Variant::set(const T &value) {
+    static_assert(TVariantTraits<T>::Type != String, "Use setString for strings.");
+    clear();
+    reserve(TVariantTraits<T>::Type, 0);
+    ::memcpy(mInline, &value, sizeof(T));
+}
+
+template <class T>
+inline const T &Variant::visitArg(const Variant &variant, T *) {
+    // All fixed-size types are stored inline
+    return *reinterpret_cast<const T *>(variant.mInline);
+}
+
+inline const char *Variant::visitArg(const Variant &variant, char *) {
+    return static_cast<const char *>(variant.getPtr());
+}
+
+inline Variant::InvalidValue Variant::visitArg(const Variant &, InvalidValue *) {
+    return InvalidValue();
 }
 
 } // Namespace cppcore
@@ -22,8 +22,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #pragma once
 
+#include <cppcore/CPPCoreCommon.h>
+
 #include <cstddef>
 #include <cassert>
+#include <type_traits>
+#include <utility>
 
 namespace cppcore {
     
@@ -39,4 +43,309 @@ inline size_t distance(TIt begin, TIt end) {
     return distance;
 }
 
+
+namespace Details {
+
+    /// @brief  The element type of a range offering data() and size(), like TArray or TSpan.
+    template <class TRange>
+    using RangeValue = typename std::remove_cv<typename std::remove_pointer<
+            decltype(std::declval<TRange &>().data())>::type>::type;
+
+    // Portable fallbacks, used for all types without a SIMD kernel.
+    template <class T>
+    inline size_t findScalar(const T *data, size_t count, const T &value) {
+        for (size_t i = 0; i < count; ++i) {
+            if (data[i] == value) {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    template <class T>
+    inline size_t countScalar(const T *data, size_t count, const T &value) {
+        size_t numFound = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (data[i] == value) {
+                ++numFound;
+            }
+        }
+        return numFound;
+    }
+
+    template <class T>
+    inline void minMaxScalar(const T *data, size_t count, T &minValue, T &maxValue) {
+        minValue = maxValue = data[0];
+        for (size_t i = 1; i < count; ++i) {
+            if (data[i] < minValue) {
+                minValue = data[i];
+            }
+            if (maxValue < data[i]) {
+                maxValue = data[i];
+            }
+        }
+    }
+
+    template <class T>
+    inline T sumScalar(const T *data, size_t count) {
+        T result = T(0);
+        for (size_t i = 0; i < count; ++i) {
+            result += data[i];
+        }
+        return result;
+    }
+
+    template <class T>
+    inline void prefixSumScalar(const T *in, T *out, size_t count) {
+        T current = T(0);
+        for (size_t i = 0; i < count; ++i) {
+            current += in[i];
+            out[i] = current;
+        }
+    }
+
+    template <class T>
+    inline void replaceScalar(T *data, size_t count, const T &oldValue, const T &newValue) {
+        for (size_t i = 0; i < count; ++i) {
+            if (data[i] == oldValue) {
+                data[i] = newValue;
+            }
+        }
+    }
+
+    // Integer sums wrap around, so do them on the unsigned type to avoid signed overflow.
+    template <class T>
+    inline T sumScalarWrapped(const T *data, size_t count, std::true_type) {
+        using TUnsigned = typename std::make_unsigned<T>::type;
+        TUnsigned result = 0;
+        for (size_t i = 0; i < count; ++i) {
+            result += static_cast<TUnsigned>(data[i]);
+        }
+        return static_cast<T>(result);
+    }
+
+    template <class T>
+    inline T sumScalarWrapped(const T *data, size_t count, std::false_type) {
+        return sumScalar(data, count);
+    }
+
+    template <class T>
+    inline void prefixSumScalarWrapped(const T *in, T *out, size_t count, std::true_type) {
+        using TUnsigned = typename std::make_unsigned<T>::type;
+        TUnsigned current = 0;
+        for (size_t i = 0; i < count; ++i) {
+            current += static_cast<TUnsigned>(in[i]);
+            out[i] = static_cast<T>(current);
+        }
+    }
+
+    template <class T>
+    inline void prefixSumScalarWrapped(const T *in, T *out, size_t count, std::false_type) {
+        prefixSumScalar(in, out, count);
+    }
+
+    // The generic versions dispatch to the fallbacks, the overloads below are SIMD kernels
+    // selected at runtime by the CPU features.
+    template <class T>
+    inline size_t findImpl(const T *data, size_t count, const T &value) {
+        return findScalar(data, count, value);
+    }
+
+    template <class T>
+    inline size_t countImpl(const T *data, size_t count, const T &value) {
+        return countScalar(data, count, value);
+    }
+
+    template <class T>
+    inline void minMaxImpl(const T *data, size_t count, T &minValue, T &maxValue) {
+        minMaxScalar(data, count, minValue, maxValue);
+    }
+
+    template <class T>
+    inline T sumImpl(const T *data, size_t count) {
+        return sumScalarWrapped(data, count, std::is_integral<T>());
+    }
+
+    template <class T>
+    inline void prefixSumImpl(const T *in, T *out, size_t count) {
+        prefixSumScalarWrapped(in, out, count, std::is_integral<T>());
+    }
+
+    template <class T>
+    inline void replaceImpl(T *data, size_t count, const T &oldValue, const T &newValue) {
+        replaceScalar(data, count, oldValue, newValue);
+    }
+
+    DLL_CPPCORE_EXPORT size_t findImpl(const int32_t *data, size_t count, int32_t value);
+    DLL_CPPCORE_EXPORT size_t findImpl(const uint32_t *data, size_t count, uint32_t value);
+    DLL_CPPCORE_EXPORT size_t findImpl(const int64_t *data, size_t count, int64_t value);
+    DLL_CPPCORE_EXPORT size_t findImpl(const uint64_t *data, size_t count, uint64_t value);
+    DLL_CPPCORE_EXPORT size_t findImpl(const float *data, size_t count, float value);
+    DLL_CPPCORE_EXPORT size_t findImpl(const double *data, size_t count, double value);
+
+    DLL_CPPCORE_EXPORT size_t countImpl(const int32_t *data, size_t count, int32_t value);
+    DLL_CPPCORE_EXPORT size_t countImpl(const uint32_t *data, size_t count, uint32_t value);
+    DLL_CPPCORE_EXPORT size_t countImpl(const int64_t *data, size_t count, int64_t value);
+    DLL_CPPCORE_EXPORT size_t countImpl(const uint64_t *data, size_t count, uint64_t value);
+    DLL_CPPCORE_EXPORT size_t countImpl(const float *data, size_t count, float value);
+    DLL_CPPCORE_EXPORT size_t countImpl(const double *data, size_t count, double value);
+
+    DLL_CPPCORE_EXPORT void minMaxImpl(const int32_t *data, size_t count, int32_t &minValue, int32_t &maxValue);
+    DLL_CPPCORE_EXPORT void minMaxImpl(const uint32_t *data, size_t count, uint32_t &minValue, uint32_t &maxValue);
+    DLL_CPPCORE_EXPORT void minMaxImpl(const int64_t *data, size_t count, int64_t &minValue, int64_t &maxValue);
+    DLL_CPPCORE_EXPORT void minMaxImpl(const float *data, size_t count, float &minValue, float &maxValue);
+    DLL_CPPCORE_EXPORT void minMaxImpl(const double *data, size_t count, double &minValue, double &maxValue);
+
+    DLL_CPPCORE_EXPORT int32_t sumImpl(const int32_t *data, size_t count);
+    DLL_CPPCORE_EXPORT uint32_t sumImpl(const uint32_t *data, size_t count);
+    DLL_CPPCORE_EXPORT int64_t sumImpl(const int64_t *data, size_t count);
+    DLL_CPPCORE_EXPORT uint64_t sumImpl(const uint64_t *data, size_t count);
+    DLL_CPPCORE_EXPORT float sumImpl(const float *data, size_t count);
+    DLL_CPPCORE_EXPORT double sumImpl(const double *data, size_t count);
+
+    DLL_CPPCORE_EXPORT void prefixSumImpl(const int32_t *in, int32_t *out, size_t count);
+    DLL_CPPCORE_EXPORT void prefixSumImpl(const uint32_t *in, uint32_t *out, size_t count);
+    DLL_CPPCORE_EXPORT void prefixSumImpl(const float *in, float *out, size_t count);
+
+    DLL_CPPCORE_EXPORT void replaceImpl(int32_t *data, size_t count, int32_t oldValue, int32_t newValue);
+    DLL_CPPCORE_EXPORT void replaceImpl(uint32_t *data, size_t count, uint32_t oldValue, uint32_t newValue);
+    DLL_CPPCORE_EXPORT void replaceImpl(int64_t *data, size_t count, int64_t oldValue, int64_t newValue);
+    DLL_CPPCORE_EXPORT void replaceImpl(uint64_t *data, size_t count, uint64_t oldValue, uint64_t newValue);
+    DLL_CPPCORE_EXPORT void replaceImpl(float *data, size_t count, float oldValue, float newValue);
+    DLL_CPPCORE_EXPORT void replaceImpl(double *data, size_t count, double oldValue, double newValue);
+
+} // namespace Details
+
+/// @brief  Will look for the first item which is equal to the value.
+/// @tparam T       The item type.
+/// @param begin    The first item.
+/// @param end      The item behind the last one.
+/// @param value    The value to look for.
+/// @return The found item or end, if nothing was found.
+/// @remark int32/uint32/int64/uint64/float/double will use SIMD kernels when the CPU supports them.
+template <class T>
+inline T *find(T *begin, T *end, const typename std::remove_const<T>::type &value) {
+    return begin + Details::findImpl(static_cast<const T *>(begin), static_cast<size_t>(end - begin), value);
+}
+
+/// @brief  Will look for the first item of a range which is equal to the value.
+/// @tparam TRange  The range type, like TArray or TSpan.
+/// @param range    The range to search in.
+/// @param value    The value to look for.
+/// @return The found item or the end of the range, if nothing was found.
+template <class TRange>
+inline auto find(TRange &range, const Details::RangeValue<TRange> &value) -> decltype(range.data()) {
+    return find(range.data(), range.data() + range.size(), value);
+}
+
+/// @brief  Will count all items of a range which are equal to the value.
+/// @tparam TRange  The range type, like TArray or TSpan.
+/// @param range    The range to search in.
+/// @param value    The value to count.
+/// @return The number of equal items.
+template <class TRange>
+inline size_t count(const TRange &range, const Details::RangeValue<TRange> &value) {
+    return Details::countImpl(static_cast<const Details::RangeValue<TRange> *>(range.data()), range.size(), value);
+}
+
+/// @brief  Will look for the smallest and the biggest item of a range.
+/// @tparam TRange  The range type, like TArray or TSpan.
+/// @param range    The range to search in.
+/// @param minValue Will receive the smallest item.
+/// @param maxValue Will receive the biggest item.
+/// @return false, if the range is empty.
+/// @remark For floating point ranges containing NaN the result is unspecified.
+template <class TRange>
+inline bool minMax(const TRange &range, Details::RangeValue<TRange> &minValue, Details::RangeValue<TRange> &maxValue) {
+    if (range.size() == 0) {
+        return false;
+    }
+    Details::minMaxImpl(static_cast<const Details::RangeValue<TRange> *>(range.data()), range.size(), minValue, maxValue);
+    return true;
+}
+
+/// @brief  Will sum up all items of a range.
+/// @tparam TRange  The range type, like TArray or TSpan.
+/// @param range    The range to sum up.
+/// @return The sum, 0 for an empty range.
+/// @remark Integer sums will wrap around. Floating point sums are computed in several lanes,
+///         so the rounding may differ from a sequential loop.
+template <class TRange>
+inline Details::RangeValue<TRange> sum(const TRange &range) {
+    return Details::sumImpl(static_cast<const Details::RangeValue<TRange> *>(range.data()), range.size());
+}
+
+/// @brief  Will return true, if the predicate is true for at least one item.
+/// @tparam TRange  The range type, like TArray or TSpan.
+/// @tparam TPred   The predicate type.
+/// @param range    The range to check.
+/// @param pred     The predicate.
+/// @return true, if one item matches.
+template <class TRange, class TPred>
+inline bool anyOf(const TRange &range, TPred pred) {
+    const auto *data = range.data();
+    for (size_t i = 0, size = range.size(); i < size; ++i) {
+        if (pred(data[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief  Will return true, if the predicate is true for all items, also for an empty range.
+/// @tparam TRange  The range type, like TArray or TSpan.
+/// @tparam TPred   The predicate type.
+/// @param range    The range to check.
+/// @param pred     The predicate.
+/// @return true, if all items match.
+template <class TRange, class TPred>
+inline bool allOf(const TRange &range, TPred pred) {
+    const auto *data = range.data();
+    for (size_t i = 0, size = range.size(); i < size; ++i) {
+        if (!pred(data[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief  Will compute the inclusive prefix sum, out[i] = in[0] + ... + in[i].
+/// @tparam T       The item type.
+/// @param in       The input items.
+/// @param out      The output items, may be the same as in.
+/// @param count    The number of items.
+template <class T>
+inline void prefixSum(const T *in, T *out, size_t count) {
+    Details::prefixSumImpl(in, out, count);
+}
+
+/// @brief  Will compute the inclusive prefix sum of a range in place.
+/// @tparam TRange  The range type, like TArray.
+/// @param range    The range to scan.
+template <class TRange>
+inline void prefixSum(TRange &range) {
+    prefixSum(range.data(), range.data(), range.size());
+}
+
+/// @brief  Will replace all items which are equal to oldValue by newValue.
+/// @tparam T       The item type.
+/// @param begin    The first item.
+/// @param end      The item behind the last one.
+/// @param oldValue The value to replace.
+/// @param newValue The new value.
+template <class T>
+inline void replace(T *begin, T *end, const T &oldValue, const T &newValue) {
+    Details::replaceImpl(begin, static_cast<size_t>(end - begin), oldValue, newValue);
+}
+
+/// @brief  Will replace all items of a range which are equal to oldValue by newValue.
+/// @tparam TRange  The range type, like TArray.
+/// @param range    The range to modify.
+/// @param oldValue The value to replace.
+/// @param newValue The new value.
+template <class TRange>
+inline void replace(TRange &range, const Details::RangeValue<TRange> &oldValue, const Details::RangeValue<TRange> &newValue) {
+    replace(range.data(), range.data() + range.size(), oldValue, newValue);
+}
+
 } // namespace cppcore
@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Container/TAlgorithm.h>
 #include <cppcore/Memory/TDefaultAllocator.h>
 
 namespace cppcore {
@@ -188,8 +189,9 @@ private:
 
 template <class T, class TAlloc>
 inline TArray<T, TAlloc>::TArray(size_t size) {
+    // getGrowing is capped, so reserve at least the size or resize will allocate again
     const size_t capa = Details::getGrowing(size);
-    reserve(capa);
+    reserve(capa > size ? capa : size);
     resize(size);
 }
 
@@ -385,7 +387,7 @@ inline void TArray<T, TAlloc>::resize(size_t size) {
 
     // Store older items
     if (mSize > 0u && mCapacity < size) {
-        tmp = mAllocator.alloc(mSize * sizeof(T));
+        tmp = mAllocator.alloc(mSize);
         for (size_t i = 0u; i < mSize; ++i) {
             tmp[i] = mData[i];
         }
@@ -395,9 +397,12 @@ inline void TArray<T, TAlloc>::resize(size_t size) {
         mCapacity = 0u;
     }
 
-    // Realloc memory
+    // Realloc memory, an empty array may still own a reserved block
     if (size > mCapacity) {
-        mData = mAllocator.alloc(size * sizeof(T));
+        if (mData) {
+            mAllocator.release(mData);
+        }
+        mData = mAllocator.alloc(size);
         if (tmp) {
             for (size_t i = 0u; i < oldSize; ++i) {
                 mData[i] = tmp[i];
@@ -436,13 +441,7 @@ inline bool TArray<T, TAlloc>::isEmpty() const {
 
 template <class T, class TAlloc>
 inline typename TArray<T, TAlloc>::Iterator TArray<T, TAlloc>::linearSearch(const T &item) {
-    for (Iterator it = begin(); it != end(); ++it) {
-        if (item == *it) {
-            return it;
-        }
-    }
-
-    return end();
+    return cppcore::find(mData, mData + mSize, item);
 }
 
 template <class T, class TAlloc>
@@ -0,0 +1,511 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/Hash.h>
+#include <cppcore/Memory/MemUtils.h>
+
+#include <cmath>
+#include <type_traits>
+
+namespace cppcore {
+namespace Details {
+
+/// @brief  The size of one filter block, each query will touch only one block.
+static constexpr size_t BloomBlockSize = 64;
+
+/// @brief  The number of 64-bit words in one block.
+static constexpr size_t BloomBlockWords = BloomBlockSize / sizeof(uint64_t);
+
+static constexpr double BloomLn2 = 0.6931471805599453;
+
+/// @brief  Will return the optimal number of hash functions.
+/// @param[in] numCells         The number of cells.
+/// @param[in] expectedItems    The number of items which will be added.
+/// @return The number of hash functions, between 1 and 16.
+inline uint32_t bloomNumHashes(size_t numCells, size_t expectedItems) {
+    const double items = expectedItems == 0 ? 1.0 : static_cast<double>(expectedItems);
+    const double k = std::round(static_cast<double>(numCells) / items * BloomLn2);
+    if (k < 1.0) {
+        return 1;
+    }
+    return k > 16.0 ? 16u : static_cast<uint32_t>(k);
+}
+
+/// @brief  Will estimate the false-positive rate of a blocked filter.
+///
+/// The keys are not spread evenly over the blocks, the number of keys per block follows a
+/// Poisson distribution. Overfull blocks will produce more false positives than a classic
+/// bloom filter with the same size.
+inline double bloomBlockedFpRate(size_t numBlocks, size_t cellsPerBlock, size_t expectedItems, uint32_t numHashes) {
+    const double lambda = static_cast<double>(expectedItems) / static_cast<double>(numBlocks);
+    const double emptyPerKey = std::pow(1.0 - 1.0 / static_cast<double>(cellsPerBlock), static_cast<double>(numHashes));
+    const size_t maxLoad = static_cast<size_t>(lambda + 10.0 * std::sqrt(lambda) + 20.0);
+    double probability = std::exp(-lambda);
+    double fpRate = 0.0;
+    for (size_t load = 0; load <= maxLoad; ++load) {
+        const double cellSet = 1.0 - std::pow(emptyPerKey, static_cast<double>(load));
+        fpRate += probability * std::pow(cellSet, static_cast<double>(numHashes));
+        probability *= lambda / static_cast<double>(load + 1);
+    }
+
+    return fpRate;
+}
+
+/// @brief  Will return the number of blocks for the requested false-positive rate.
+/// @param[in] expectedItems    The number of items which will be added.
+/// @param[in] fpRate           The requested false-positive rate, between 0 and 1.
+/// @param[in] cellsPerBlock    The number of cells in one block.
+/// @param[out] numHashes       The number of hash functions to use.
+/// @return The number of blocks.
+inline size_t bloomNumBlocks(size_t expectedItems, double fpRate, size_t cellsPerBlock, uint32_t &numHashes) {
+    assert(fpRate > 0.0 && fpRate < 1.0);
+    const size_t items = expectedItems == 0 ? 1 : expectedItems;
+
+    // Start with the size of a classic bloom filter and grow until the blocked layout fits
+    const double numCells = std::ceil(-static_cast<double>(items) * std::log(fpRate) / (BloomLn2 * BloomLn2));
+    size_t numBlocks = static_cast<size_t>(std::ceil(numCells / static_cast<double>(cellsPerBlock)));
+    for (size_t i = 0; i < 64; ++i) {
+        numHashes = bloomNumHashes(numBlocks * cellsPerBlock, items);
+        if (bloomBlockedFpRate(numBlocks, cellsPerBlock, items, numHashes) <= fpRate) {
+            break;
+        }
+        numBlocks += numBlocks / 32 + 1;
+    }
+
+    return numBlocks;
+}
+
+/// @brief  Integer keys are used directly, they will be mixed afterwards.
+template <class T>
+inline HashId bloomHash(const T &key, std::true_type) {
+    return static_cast<HashId>(key);
+}
+
+/// @brief  All other keys will be hashed by using their bytes.
+template <class T>
+inline HashId bloomHash(const T &key, std::false_type) {
+    static_assert(std::is_trivially_copyable<T>::value, "Key must be trivially copyable, use the hash-based methods instead.");
+    return hash64(&key, sizeof(T));
+}
+
+/// @brief  Will compute the hash for a key.
+template <class T>
+inline HashId bloomHash(const T &key) {
+    return bloomHash(key, std::is_integral<T>());
+}
+
+/// @brief  Will map the hash onto a block without a modulo operation.
+inline size_t bloomBlockIndex(HashId hash, size_t numBlocks) {
+    return static_cast<size_t>(((hash >> 32) * static_cast<uint64_t>(numBlocks)) >> 32);
+}
+
+/// @brief  Computes the position of the next cell inside of a block.
+///
+/// The state is advanced by a 64-bit LCG, its upper bits are used as the cell position. So the
+/// positions are independent from each other, double hashing would produce more collisions
+/// inside of the small blocks.
+inline uint32_t bloomNextCell(uint64_t &state, uint32_t cellBits) {
+    state = state * 0x5851f42d4c957f2dull + 0x14057b7ef767814full;
+    return static_cast<uint32_t>(state >> (64 - cellBits));
+}
+
+/// @brief  Will allocate cache-line aligned and cleared storage for the blocks.
+inline uint64_t *bloomAlloc(size_t numWords, uint64_t *&raw) {
+    raw = new uint64_t[numWords + BloomBlockWords];
+    uint64_t *aligned = static_cast<uint64_t *>(const_cast<void *>(MemUtils::alignPtr(raw, 0, BloomBlockSize)));
+    MemUtils::clearMemory(aligned, numWords * sizeof(uint64_t));
+    return aligned;
+}
+
+} // namespace Details
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TBloomFilter
+///	@ingroup	CPPCore
+///
+///	@brief  This class implements a blocked bloom filter for fast negative lookups.
+///
+/// All bits of one key are stored in a single cache-line sized block, so each query will touch
+/// only one cache line. mayContain will never return false for an added key, but it may return
+/// true for keys which were never added, with about the requested false-positive rate.
+/// @code
+/// TBloomFilter<uint64_t> filter(100000, 0.01);
+/// filter.add(42);
+/// if (filter.mayContain(42)) {
+///     // Do the expensive lookup
+/// }
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+template <class T>
+class TBloomFilter {
+public:
+    /// @brief  The default class constructor.
+    TBloomFilter() = default;
+
+    /// @brief  The class constructor with the filter parameters.
+    /// @param[in] expectedItems    The number of items which will be added.
+    /// @param[in] fpRate           The requested false-positive rate, between 0 and 1.
+    TBloomFilter(size_t expectedItems, double fpRate);
+
+    /// @brief  The class destructor.
+    ~TBloomFilter();
+
+    /// @brief  Will init the filter, all added keys will be removed.
+    /// @param[in] expectedItems    The number of items which will be added.
+    /// @param[in] fpRate           The requested false-positive rate, between 0 and 1.
+    void init(size_t expectedItems, double fpRate);
+
+    /// @brief  Will add a new key.
+    /// @param[in] key  The key to add.
+    void add(const T &key);
+
+    /// @brief  Will add a key described by its hash value.
+    /// @param[in] hash The full 64-bit hash of the key.
+    void addHash(HashId hash);
+
+    /// @brief  Will check if a key may be stored.
+    /// @param[in] key  The key to look for.
+    /// @return false, if the key was definitely not added, true if it may be added.
+    bool mayContain(const T &key) const;
+
+    /// @brief  Will check if a key described by its hash value may be stored.
+    /// @param[in] hash The full 64-bit hash of the key.
+    /// @return false, if the key was definitely not added, true if it may be added.
+    bool mayContainHash(HashId hash) const;
+
+    /// @brief  Will remove all keys.
+    void clear();
+
+    /// @brief  Will return the number of bits in the filter.
+    /// @return The number of bits.
+    size_t numBits() const;
+
+    /// @brief  Will return the number of bits set for each key.
+    /// @return The number of hash functions.
+    uint32_t numHashes() const;
+
+    /// No copying allowed
+    CPPCORE_NONE_COPYING(TBloomFilter)
+
+private:
+    static constexpr uint32_t BitsPerBlock = Details::BloomBlockSize * 8;
+    static constexpr uint32_t CellBits = 9;
+    void release();
+
+private:
+    uint64_t *mRaw{nullptr};
+    uint64_t *mBlocks{nullptr};
+    size_t mNumBlocks{0u};
+    uint32_t mNumHashes{0u};
+};
+
+template <class T>
+inline TBloomFilter<T>::TBloomFilter(size_t expectedItems, double fpRate) {
+    init(expectedItems, fpRate);
+}
+
+template <class T>
+inline TBloomFilter<T>::~TBloomFilter() {
+    release();
+}
+
+template <class T>
+inline void TBloomFilter<T>::init(size_t expectedItems, double fpRate) {
+    release();
+    mNumBlocks = Details::bloomNumBlocks(expectedItems, fpRate, BitsPerBlock, mNumHashes);
+    mBlocks = Details::bloomAlloc(mNumBlocks * Details::BloomBlockWords, mRaw);
+}
+
+template <class T>
+inline void TBloomFilter<T>::add(const T &key) {
+    addHash(Details::bloomHash(key));
+}
+
+template <class T>
+inline void TBloomFilter<T>::addHash(HashId hash) {
+    assert(mBlocks != nullptr);
+    hash = mix64(hash);
+    uint64_t *block = &mBlocks[Details::bloomBlockIndex(hash, mNumBlocks) * Details::BloomBlockWords];
+    uint64_t state = hash;
+    for (uint32_t i = 0; i < mNumHashes; ++i) {
+        const uint32_t bit = Details::bloomNextCell(state, CellBits);
+        block[bit / 64] |= 1ull << (bit % 64);
+    }
+}
+
+template <class T>
+inline bool TBloomFilter<T>::mayContain(const T &key) const {
+    return mayContainHash(Details::bloomHash(key));
+}
+
+template <class T>
+inline bool TBloomFilter<T>::mayContainHash(HashId hash) const {
+    if (mBlocks == nullptr) {
+        return false;
+    }
+
+    hash = mix64(hash);
+    const uint64_t *block = &mBlocks[Details::bloomBlockIndex(hash, mNumBlocks) * Details::BloomBlockWords];
+    uint64_t mask[Details::BloomBlockWords] = {};
+    uint64_t state = hash;
+    for (uint32_t i = 0; i < mNumHashes; ++i) {
+        const uint32_t bit = Details::bloomNextCell(state, CellBits);
+        mask[bit / 64] |= 1ull << (bit % 64);
+    }
+
+    // Check the whole block without branches, the compiler can vectorize this
+    uint64_t missing = 0;
+    for (size_t i = 0; i < Details::BloomBlockWords; ++i) {
+        missing |= mask[i] & ~block[i];
+    }
+
+    return missing == 0;
+}
+
+template <class T>
+inline void TBloomFilter<T>::clear() {
+    if (mBlocks != nullptr) {
+        MemUtils::clearMemory(mBlocks, mNumBlocks * Details::BloomBlockSize);
+    }
+}
+
+template <class T>
+inline size_t TBloomFilter<T>::numBits() const {
+    return mNumBlocks * BitsPerBlock;
+}
+
+template <class T>
+inline uint32_t TBloomFilter<T>::numHashes() const {
+    return mNumHashes;
+}
+
+template <class T>
+inline void TBloomFilter<T>::release() {
+    delete[] mRaw;
+    mRaw = nullptr;
+    mBlocks = nullptr;
+    mNumBlocks = 0u;
+    mNumHashes = 0u;
+}
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TCountingBloomFilter
+///	@ingroup	CPPCore
+///
+///	@brief  This class implements a blocked bloom filter, which supports the removal of keys.
+///
+/// Each cell is a 4-bit counter instead of a single bit, so the filter needs four times the
+/// memory of a TBloomFilter with the same parameters. A counter which has reached its maximum will
+/// stick there, so removing keys can never produce a false negative.
+//-------------------------------------------------------------------------------------------------
+template <class T>
+class TCountingBloomFilter {
+public:
+    /// @brief  The default class constructor.
+    TCountingBloomFilter() = default;
+
+    /// @brief  The class constructor with the filter parameters.
+    /// @param[in] expectedItems    The number of items which will be added.
+    /// @param[in] fpRate           The requested false-positive rate, between 0 and 1.
+    TCountingBloomFilter(size_t expectedItems, double fpRate);
+
+    /// @brief  The class destructor.
+    ~TCountingBloomFilter();
+
+    /// @brief  Will init the filter, all added keys will be removed.
+    /// @param[in] expectedItems    The number of items which will be added.
+    /// @param[in] fpRate           The requested false-positive rate, between 0 and 1.
+    void init(size_t expectedItems, double fpRate);
+
+    /// @brief  Will add a new key.
+    /// @param[in] key  The key to add.
+    void add(const T &key);
+
+    /// @brief  Will add a key described by its hash value.
+    /// @param[in] hash The full 64-bit hash of the key.
+    void addHash(HashId hash);
+
+    /// @brief  Will remove a key, which was added before.
+    /// @param[in] key  The key to remove.
+    void remove(const T &key);
+
+    /// @brief  Will remove a key described by its hash value, which was added before.
+    /// @param[in] hash The full 64-bit hash of the key.
+    void removeHash(HashId hash);
+
+    /// @brief  Will check if a key may be stored.
+    /// @param[in] key  The key to look for.
+    /// @return false, if the key was definitely not added, true if it may be added.
+    bool mayContain(const T &key) const;
+
+    /// @brief  Will check if a key described by its hash value may be stored.
+    /// @param[in] hash The full 64-bit hash of the key.
+    /// @return false, if the key was definitely not added, true if it may be added.
+    bool mayContainHash(HashId hash) const;
+
+    /// @brief  Will remove all keys.
+    void clear();
+
+    /// @brief  Will return the number of counters in the filter.
+    /// @return The number of counters.
+    size_t numCounters() const;
+
+    /// @brief  Will return the number of counters used for each key.
+    /// @return The number of hash functions.
+    uint32_t numHashes() const;
+
+    /// No copying allowed
+    CPPCORE_NONE_COPYING(TCountingBloomFilter)
+
+private:
+    static constexpr uint32_t CountersPerBlock = Details::BloomBlockSize * 2;
+    static constexpr uint32_t CellBits = 7;
+    static constexpr uint64_t MaxCount = 0xf;
+    uint64_t *getBlock(HashId hash) const;
+    void release();
+
+private:
+    uint64_t *mRaw{nullptr};
+    uint64_t *mBlocks{nullptr};
+    size_t mNumBlocks{0u};
+    uint32_t mNumHashes{0u};
+};
+
+template <class T>
+inline TCountingBloomFilter<T>::TCountingBloomFilter(size_t expectedItems, double fpRate) {
+    init(expectedItems, fpRate);
+}
+
+template <class T>
+inline TCountingBloomFilter<T>::~TCountingBloomFilter() {
+    release();
+}
+
+template <class T>
+inline void TCountingBloomFilter<T>::init(size_t expectedItems, double fpRate) {
+    release();
+    mNumBlocks = Details::bloomNumBlocks(expectedItems, fpRate, CountersPerBlock, mNumHashes);
+    mBlocks = Details::bloomAlloc(mNumBlocks * Details::BloomBlockWords, mRaw);
+}
+
+template <class T>
+inline void TCountingBloomFilter<T>::add(const T &key) {
+    addHash(Details::bloomHash(key));
+}
+
+template <class T>
+inline void TCountingBloomFilter<T>::addHash(HashId hash) {
+    assert(mBlocks != nullptr);
+    hash = mix64(hash);
+    uint64_t *block = getBlock(hash);
+    uint64_t state = hash;
+    for (uint32_t i = 0; i < mNumHashes; ++i) {
+        const uint32_t cell = Details::bloomNextCell(state, CellBits);
+        const uint32_t shift = (cell % 16) * 4;
+        if (((block[cell / 16] >> shift) & MaxCount) != MaxCount) {
+            block[cell / 16] += 1ull << shift;
+        }
+    }
+}
+
+template <class T>
+inline void TCountingBloomFilter<T>::remove(const T &key) {
+    removeHash(Details::bloomHash(key));
+}
+
+template <class T>
+inline void TCountingBloomFilter<T>::removeHash(HashId hash) {
+    if (!mayContainHash(hash)) {
+        return;
+    }
+
+    hash = mix64(hash);
+    uint64_t *block = getBlock(hash);
+    uint64_t state = hash;
+    for (uint32_t i = 0; i < mNumHashes; ++i) {
+        const uint32_t cell = Details::bloomNextCell(state, CellBits);
+        const uint32_t shift = (cell % 16) * 4;
+        const uint64_t count = (block[cell / 16] >> shift) & MaxCount;
+        if (count != MaxCount && count != 0) {
+            block[cell / 16] -= 1ull << shift;
+        }
+    }
+}
+
+template <class T>
+inline bool TCountingBloomFilter<T>::mayContain(const T &key) const {
+    return mayContainHash(Details::bloomHash(key));
+}
+
+template <class T>
+inline bool TCountingBloomFilter<T>::mayContainHash(HashId hash) const {
+    if (mBlocks == nullptr) {
+        return false;
+    }
+
+    hash = mix64(hash);
+    const uint64_t *block = getBlock(hash);
+    bool found = true;
+    uint64_t state = hash;
+    for (uint32_t i = 0; i < mNumHashes; ++i) {
+        const uint32_t cell = Details::bloomNextCell(state, CellBits);
+        found &= ((block[cell / 16] >> ((cell % 16) * 4)) & MaxCount) != 0;
+    }
+
+    return found;
+}
+
+template <class T>
+inline void TCountingBloomFilter<T>::clear() {
+    if (mBlocks != nullptr) {
+        MemUtils::clearMemory(mBlocks, mNumBlocks * Details::BloomBlockSize);
+    }
+}
+
+template <class T>
+inline size_t TCountingBloomFilter<T>::numCounters() const {
+    return mNumBlocks * CountersPerBlock;
+}
+
+template <class T>
+inline uint32_t TCountingBloomFilter<T>::numHashes() const {
+    return mNumHashes;
+}
+
+template <class T>
+inline uint64_t *TCountingBloomFilter<T>::getBlock(HashId hash) const {
+    return &mBlocks[Details::bloomBlockIndex(hash, mNumBlocks) * Details::BloomBlockWords];
+}
+
+template <class T>
+inline void TCountingBloomFilter<T>::release() {
+    delete[] mRaw;
+    mRaw = nullptr;
+    mBlocks = nullptr;
+    mNumBlocks = 0u;
+    mNumHashes = 0u;
+}
+
+} // namespace cppcore
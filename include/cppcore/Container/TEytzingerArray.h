@@ -0,0 +1,197 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/CPPCoreCommon.h>
+#include <cppcore/Common/BitUtils.h>
+#include <cppcore/Common/Sort.h>
+#include <cppcore/Container/TArray.h>
+
+namespace cppcore {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		TEytzingerArray
+///	@ingroup	CPPCore
+///
+///	@brief  A sorted array stored in the breadth-first order of a binary search tree.
+///
+/// The first levels of the search are stored next to each other, so they stay in the cache and
+/// the children of a node share a cache line. The descent is branchless and prefetches the nodes
+/// four levels deeper, which makes lookups in big tables much faster than a binary search.
+/// @code
+/// int sorted[] = { 1, 3, 5, 7 };
+/// TEytzingerArray<int> table(sorted, 4);
+/// size_t pos = table.lowerBound(4); // 2
+/// @endcode
+//-------------------------------------------------------------------------------------------------
+template <class T, class TCompare = TLess<T>>
+class TEytzingerArray {
+public:
+    /// @brief  The default class constructor.
+    TEytzingerArray() = default;
+
+    /// @brief  The class constructor with the sorted data.
+    /// @param[in] sorted   The sorted data.
+    /// @param[in] num      The number of elements.
+    /// @param[in] comp     The compare function used for sorting.
+    TEytzingerArray(const T *sorted, size_t num, TCompare comp = TCompare());
+
+    /// @brief  The class destructor.
+    ~TEytzingerArray() = default;
+
+    /// @brief  Will init the array with the sorted data.
+    /// @param[in] sorted   The sorted data.
+    /// @param[in] num      The number of elements.
+    void init(const T *sorted, size_t num);
+
+    /// @brief  Will return the number of elements.
+    /// @return The number of elements.
+    size_t size() const;
+
+    /// @brief  Will return the position of the first element not lower than the key in the
+    ///         sorted order.
+    /// @param[in] key  The key to look for.
+    /// @return The sorted position, size() if all elements are lower.
+    size_t lowerBound(const T &key) const;
+
+    /// @brief  Will return true, if an element equal to the key is stored.
+    /// @param[in] key  The key to look for.
+    /// @return true, if found.
+    bool contains(const T &key) const;
+
+    /// @brief  Will return the element at the given sorted position.
+    /// @param[in] pos  The sorted position.
+    /// @return The element.
+    const T &at(size_t pos) const;
+
+private:
+    size_t lowerBoundSlot(const T &key) const;
+    size_t slotToRank(size_t slot) const;
+    size_t rankToSlot(size_t rank) const;
+    size_t fill(const T *sorted, size_t slot, size_t next);
+
+private:
+    // Indexed by the 1-based slot, the sorted position is computed from the slot on demand
+    TArray<T> mData;
+    size_t mSize{0};
+    size_t mBottom{0};
+    size_t mNumBottom{0};
+    TCompare mComp;
+};
+
+template <class T, class TCompare>
+inline TEytzingerArray<T, TCompare>::TEytzingerArray(const T *sorted, size_t num, TCompare comp) :
+        mComp(comp) {
+    init(sorted, num);
+}
+
+template <class T, class TCompare>
+inline void TEytzingerArray<T, TCompare>::init(const T *sorted, size_t num) {
+    mSize = num;
+    mData.resize(num + 1);
+    mBottom = 0;
+    mNumBottom = 0;
+    if (num != 0) {
+        // The depth of the bottom level and the number of nodes on it
+        mBottom = 63 - countLeadingZeros(num);
+        mNumBottom = num - ((size_t(1) << mBottom) - 1);
+        fill(sorted, 1, 0);
+    }
+}
+
+template <class T, class TCompare>
+inline size_t TEytzingerArray<T, TCompare>::size() const {
+    return mSize;
+}
+
+template <class T, class TCompare>
+inline size_t TEytzingerArray<T, TCompare>::lowerBound(const T &key) const {
+    const size_t slot = lowerBoundSlot(key);
+    return slot == 0 ? mSize : slotToRank(slot);
+}
+
+template <class T, class TCompare>
+inline bool TEytzingerArray<T, TCompare>::contains(const T &key) const {
+    const size_t slot = lowerBoundSlot(key);
+    return slot != 0 && !mComp(key, mData[slot]);
+}
+
+template <class T, class TCompare>
+inline const T &TEytzingerArray<T, TCompare>::at(size_t pos) const {
+    assert(pos < mSize);
+    return mData[rankToSlot(pos)];
+}
+
+template <class T, class TCompare>
+inline size_t TEytzingerArray<T, TCompare>::lowerBoundSlot(const T &key) const {
+    // Four levels below a node there are 16 nodes, stored next to each other
+    constexpr size_t PrefetchDistance = 16;
+    const T *data = mData.data();
+    const size_t num = mSize;
+    size_t slot = 1;
+    while (slot <= num) {
+        const size_t ahead = slot * PrefetchDistance;
+        CPPCORE_PREFETCH(data + (ahead <= num ? ahead : 0));
+        slot = 2 * slot + (mComp(data[slot], key) ? 1 : 0);
+    }
+
+    // The path ends with a run of right turns after the last left turn, which is the answer
+    return slot >> (countTrailingZeros(~static_cast<uint64_t>(slot)) + 1);
+}
+
+template <class T, class TCompare>
+inline size_t TEytzingerArray<T, TCompare>::slotToRank(size_t slot) const {
+    // In a perfect tree with the bottom level at depth 'bottom', the node i of depth 'depth' has
+    // the in-order position (2i + 1) * 2^(bottom - depth) - 1. The bottom nodes take the even
+    // positions, so subtract the missing ones in front of the slot.
+    const uint64_t bottom = mBottom;
+    const uint64_t depth = 63 - countLeadingZeros(slot);
+    const uint64_t numBottom = mNumBottom;
+    const uint64_t perfect = ((2 * slot + 1) << (bottom - depth)) - (uint64_t(1) << (bottom + 1)) - 1;
+    const uint64_t numBefore = (perfect + 1) / 2;
+    return static_cast<size_t>(numBefore > numBottom ? perfect - (numBefore - numBottom) : perfect);
+}
+
+template <class T, class TCompare>
+inline size_t TEytzingerArray<T, TCompare>::rankToSlot(size_t rank) const {
+    // The inverse of slotToRank, behind the last bottom node every second perfect position is missing
+    const uint64_t bottom = mBottom;
+    const uint64_t numBottom = mNumBottom;
+    const uint64_t perfect = rank < 2 * numBottom ? rank : 2 * rank - 2 * numBottom + 1;
+    const uint64_t height = countTrailingZeros(perfect + 1);
+    return static_cast<size_t>((((perfect + 1) >> height) + (uint64_t(1) << (bottom + 1 - height))) >> 1);
+}
+
+template <class T, class TCompare>
+inline size_t TEytzingerArray<T, TCompare>::fill(const T *sorted, size_t slot, size_t next) {
+    // In-order traversal of the implicit tree
+    if (slot <= mSize) {
+        next = fill(sorted, 2 * slot, next);
+        mData[slot] = sorted[next];
+        ++next;
+        next = fill(sorted, 2 * slot + 1, next);
+    }
+    return next;
+}
+
+} // namespace cppcore
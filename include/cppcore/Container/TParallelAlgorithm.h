@@ -0,0 +1,264 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2026 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include <cppcore/Common/Sort.h>
+#include <cppcore/Common/ThreadPool.h>
+#include <cppcore/Container/TAlgorithm.h>
+#include <cppcore/Container/TArray.h>
+
+namespace cppcore {
+
+//-------------------------------------------------------------------------------------------------
+///	@class		ExecutionPolicy
+///	@ingroup	CPPCore
+///
+///	@brief  Describes how a parallel algorithm shall be executed.
+//-------------------------------------------------------------------------------------------------
+class ExecutionPolicy {
+public:
+    /// @brief  Will return a policy to run in the calling thread.
+    /// @return The policy.
+    static ExecutionPolicy sequential() {
+        return ExecutionPolicy(false, nullptr, 0);
+    }
+
+    /// @brief  Will return a policy to run on a thread pool.
+    /// @param[in] pool         The pool to use, nullptr for the default pool.
+    /// @param[in] grainSize    The number of items per chunk, 0 for an automatic size.
+    /// @return The policy.
+    static ExecutionPolicy parallel(ThreadPool *pool = nullptr, size_t grainSize = 0) {
+        return ExecutionPolicy(true, pool, grainSize);
+    }
+
+    /// @brief  Will return true for a parallel policy.
+    bool isParallel() const {
+        return mParallel;
+    }
+
+    /// @brief  Will return the pool to use.
+    ThreadPool &getPool() const {
+        return mPool != nullptr ? *mPool : ThreadPool::getDefault();
+    }
+
+    /// @brief  Will return the number of items per chunk, 0 for automatic.
+    size_t getGrainSize() const {
+        return mGrainSize;
+    }
+
+private:
+    ExecutionPolicy(bool parallel, ThreadPool *pool, size_t grainSize) :
+            mParallel(parallel), mPool(pool), mGrainSize(grainSize) {
+        // empty
+    }
+
+private:
+    bool mParallel;
+    ThreadPool *mPool;
+    size_t mGrainSize;
+};
+
+namespace Details {
+
+    // Will call func(first, last) for all chunks of [0, numItems), in parallel for a parallel policy.
+    template <class TFunc>
+    inline void forChunks(const ExecutionPolicy &policy, size_t numItems, TFunc func) {
+        if (!policy.isParallel()) {
+            func(size_t(0), numItems);
+            return;
+        }
+        policy.getPool().parallelFor(0, numItems, policy.getGrainSize(), func);
+    }
+
+    // Will return the number of chunks used by the algorithms, which need partial results.
+    inline size_t numChunks(const ExecutionPolicy &policy, size_t numItems) {
+        if (!policy.isParallel() || numItems == 0) {
+            return 1;
+        }
+        size_t chunks = 4 * (policy.getPool().getNumThreads() + 1);
+        if (policy.getGrainSize() != 0) {
+            chunks = (numItems + policy.getGrainSize() - 1) / policy.getGrainSize();
+        }
+        return chunks < numItems ? chunks : numItems;
+    }
+
+    inline size_t chunkBegin(size_t chunk, size_t numChunks, size_t numItems) {
+        return numItems / numChunks * chunk + (chunk < numItems % numChunks ? chunk : numItems % numChunks);
+    }
+
+} // namespace Details
+
+/// @brief  Will call the function for all items of a range.
+/// @tparam TRange  The range type, like TArray.
+/// @tparam TFunc   The function type, will get a reference to the item.
+/// @param policy   The execution policy.
+/// @param range    The range.
+/// @param func     The function, must not throw.
+template <class TRange, class TFunc>
+inline void parallelForEach(const ExecutionPolicy &policy, TRange &range, TFunc func) {
+    auto *data = range.data();
+    Details::forChunks(policy, range.size(), [data, &func](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            func(data[i]);
+        }
+    });
+}
+
+/// @brief  Will write func(in[i]) to out[i] for all items.
+/// @tparam TIn     The input range type, like TArray or TSpan.
+/// @tparam TOut    The output range type, like TArray.
+/// @tparam TFunc   The function type.
+/// @param policy   The execution policy.
+/// @param in       The input range.
+/// @param out      The output range, must be at least as big as the input range.
+/// @param func     The function, must not throw.
+template <class TIn, class TOut, class TFunc>
+inline void parallelTransform(const ExecutionPolicy &policy, const TIn &in, TOut &out, TFunc func) {
+    assert(out.size() >= in.size());
+    const auto *src = in.data();
+    auto *dst = out.data();
+    Details::forChunks(policy, in.size(), [src, dst, &func](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            dst[i] = func(src[i]);
+        }
+    });
+}
+
+/// @brief  Will combine all items with the operation.
+/// @tparam TRange  The range type, like TArray or TSpan.
+/// @tparam T       The result type.
+/// @tparam TOp     The operation type, must be associative.
+/// @param policy   The execution policy.
+/// @param range    The range.
+/// @param init     The initial value, will be combined with the result of the items.
+/// @param op       The operation, must not throw.
+/// @return The result, init for an empty range.
+template <class TRange, class T, class TOp>
+inline T parallelReduce(const ExecutionPolicy &policy, const TRange &range, T init, TOp op) {
+    const size_t numItems = range.size();
+    if (numItems == 0) {
+        return init;
+    }
+
+    const auto *data = range.data();
+    const size_t numChunks = Details::numChunks(policy, numItems);
+    TArray<T> partials(numChunks);
+    T *partialData = partials.data();
+    Details::forChunks(policy.isParallel() ? ExecutionPolicy::parallel(&policy.getPool(), 1) : policy, numChunks,
+            [data, partialData, numChunks, numItems, &op](size_t firstChunk, size_t lastChunk) {
+        for (size_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+            const size_t first = Details::chunkBegin(chunk, numChunks, numItems);
+            const size_t last = Details::chunkBegin(chunk + 1, numChunks, numItems);
+            T result = data[first];
+            for (size_t i = first + 1; i < last; ++i) {
+                result = op(result, data[i]);
+            }
+            partialData[chunk] = result;
+        }
+    });
+
+    T result = init;
+    for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+        result = op(result, partialData[chunk]);
+    }
+    return result;
+}
+
+/// @brief  Will compute the inclusive scan, out[i] = in[0] op ... op in[i].
+/// @tparam TIn     The input range type, like TArray or TSpan.
+/// @tparam TOut    The output range type, like TArray. May be the same as the input range.
+/// @tparam TOp     The operation type, must be associative.
+/// @param policy   The execution policy.
+/// @param in       The input range.
+/// @param out      The output range, must be at least as big as the input range.
+/// @param op       The operation, must not throw.
+template <class TIn, class TOut, class TOp>
+inline void parallelScan(const ExecutionPolicy &policy, const TIn &in, TOut &out, TOp op) {
+    using T = Details::RangeValue<TOut>;
+    assert(out.size() >= in.size());
+    const size_t numItems = in.size();
+    if (numItems == 0) {
+        return;
+    }
+
+    const auto *src = in.data();
+    T *dst = out.data();
+    const size_t numChunks = Details::numChunks(policy, numItems);
+    const ExecutionPolicy chunkPolicy = policy.isParallel() ? ExecutionPolicy::parallel(&policy.getPool(), 1) : policy;
+
+    // Scan each chunk on its own, then add the carry of all chunks before it
+    Details::forChunks(chunkPolicy, numChunks, [src, dst, numChunks, numItems, &op](size_t firstChunk, size_t lastChunk) {
+        for (size_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+            const size_t first = Details::chunkBegin(chunk, numChunks, numItems);
+            const size_t last = Details::chunkBegin(chunk + 1, numChunks, numItems);
+            T current = src[first];
+            dst[first] = current;
+            for (size_t i = first + 1; i < last; ++i) {
+                current = op(current, src[i]);
+                dst[i] = current;
+            }
+        }
+    });
+    if (numChunks == 1) {
+        return;
+    }
+
+    TArray<T> carries(numChunks);
+    T *carryData = carries.data();
+    carryData[1] = dst[Details::chunkBegin(1, numChunks, numItems) - 1];
+    for (size_t chunk = 2; chunk < numChunks; ++chunk) {
+        carryData[chunk] = op(carryData[chunk - 1], dst[Details::chunkBegin(chunk, numChunks, numItems) - 1]);
+    }
+
+    Details::forChunks(chunkPolicy, numChunks, [dst, carryData, numChunks, numItems, &op](size_t firstChunk, size_t lastChunk) {
+        for (size_t chunk = firstChunk < 1 ? 1 : firstChunk; chunk < lastChunk; ++chunk) {
+            const size_t first = Details::chunkBegin(chunk, numChunks, numItems);
+            const size_t last = Details::chunkBegin(chunk + 1, numChunks, numItems);
+            for (size_t i = first; i < last; ++i) {
+                dst[i] = op(carryData[chunk], dst[i]);
+            }
+        }
+    });
+}
+
+/// @brief  Will sort a range, see parallelSort in Sort.h.
+/// @tparam TRange      The range type, like TArray.
+/// @tparam TCompare    The compare type, returns true if the first item is lower.
+/// @param policy   The execution policy.
+/// @param range    The range.
+/// @param comp     The compare function, must not throw.
+/// @remark The sort is not stable.
+template <class TRange, class TCompare = TLess<Details::RangeValue<TRange>>>
+inline void parallelSort(const ExecutionPolicy &policy, TRange &range, TCompare comp = TCompare()) {
+    using T = Details::RangeValue<TRange>;
+    const size_t numItems = range.size();
+    if (!policy.isParallel() || numItems < Details::ParallelSortThreshold) {
+        sort(range.data(), numItems, comp);
+        return;
+    }
+
+    TArray<T> buffer(numItems);
+    parallelSort(range.data(), numItems, buffer.data(), comp, &policy.getPool());
+}
+
+} // namespace cppcore
@@ -24,131 +24,253 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <string.h>
 #include <cassert>
+#include <type_traits>
 
 namespace cppcore {
+namespace Details {
+
+/// @brief  Will be true for types, which can be compared by comparing their bytes.
+/// @remark Floats are not part of it, because of -0.0 == 0.0 and NaN != NaN.
+template <class T>
+struct IsBitwiseComparable : std::integral_constant<bool,
+        std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> {};
+
+/// @brief  Will be true for types, which can be filled by a byte-wise memset.
+template <class T>
+struct IsByteFillable : std::integral_constant<bool,
+        sizeof(T) == 1 && std::is_trivially_copyable<T>::value> {};
+
+} // namespace Details
 
 //-------------------------------------------------------------------------------------------------
-/// @class    TArray
+/// @class    TStaticArray
 /// @ingroup  CPPCore
 ///
-/// @brief This template class implements a simple array with dynamic boundaries.
+/// @brief This template class implements a simple array with a static size.
 ///
-/// You can use it to add new items, remove them and iterate through them. The data items are
-/// stores in an array.
+/// The size is a compile-time constant, so no size will be stored. The array is a literal type,
+/// so it can be created and filled in constant expressions. Use this for lookup tables, which
+/// shall be built by the compiler instead of at startup:
+/// @code
+/// constexpr TStaticArray<int, 16> makeSquares() {
+///     TStaticArray<int, 16> table;
+///     for (size_t i = 0; i < table.size(); ++i) {
+///         table[i] = static_cast<int>(i * i);
+///     }
+///     return table;
+/// }
+/// static constexpr TStaticArray<int, 16> Squares = makeSquares();
+/// @endcode
+/// For trivially copyable types the array is trivially copyable as well, so copies will be done
+/// by a memcpy.
 //-------------------------------------------------------------------------------------------------
 template <class T, size_t len>
 class TStaticArray {
 public:
-    /// @brief The default class constructor.
-    TStaticArray();
+    ///	The iterator type.
+    using Iterator = T *;
+    ///	The const iterator type.
+    using ConstIterator = const T *;
+
+    /// @brief The default class constructor, all items will be value-initialized.
+    constexpr TStaticArray();
 
     /// @brief  The class constructor with the initial value.
     /// @param[in] initValue    The initial value.
-    explicit TStaticArray(T initValue);
+    explicit constexpr TStaticArray(T initValue);
+
+    /// @brief  The class constructor with at least two values, missing items will be value-initialized.
+    ///         A single value in braces still fills the whole array, see above.
+    /// @param[in] first        The first value.
+    /// @param[in] second       The second value.
+    /// @param[in] rest         The other values, not more than the array size in total.
+    template <class... TValues>
+    constexpr TStaticArray(T first, T second, TValues... rest);
 
     /// @brief The copy constructor.
     /// @param  rhs [in] The array to copy from.
-    TStaticArray(const TStaticArray<T, len> &rhs);
+    TStaticArray(const TStaticArray<T, len> &rhs) = default;
 
     /// @brief  The class destructor.
     ~TStaticArray() = default;
 
     /// @brief  Returns the number of items in the array.
     /// @return  The size of the array.
-    size_t size() const;
+    constexpr size_t size() const;
 
     /// @brief  Will set the item at the given index.
     /// @param[in] index  The requested index.
     /// @param[in] value  The new value.
-    void set(size_t index, T value);
+    constexpr void set(size_t index, T value);
 
     /// @brief  Will set all values to the same value.
     /// @param[in] value   The value to set.
     void memset(T value);
 
+    /// @brief  Will return the data pointer.
+    /// @return The data pointer.
+    constexpr T *data();
+
+    /// @brief  Will return the data pointer.
+    /// @return The data pointer.
+    constexpr const T *data() const;
+
+    ///	@brief	Returns an iterator showing to the first item.
+    constexpr Iterator begin();
+
+    ///	@brief	Returns an iterator showing behind the last item.
+    constexpr Iterator end();
+
+    ///	@brief	Returns an iterator showing to the first item.
+    constexpr ConstIterator begin() const;
+
+    ///	@brief	Returns an iterator showing behind the last item.
+    constexpr ConstIterator end() const;
+
     /// @brief  The index op.
-    T operator[](size_t index) const;
+    constexpr T operator[](size_t index) const;
 
     /// @brief  The index op.
-    T &operator[](size_t index);
+    constexpr T &operator[](size_t index);
+
+    /// @brief  The compare operator, integral types will be compared by a memcmp.
     bool operator==(const TStaticArray<T, len> &rhs) const;
-    TStaticArray<T, len> &operator=(const TStaticArray<T, len> &rhs);
+
+    /// @brief  The not-equal operator.
+    bool operator!=(const TStaticArray<T, len> &rhs) const;
+
+    /// @brief  The assignment operator.
+    TStaticArray<T, len> &operator=(const TStaticArray<T, len> &rhs) = default;
+
+private:
+    void fill(T value, std::true_type);
+    void fill(T value, std::false_type);
+    bool isEqual(const TStaticArray<T, len> &rhs, std::true_type) const;
+    bool isEqual(const TStaticArray<T, len> &rhs, std::false_type) const;
 
 private:
     T mArray[len];
-    size_t mLen{0l};
 };
 
 template <class T, size_t len>
-inline TStaticArray<T, len>::TStaticArray() : mLen(len) {
+inline constexpr TStaticArray<T, len>::TStaticArray() :
+        mArray{} {
     // empty
 }
 
 template <class T, size_t len>
-inline TStaticArray<T, len>::TStaticArray(T initValue) : mLen(len) {
-    memset(initValue);
+inline constexpr TStaticArray<T, len>::TStaticArray(T initValue) :
+        mArray{} {
+    for (size_t i = 0; i < len; ++i) {
+        mArray[i] = initValue;
+    }
 }
 
 template <class T, size_t len>
-inline TStaticArray<T, len>::TStaticArray(const TStaticArray<T, len> &rhs) : mLen(rhs.mLen) {
-    for (size_t i = 0; i < mLen; ++i) {
-        mArray[i] = rhs.mArray[i];
-    }
+template <class... TValues>
+inline constexpr TStaticArray<T, len>::TStaticArray(T first, T second, TValues... rest) :
+        mArray{ first, second, static_cast<T>(rest)... } {
+    static_assert(sizeof...(TValues) + 2 <= len, "More values than array items.");
 }
 
 template <class T, size_t len>
-inline void TStaticArray<T, len>::set(size_t index, T value) {
-    assert(index < mLen);
+inline constexpr size_t TStaticArray<T, len>::size() const {
+    return len;
+}
+
+template <class T, size_t len>
+inline constexpr void TStaticArray<T, len>::set(size_t index, T value) {
+    assert(index < len);
 
     mArray[index] = value;
 }
 
 template <class T, size_t len>
 inline void TStaticArray<T, len>::memset(T value) {
-    for (size_t i = 0; i < mLen; ++i) {
-        mArray[i] = value;
-    }
+    fill(value, Details::IsByteFillable<T>());
 }
 
 template <class T, size_t len>
-inline size_t TStaticArray<T, len>::size() const {
-    return mLen;
+inline constexpr T *TStaticArray<T, len>::data() {
+    return mArray;
 }
 
 template <class T, size_t len>
-inline T TStaticArray<T, len>::operator[](size_t index) const {
-    assert(index < mLen);
+inline constexpr const T *TStaticArray<T, len>::data() const {
+    return mArray;
+}
+
+template <class T, size_t len>
+inline constexpr typename TStaticArray<T, len>::Iterator TStaticArray<T, len>::begin() {
+    return mArray;
+}
+
+template <class T, size_t len>
+inline constexpr typename TStaticArray<T, len>::Iterator TStaticArray<T, len>::end() {
+    return mArray + len;
+}
+
+template <class T, size_t len>
+inline constexpr typename TStaticArray<T, len>::ConstIterator TStaticArray<T, len>::begin() const {
+    return mArray;
+}
+
+template <class T, size_t len>
+inline constexpr typename TStaticArray<T, len>::ConstIterator TStaticArray<T, len>::end() const {
+    return mArray + len;
+}
+
+template <class T, size_t len>
+inline constexpr T TStaticArray<T, len>::operator[](size_t index) const {
+    assert(index < len);
 
     return mArray[index];
 }
 
 template <class T, size_t len>
-inline T &TStaticArray<T, len>::operator[](size_t index) {
+inline constexpr T &TStaticArray<T, len>::operator[](size_t index) {
+    assert(index < len);
+
     return mArray[index];
 }
 
 template <class T, size_t len>
 inline bool TStaticArray<T, len>::operator==(const TStaticArray<T, len> &rhs) const {
-    for (size_t i = 0; i < mLen; ++i) {
-        if (mArray[i] != rhs.mArray[i]) {
-            return false;
-        }
-    }
+    return isEqual(rhs, Details::IsBitwiseComparable<T>());
+}
 
-    return true;
+template <class T, size_t len>
+inline bool TStaticArray<T, len>::operator!=(const TStaticArray<T, len> &rhs) const {
+    return !(*this == rhs);
 }
 
 template <class T, size_t len>
-inline TStaticArray<T, len> &TStaticArray<T, len>::operator = (const TStaticArray<T, len> &rhs) {
-    if (*this == rhs) {
-        return *this;
+inline void TStaticArray<T, len>::fill(T value, std::true_type) {
+    ::memset(mArray, static_cast<int>(reinterpret_cast<const unsigned char &>(value)), len);
+}
+
+template <class T, size_t len>
+inline void TStaticArray<T, len>::fill(T value, std::false_type) {
+    // Simple loop without any dependencies, the compiler will vectorize it
+    for (size_t i = 0; i < len; ++i) {
+        mArray[i] = value;
     }
+}
 
-    for (unsigned int i = 0; i < mLen; ++i) {
-       mArray[i] = rhs.mArray[i];
+template <class T, size_t len>
+inline bool TStaticArray<T, len>::isEqual(const TStaticArray<T, len> &rhs, std::true_type) const {
+    return ::memcmp(mArray, rhs.mArray, sizeof(mArray)) == 0;
+}
+
+template <class T, size_t len>
+inline bool TStaticArray<T, len>::isEqual(const TStaticArray<T, len> &rhs, std::false_type) const {
+    for (size_t i = 0; i < len; ++i) {
+        if (!(mArray[i] == rhs.mArray[i])) {
+            return false;
+        }
     }
 
-    return *this;
+    return true;
 }
 
 } // namespace cppcore
@@ -0,0 +1,121 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/Checksum.h>
+#include <cppcore/Common/CPUInfo.h>
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace cppcore;
+
+class ChecksumTest : public testing::Test {
+protected:
+    void SetUp() override {
+        mData.resize(100000);
+        for (size_t i = 0; i < mData.size(); ++i) {
+            mData[i] = static_cast<uint8_t>(i * 7 + 3);
+        }
+    }
+
+    void TearDown() override {
+        CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::AVX2);
+    }
+
+    template <class TCheck>
+    void forAllLevels(TCheck check) {
+        const CPUInfo::SimdLevel levels[] = { CPUInfo::SimdLevel::AVX2, CPUInfo::SimdLevel::SSE42, CPUInfo::SimdLevel::Scalar };
+        for (CPUInfo::SimdLevel level : levels) {
+            CPUInfo::setSimdLevelLimit(level);
+            check();
+        }
+    }
+
+    std::vector<uint8_t> mData;
+};
+
+TEST_F(ChecksumTest, crc32cTest) {
+    forAllLevels([this]() {
+        EXPECT_EQ(0u, crc32c(nullptr, 0));
+        EXPECT_EQ(0xe3069283u, crc32c("123456789", 9));
+        EXPECT_EQ(0xdd2edff7u, crc32c(mData.data(), 1000));
+        EXPECT_EQ(0x96f31dc6u, crc32c(mData.data(), mData.size()));
+
+        // Unaligned start and chunked input
+        EXPECT_EQ(crc32c(mData.data() + 3, 30000), crc32c(mData.data() + 3 + 1000, 29000, crc32c(mData.data() + 3, 1000)));
+        uint32_t crc = 0;
+        for (size_t i = 0; i < mData.size(); i += 777) {
+            crc = crc32c(mData.data() + i, mData.size() - i < 777 ? mData.size() - i : 777, crc);
+        }
+        EXPECT_EQ(0x96f31dc6u, crc);
+    });
+}
+
+TEST_F(ChecksumTest, adler32Test) {
+    forAllLevels([this]() {
+        EXPECT_EQ(1u, adler32(nullptr, 0));
+        EXPECT_EQ(0x11e60398u, adler32("Wikipedia", 9));
+        EXPECT_EQ(0x38adedfcu, adler32(mData.data(), 1000));
+        EXPECT_EQ(0x2dfb940fu, adler32(mData.data(), mData.size()));
+
+        // All bytes 0xff is the worst case for the sums
+        const std::vector<uint8_t> ones(20000, 0xff);
+        uint32_t expected = 1;
+        for (size_t i = 0; i < ones.size(); ++i) {
+            const uint32_t s1 = ((expected & 0xffff) + 0xff) % 65521u;
+            const uint32_t s2 = ((expected >> 16) + s1) % 65521u;
+            expected = (s2 << 16) | s1;
+        }
+        EXPECT_EQ(expected, adler32(ones.data(), ones.size()));
+
+        uint32_t adler = 1;
+        for (size_t i = 0; i < mData.size(); i += 1001) {
+            adler = adler32(mData.data() + i, mData.size() - i < 1001 ? mData.size() - i : 1001, adler);
+        }
+        EXPECT_EQ(0x2dfb940fu, adler);
+    });
+}
+
+TEST_F(ChecksumTest, xxh64Test) {
+    EXPECT_EQ(0xef46db3751d8e999ull, xxh64("", 0));
+    EXPECT_EQ(0x44bc2cf5ad770999ull, xxh64("abc", 3));
+    EXPECT_EQ(0xa2aa5f33cc4a6119ull, xxh64(mData.data(), 31));
+    EXPECT_EQ(0xda5863f05510e1ebull, xxh64(mData.data(), mData.size(), 42));
+
+    for (size_t chunk : { 1u, 7u, 32u, 33u, 1000u }) {
+        Xxh64Hasher hasher(42);
+        for (size_t i = 0; i < mData.size(); i += chunk) {
+            hasher.update(mData.data() + i, mData.size() - i < chunk ? mData.size() - i : chunk);
+        }
+        EXPECT_EQ(0xda5863f05510e1ebull, hasher.finish());
+    }
+
+    Xxh64Hasher hasher;
+    hasher.update("a", 1);
+    hasher.update("bc", 2);
+    EXPECT_EQ(0x44bc2cf5ad770999ull, hasher.finish());
+    hasher.reset();
+    EXPECT_EQ(0xef46db3751d8e999ull, hasher.finish());
+}
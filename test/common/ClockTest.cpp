@@ -0,0 +1,111 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <gtest/gtest.h>
+
+#include <cppcore/Common/Clock.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace cppcore;
+
+class ClockTest : public ::testing::Test {};
+
+TEST_F(ClockTest, nowTest) {
+    uint64_t last = Clock::now();
+    for (int i = 0; i < 1000; ++i) {
+        const uint64_t current = Clock::now();
+        EXPECT_GE(current, last);
+        last = current;
+    }
+
+    const uint64_t start = Clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const uint64_t elapsed = Clock::now() - start;
+    EXPECT_GE(elapsed, 20000000u);
+    EXPECT_LT(elapsed, 2000000000u);
+}
+
+TEST_F(ClockTest, ticksTest) {
+    const uint64_t startNs = Clock::now();
+    const uint64_t startTicks = Clock::ticks();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    const uint64_t elapsedTicks = Clock::ticks() - startTicks;
+    const uint64_t elapsedNs = Clock::now() - startNs;
+
+    // The calibrated ticks must match the system clock
+    const double ratio = static_cast<double>(Clock::toNanoseconds(elapsedTicks)) / static_cast<double>(elapsedNs);
+    EXPECT_GT(ratio, 0.95);
+    EXPECT_LT(ratio, 1.05);
+    if (!Clock::usesTimeStampCounter()) {
+        EXPECT_EQ(elapsedTicks, Clock::toNanoseconds(elapsedTicks));
+    }
+}
+
+TEST_F(ClockTest, stopwatchTest) {
+    Stopwatch stopwatch;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const uint64_t elapsed = stopwatch.elapsedNanoseconds();
+    EXPECT_GE(elapsed, 19000000u);
+    EXPECT_GE(stopwatch.elapsedSeconds(), 0.019);
+    EXPECT_LE(elapsed, stopwatch.elapsedNanoseconds());
+
+    stopwatch.restart();
+    EXPECT_LT(stopwatch.elapsedNanoseconds(), elapsed);
+}
+
+namespace {
+
+class TestSink : public TimerSink {
+public:
+    void report(const char *name, uint64_t nanoseconds) override {
+        names += name;
+        names += ";";
+        total += nanoseconds;
+        ++numReports;
+    }
+
+    std::string names;
+    uint64_t total{0};
+    int numReports{0};
+};
+
+} // namespace
+
+TEST_F(ClockTest, scopedTimerTest) {
+    TestSink sink;
+    {
+        ScopedTimer outer(sink, "outer");
+        {
+            ScopedTimer inner(sink, "inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        EXPECT_EQ(1, sink.numReports);
+    }
+    EXPECT_EQ(2, sink.numReports);
+    EXPECT_EQ("inner;outer;", sink.names);
+    EXPECT_GE(sink.total, 19000000u);
+}
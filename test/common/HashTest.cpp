@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -------------------------------------------------------------------------------------------------
 */
 #include <cppcore/Common/Hash.h>
+#include <cppcore/Common/BitUtils.h>
 
 #include "gtest/gtest.h"
 
@@ -93,3 +94,100 @@ TEST_F( HashTest, MakeUIntHashTest ) {
     UiHash myHash_inited(value, Base);
     EXPECT_EQ( myHash_inited.hashValue(), hash3 );
 }
+
+TEST_F( HashTest, Mix64Test ) {
+    EXPECT_NE( mix64(1), mix64(2) );
+    EXPECT_EQ( mix64(42), mix64(42) );
+
+    // Flipping one input bit should flip about half of the output bits
+    size_t flipped = 0;
+    for (uint64_t i = 0; i < 64; ++i) {
+        flipped += popCount(mix64(12345) ^ mix64(12345 ^ (1ull << i)));
+    }
+    EXPECT_GT( flipped, 64u * 24u );
+    EXPECT_LT( flipped, 64u * 40u );
+
+    EXPECT_NE( hashCombine(hashCombine(0, 1), 2), hashCombine(hashCombine(0, 2), 1) );
+}
+
+TEST_F( HashTest, Hash64Test ) {
+    uint8_t data[300];
+    for (size_t i = 0; i < sizeof(data); ++i) {
+        data[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    // Every length and every changed byte must give a different hash
+    for (size_t len = 0; len < 100; ++len) {
+        const HashId hash = hash64(data, len);
+        EXPECT_EQ( hash, hash64(data, len) );
+        EXPECT_NE( hash, hash64(data, len + 1) );
+        EXPECT_NE( hash, hash64(data, len, 1) );
+        for (size_t i = 0; i < len; ++i) {
+            data[i] ^= 0x10;
+            EXPECT_NE( hash, hash64(data, len) );
+            data[i] ^= 0x10;
+        }
+    }
+
+    // Zero bytes at the end are not ignored
+    const uint8_t zeros[64] = {};
+    EXPECT_NE( hash64(zeros, 40), hash64(zeros, 41) );
+    EXPECT_NE( hash64(zeros, 0), hash64(zeros, 1) );
+}
+
+TEST_F( HashTest, Hasher64Test ) {
+    uint8_t data[300];
+    for (size_t i = 0; i < sizeof(data); ++i) {
+        data[i] = static_cast<uint8_t>(i * 13 + 1);
+    }
+
+    for (size_t len : { 0u, 1u, 5u, 16u, 31u, 32u, 33u, 63u, 64u, 65u, 100u, 300u }) {
+        const HashId expected = hash64(data, len, 7);
+        for (size_t chunk : { 1u, 3u, 16u, 32u, 33u, 100u }) {
+            Hasher64 hasher(7);
+            for (size_t i = 0; i < len; i += chunk) {
+                hasher.update(data + i, len - i < chunk ? len - i : chunk);
+            }
+            EXPECT_EQ( expected, hasher.finish() );
+        }
+    }
+
+    Hasher64 hasher;
+    hasher.update(data, 50);
+    const HashId first = hasher.finish();
+    hasher.update(data + 50, 50);
+    EXPECT_EQ( hash64(data, 50), first );
+    EXPECT_EQ( hash64(data, 100), hasher.finish() );
+    hasher.reset();
+    EXPECT_EQ( hash64(data, 0), hasher.finish() );
+}
+
+TEST_F( HashTest, ConstHashTest ) {
+    static_assert( "texture"_hash == constHash("texture"), "Literal and function must match" );
+    static_assert( "a\0b"_hash != "a"_hash, "The literal must use the whole length" );
+    static_assert( "a path which is longer than one block of the hash"_hash != 0, "Long keys are constant too" );
+
+    static constexpr char name[] = "assets/texture.png";
+    constexpr HashId nameHash = constHash(name);
+    constexpr HashId seededHash = constHash(name, sizeof(name) - 1, 7);
+    EXPECT_EQ( hash64(name, sizeof(name) - 1), nameHash );
+    EXPECT_EQ( hash64(name, sizeof(name) - 1), "assets/texture.png"_hash );
+    EXPECT_EQ( hash64(name, sizeof(name) - 1, 7), seededHash );
+
+    // All paths of hash64, bytes above 127 are hashed unsigned like at runtime
+    char data[100];
+    for (size_t i = 0; i < sizeof(data); ++i) {
+        data[i] = static_cast<char>(i * 37 + 101);
+    }
+    for (size_t len = 0; len <= sizeof(data); ++len) {
+        EXPECT_EQ( hash64(data, len), constHash(data, len) );
+    }
+
+    HashId id = 0;
+    switch (constHash("move")) {
+        case "stop"_hash: id = 1; break;
+        case "move"_hash: id = 2; break;
+        default: break;
+    }
+    EXPECT_EQ( 2u, id );
+}
@@ -25,8 +25,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 using namespace cppcore;
 
+namespace {
+    DECL_LOG_MODULE(LoggerTest)
+}
+
 class LoggerTest : public testing::Test {};
 
 TEST_F(LoggerTest, CreateTest) {
     // will come    
 }
+
+TEST_F(LoggerTest, TagIdTest) {
+    static_assert(TagId == "LoggerTest"_hash, "The tag id must be known at compile time");
+    EXPECT_EQ(hash64(Tag, sizeof(Tag) - 1), TagId);
+}
@@ -0,0 +1,281 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <gtest/gtest.h>
+
+#include <cppcore/Common/NumberConversion.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace cppcore;
+
+class NumberConversionTest : public ::testing::Test {
+protected:
+    static TStringView<char> view(const char *str) {
+        return TStringView<char>(str, strlen(str));
+    }
+
+    static bool sameBits(double a, double b) {
+        return memcmp(&a, &b, sizeof(double)) == 0;
+    }
+
+    static bool sameBits(float a, float b) {
+        return memcmp(&a, &b, sizeof(float)) == 0;
+    }
+};
+
+TEST_F(NumberConversionTest, parseIntTest) {
+    int64_t value = 0;
+    EXPECT_EQ(3u, parseInt(view("123"), value));
+    EXPECT_EQ(123, value);
+    EXPECT_EQ(3u, parseInt(view("-42,"), value));
+    EXPECT_EQ(-42, value);
+    EXPECT_EQ(2u, parseInt(view("+7"), value));
+    EXPECT_EQ(7, value);
+    EXPECT_EQ(19u, parseInt(view("9223372036854775807"), value));
+    EXPECT_EQ(INT64_MAX, value);
+    EXPECT_EQ(20u, parseInt(view("-9223372036854775808"), value));
+    EXPECT_EQ(INT64_MIN, value);
+    EXPECT_EQ(24u, parseInt(view("000009223372036854775807"), value));
+    EXPECT_EQ(INT64_MAX, value);
+
+    // Failures will not touch the value
+    value = 5;
+    EXPECT_EQ(0u, parseInt(view("9223372036854775808"), value));
+    EXPECT_EQ(0u, parseInt(view(""), value));
+    EXPECT_EQ(0u, parseInt(view("-"), value));
+    EXPECT_EQ(0u, parseInt(view(" 1"), value));
+    EXPECT_EQ(5, value);
+
+    int32_t value32 = 0;
+    EXPECT_EQ(11u, parseInt(view("-2147483648"), value32));
+    EXPECT_EQ(INT32_MIN, value32);
+    EXPECT_EQ(0u, parseInt(view("2147483648"), value32));
+
+    uint64_t valueU64 = 0;
+    EXPECT_EQ(20u, parseInt(view("18446744073709551615"), valueU64));
+    EXPECT_EQ(UINT64_MAX, valueU64);
+    EXPECT_EQ(0u, parseInt(view("18446744073709551616"), valueU64));
+    EXPECT_EQ(0u, parseInt(view("184467440737095516150"), valueU64));
+    EXPECT_EQ(0u, parseInt(view("-1"), valueU64));
+
+    uint32_t valueU32 = 0;
+    EXPECT_EQ(10u, parseInt(view("4294967295"), valueU32));
+    EXPECT_EQ(UINT32_MAX, valueU32);
+    EXPECT_EQ(0u, parseInt(view("4294967296"), valueU32));
+}
+
+TEST_F(NumberConversionTest, formatIntTest) {
+    char buffer[MaxIntChars];
+    EXPECT_EQ(1u, formatInt(int64_t(0), buffer, sizeof(buffer)));
+    EXPECT_STREQ("0", buffer);
+    EXPECT_EQ(20u, formatInt(INT64_MIN, buffer, sizeof(buffer)));
+    EXPECT_STREQ("-9223372036854775808", buffer);
+    EXPECT_EQ(20u, formatInt(UINT64_MAX, buffer, sizeof(buffer)));
+    EXPECT_STREQ("18446744073709551615", buffer);
+    EXPECT_EQ(11u, formatInt(INT32_MIN, buffer, sizeof(buffer)));
+    EXPECT_STREQ("-2147483648", buffer);
+    EXPECT_EQ(3u, formatInt(uint32_t(100), buffer, sizeof(buffer)));
+    EXPECT_STREQ("100", buffer);
+
+    // The zero needs space as well
+    EXPECT_EQ(0u, formatInt(int64_t(1234), buffer, 4));
+    EXPECT_EQ(4u, formatInt(int64_t(1234), buffer, 5));
+
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 10000; ++i) {
+        const int64_t value = static_cast<int64_t>(rng()) >> (rng() % 64);
+        char expected[MaxIntChars];
+        snprintf(expected, sizeof(expected), "%lld", static_cast<long long>(value));
+        const size_t len = formatInt(value, buffer, sizeof(buffer));
+        ASSERT_STREQ(expected, buffer);
+
+        int64_t parsed = 0;
+        EXPECT_EQ(len, parseInt(TStringView<char>(buffer, len), parsed));
+        EXPECT_EQ(value, parsed);
+    }
+}
+
+TEST_F(NumberConversionTest, parseFloatTest) {
+    double value = 0.0;
+    EXPECT_EQ(3u, parseFloat(view("0.1"), value));
+    EXPECT_EQ(0.1, value);
+    EXPECT_EQ(6u, parseFloat(view("-1.5e3x"), value));
+    EXPECT_EQ(-1500.0, value);
+    EXPECT_EQ(4u, parseFloat(view("1e23"), value));
+    EXPECT_EQ(1e23, value);
+    EXPECT_EQ(2u, parseFloat(view(".5"), value));
+    EXPECT_EQ(0.5, value);
+    EXPECT_EQ(2u, parseFloat(view("5."), value));
+    EXPECT_EQ(5.0, value);
+    EXPECT_EQ(22u, parseFloat(view("1.7976931348623157e308"), value));
+    EXPECT_EQ(1.7976931348623157e308, value);
+    EXPECT_EQ(8u, parseFloat(view("4.9e-324"), value));
+    EXPECT_EQ(4.9e-324, value);
+    EXPECT_EQ(5u, parseFloat(view("1e400"), value));
+    EXPECT_TRUE(std::isinf(value));
+    EXPECT_EQ(2u, parseFloat(view("-0"), value));
+    EXPECT_TRUE(sameBits(-0.0, value));
+
+    // The 'e' is not a part of the number without exponent digits
+    EXPECT_EQ(1u, parseFloat(view("2e"), value));
+    EXPECT_EQ(2.0, value);
+    EXPECT_EQ(1u, parseFloat(view("2e+"), value));
+
+    EXPECT_EQ(3u, parseFloat(view("inf"), value));
+    EXPECT_TRUE(std::isinf(value));
+    EXPECT_EQ(9u, parseFloat(view("-Infinity"), value));
+    EXPECT_TRUE(std::isinf(value) && value < 0.0);
+    EXPECT_EQ(3u, parseFloat(view("NaN"), value));
+    EXPECT_TRUE(std::isnan(value));
+
+    value = 3.0;
+    EXPECT_EQ(0u, parseFloat(view(""), value));
+    EXPECT_EQ(0u, parseFloat(view("."), value));
+    EXPECT_EQ(0u, parseFloat(view("-e5"), value));
+    EXPECT_EQ(3.0, value);
+
+    // Exactly halfway between 2^53 and 2^53 + 2, decided by the digits behind the 19th
+    EXPECT_EQ(16u, parseFloat(view("9007199254740993"), value));
+    EXPECT_EQ(9007199254740992.0, value);
+    EXPECT_EQ(36u, parseFloat(view("9007199254740993.0000000000000000001"), value));
+    EXPECT_EQ(9007199254740994.0, value);
+
+    float valueF = 0.0f;
+    EXPECT_EQ(3u, parseFloat(view("0.1"), valueF));
+    EXPECT_EQ(0.1f, valueF);
+    EXPECT_EQ(13u, parseFloat(view("3.4028235e+38f"), valueF));
+    EXPECT_EQ(3.4028235e+38f, valueF);
+}
+
+TEST_F(NumberConversionTest, parseFloatMatchesStrtodTest) {
+    std::mt19937_64 rng(11);
+    char buffer[128];
+    for (int i = 0; i < 100000; ++i) {
+        const int len = snprintf(buffer, sizeof(buffer), "%llu.%llue%d",
+                static_cast<unsigned long long>(rng() >> (rng() % 64)),
+                static_cast<unsigned long long>(rng() >> (rng() % 64)),
+                static_cast<int>(rng() % 700) - 350);
+        double value = 0.0;
+        ASSERT_EQ(static_cast<size_t>(len), parseFloat(TStringView<char>(buffer, len), value));
+        ASSERT_TRUE(sameBits(strtod(buffer, nullptr), value)) << buffer;
+
+        float valueF = 0.0f;
+        parseFloat(TStringView<char>(buffer, len), valueF);
+        ASSERT_TRUE(sameBits(strtof(buffer, nullptr), valueF)) << buffer;
+    }
+}
+
+TEST_F(NumberConversionTest, formatFloatTest) {
+    char buffer[MaxFloatChars];
+    EXPECT_EQ(3u, formatFloat(0.1, buffer, sizeof(buffer)));
+    EXPECT_STREQ("0.1", buffer);
+    formatFloat(0.0, buffer, sizeof(buffer));
+    EXPECT_STREQ("0", buffer);
+    formatFloat(-0.0, buffer, sizeof(buffer));
+    EXPECT_STREQ("-0", buffer);
+    formatFloat(100.0, buffer, sizeof(buffer));
+    EXPECT_STREQ("100", buffer);
+    formatFloat(-123.456, buffer, sizeof(buffer));
+    EXPECT_STREQ("-123.456", buffer);
+    formatFloat(1e16, buffer, sizeof(buffer));
+    EXPECT_STREQ("10000000000000000", buffer);
+    formatFloat(1e17, buffer, sizeof(buffer));
+    EXPECT_STREQ("1e+17", buffer);
+    formatFloat(0.00001, buffer, sizeof(buffer));
+    EXPECT_STREQ("0.00001", buffer);
+    formatFloat(1e-6, buffer, sizeof(buffer));
+    EXPECT_STREQ("1e-6", buffer);
+    formatFloat(0.1 + 0.2, buffer, sizeof(buffer));
+    EXPECT_STREQ("0.30000000000000004", buffer);
+    formatFloat(1.7976931348623157e308, buffer, sizeof(buffer));
+    EXPECT_STREQ("1.7976931348623157e+308", buffer);
+    formatFloat(5e-324, buffer, sizeof(buffer));
+    EXPECT_STREQ("5e-324", buffer);
+    formatFloat(2.2250738585072014e-308, buffer, sizeof(buffer));
+    EXPECT_STREQ("2.2250738585072014e-308", buffer);
+    formatFloat(-std::numeric_limits<double>::infinity(), buffer, sizeof(buffer));
+    EXPECT_STREQ("-inf", buffer);
+    formatFloat(std::numeric_limits<double>::quiet_NaN(), buffer, sizeof(buffer));
+    EXPECT_STREQ("nan", buffer);
+
+    formatFloat(0.1f, buffer, sizeof(buffer));
+    EXPECT_STREQ("0.1", buffer);
+    formatFloat(1.0f / 3.0f, buffer, sizeof(buffer));
+    EXPECT_STREQ("0.33333334", buffer);
+    formatFloat(1e-45f, buffer, sizeof(buffer));
+    EXPECT_STREQ("1e-45", buffer);
+
+    // Too small buffers will not be written
+    EXPECT_EQ(0u, formatFloat(0.125, buffer, 5));
+    EXPECT_EQ(5u, formatFloat(0.125, buffer, 6));
+}
+
+TEST_F(NumberConversionTest, formatFloatRoundTripTest) {
+    std::mt19937_64 rng(3);
+    char buffer[MaxFloatChars];
+    char reference[32];
+    for (int i = 0; i < 100000; ++i) {
+        const uint64_t bits = rng();
+        double value = 0.0;
+        memcpy(&value, &bits, sizeof(value));
+        if (std::isnan(value)) {
+            continue;
+        }
+
+        const size_t len = formatFloat(value, buffer, sizeof(buffer));
+        ASSERT_NE(0u, len);
+        double parsed = 0.0;
+        ASSERT_EQ(len, parseFloat(TStringView<char>(buffer, len), parsed));
+        ASSERT_TRUE(sameBits(value, parsed)) << buffer;
+        ASSERT_TRUE(sameBits(value, strtod(buffer, nullptr))) << buffer;
+
+        // No shorter number of digits will round-trip
+        const char *mantissaEnd = strchr(buffer, 'e');
+        if (mantissaEnd != nullptr) {
+            int numDigits = 0;
+            for (const char *c = buffer; c != mantissaEnd; ++c) {
+                numDigits += (*c >= '0' && *c <= '9') ? 1 : 0;
+            }
+            snprintf(reference, sizeof(reference), "%.*e", numDigits - 2, value);
+            EXPECT_FALSE(numDigits > 1 && strtod(reference, nullptr) == value) << buffer;
+        }
+
+        float valueF = 0.0f;
+        const uint32_t bitsF = static_cast<uint32_t>(bits);
+        memcpy(&valueF, &bitsF, sizeof(valueF));
+        if (std::isnan(valueF)) {
+            continue;
+        }
+        const size_t lenF = formatFloat(valueF, buffer, sizeof(buffer));
+        float parsedF = 0.0f;
+        ASSERT_EQ(lenF, parseFloat(TStringView<char>(buffer, lenF), parsedF));
+        ASSERT_TRUE(sameBits(valueF, parsedF)) << buffer;
+    }
+}
@@ -23,9 +23,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -------------------------------------------------------------------------------------------------
 */
 #include <cppcore/Common/Sort.h>
+#include <cppcore/Common/CPUInfo.h>
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 using namespace cppcore;
 
 class SortTest : public testing::Test {};
@@ -63,3 +68,342 @@ TEST_F(SortTest, binSearchTest) {
     int32_t idx = binSearch(3, arr, 5, compDescending<int32_t>);
     EXPECT_EQ(idx, 2);
 }
+
+namespace {
+
+    struct Record {
+        uint64_t key;
+        uint64_t payload[3];
+    };
+
+    template <class T, class TCompare>
+    bool checkSorted(const T *data, size_t num, TCompare comp) {
+        for (size_t i = 1; i < num; ++i) {
+            if (comp(data[i], data[i - 1])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+TEST_F(SortTest, sortTest) {
+    for (size_t num : { 0u, 1u, 2u, 3u, 16u, 17u, 100u, 1000u, 10000u }) {
+        int32_t *data = new int32_t[num + 1];
+        uint32_t state = 42u;
+
+        // Random, sorted, reversed, all equal and organ pipe
+        for (int pattern = 0; pattern < 5; ++pattern) {
+            for (size_t i = 0; i < num; ++i) {
+                state = state * 1664525u + 1013904223u;
+                switch (pattern) {
+                    case 0: data[i] = static_cast<int32_t>(state >> 4); break;
+                    case 1: data[i] = static_cast<int32_t>(i); break;
+                    case 2: data[i] = static_cast<int32_t>(num - i); break;
+                    case 3: data[i] = 7; break;
+                    default: data[i] = static_cast<int32_t>(i < num / 2 ? i : num - i); break;
+                }
+            }
+            sort(data, num);
+            EXPECT_TRUE(checkSorted(data, num, TLess<int32_t>()));
+        }
+        delete[] data;
+    }
+}
+
+TEST_F(SortTest, sortCompareTest) {
+    Record records[500];
+    for (size_t i = 0; i < 500; ++i) {
+        records[i].key = (i * 7919u) % 500u;
+        records[i].payload[0] = records[i].key * 2;
+    }
+    auto greater = [](const Record &lhs, const Record &rhs) { return lhs.key > rhs.key; };
+    sort(records, 500, greater);
+    EXPECT_TRUE(checkSorted(records, 500, greater));
+    for (size_t i = 0; i < 500; ++i) {
+        EXPECT_EQ(records[i].key * 2, records[i].payload[0]);
+    }
+    EXPECT_EQ(499u, records[0].key);
+}
+
+TEST_F(SortTest, heapSortFallbackTest) {
+    float data[300];
+    for (size_t i = 0; i < 300; ++i) {
+        data[i] = static_cast<float>((i * 31) % 300) * 0.5f;
+    }
+    // A depth limit of zero forces the heapsort fallback
+    TLess<float> comp;
+    Details::introsortLoop(data, 300, 0, comp);
+    EXPECT_TRUE(checkSorted(data, 300, comp));
+}
+
+namespace {
+
+    template <class T>
+    void checkRadixSort(T (*make)(uint32_t)) {
+        for (size_t num : { 0u, 1u, 2u, 100u, 5000u }) {
+            T *keys = new T[num + 1];
+            T *expected = new T[num + 1];
+            T *scratch = new T[num + 1];
+            uint32_t state = 7u;
+            for (size_t i = 0; i < num; ++i) {
+                state = state * 1664525u + 1013904223u;
+                keys[i] = expected[i] = make(state);
+            }
+            sort(expected, num);
+            radixSort(keys, num, scratch);
+            for (size_t i = 0; i < num; ++i) {
+                EXPECT_EQ(expected[i], keys[i]);
+            }
+            delete[] keys;
+            delete[] expected;
+            delete[] scratch;
+        }
+    }
+
+} // namespace
+
+TEST_F(SortTest, radixSortTest) {
+    checkRadixSort<uint32_t>([](uint32_t v) { return v; });
+    checkRadixSort<int32_t>([](uint32_t v) { return static_cast<int32_t>(v); });
+    checkRadixSort<uint64_t>([](uint32_t v) { return static_cast<uint64_t>(v) << 20 | v; });
+    checkRadixSort<int64_t>([](uint32_t v) { return static_cast<int64_t>(v) - static_cast<int64_t>(2000000000); });
+    checkRadixSort<int16_t>([](uint32_t v) { return static_cast<int16_t>(v >> 16); });
+    checkRadixSort<float>([](uint32_t v) { return (static_cast<float>(v >> 8) - 8000000.0f) * 0.001f; });
+    checkRadixSort<double>([](uint32_t v) { return static_cast<double>(static_cast<int32_t>(v)) * 1e-3; });
+
+    // Only the lowest byte differs, so the other passes are skipped
+    uint32_t keys[] = { 0x1005u, 0x1003u, 0x1004u, 0x1001u };
+    uint32_t scratch[4];
+    radixSort(keys, 4, scratch);
+    EXPECT_EQ(0x1001u, keys[0]);
+    EXPECT_EQ(0x1005u, keys[3]);
+}
+
+TEST_F(SortTest, radixSortKeyValueTest) {
+    // Equal keys must keep the order of their values
+    const size_t Num = 1000;
+    int32_t keys[Num], keyScratch[Num];
+    uint32_t values[Num], valueScratch[Num];
+    for (size_t i = 0; i < Num; ++i) {
+        keys[i] = static_cast<int32_t>(i % 10) - 5;
+        values[i] = static_cast<uint32_t>(i);
+    }
+    radixSort(keys, values, Num, keyScratch, valueScratch);
+    for (size_t i = 1; i < Num; ++i) {
+        EXPECT_LE(keys[i - 1], keys[i]);
+        if (keys[i - 1] == keys[i]) {
+            EXPECT_LT(values[i - 1], values[i]);
+        }
+        EXPECT_EQ(keys[i], static_cast<int32_t>(values[i] % 10) - 5);
+    }
+}
+
+namespace {
+
+    int32_t compareScaled(const void *lhs, const void *rhs) {
+        // Returns other negative values than -1
+        const int32_t l = *static_cast<const int32_t *>(lhs);
+        const int32_t r = *static_cast<const int32_t *>(rhs);
+        return (r - l) * 5;
+    }
+
+} // namespace
+
+TEST_F(SortTest, isSortedNegativeResultTest) {
+    int32_t sorted[] = { 1, 2, 3, 4, 5 };
+    int32_t unsorted[] = { 1, 2, 4, 3, 5 };
+    EXPECT_TRUE(isSorted(sorted, 5, sizeof(int32_t), compareScaled));
+    EXPECT_FALSE(isSorted(unsorted, 5, sizeof(int32_t), compareScaled));
+    EXPECT_TRUE(isSorted(sorted, 5));
+    EXPECT_FALSE(isSorted(unsorted, 5));
+}
+
+TEST_F(SortTest, stableSortTest) {
+    for (size_t num : { 0u, 1u, 2u, 63u, 64u, 65u, 1000u, 20000u }) {
+        Record *records = new Record[num + 1];
+        Record *buffer = new Record[num / 2 + 1];
+        auto byKey = [](const Record &lhs, const Record &rhs) { return lhs.key < rhs.key; };
+
+        // Random with many duplicates, sorted, reversed and a saw tooth of runs
+        for (int pattern = 0; pattern < 4; ++pattern) {
+            uint32_t state = 99u;
+            for (size_t i = 0; i < num; ++i) {
+                state = state * 1664525u + 1013904223u;
+                switch (pattern) {
+                    case 0: records[i].key = (state >> 8) % 50u; break;
+                    case 1: records[i].key = i; break;
+                    case 2: records[i].key = num - i; break;
+                    default: records[i].key = i % 300u; break;
+                }
+                records[i].payload[0] = i;
+            }
+            stableSort(records, num, buffer, byKey);
+            for (size_t i = 1; i < num; ++i) {
+                EXPECT_LE(records[i - 1].key, records[i].key);
+                if (records[i - 1].key == records[i].key) {
+                    EXPECT_LT(records[i - 1].payload[0], records[i].payload[0]);
+                }
+            }
+        }
+        delete[] records;
+        delete[] buffer;
+    }
+}
+
+TEST_F(SortTest, partialSortTest) {
+    const size_t Num = 10000;
+    int32_t *data = new int32_t[Num];
+    for (size_t i = 0; i < Num; ++i) {
+        data[i] = static_cast<int32_t>((i * 7919u) % Num);
+    }
+    partialSort(data, Num, 100);
+    for (size_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(static_cast<int32_t>(i), data[i]);
+    }
+
+    // Top 10 by descending order, k bigger than num
+    partialSort(data, Num, 10, [](int32_t lhs, int32_t rhs) { return lhs > rhs; });
+    EXPECT_EQ(static_cast<int32_t>(Num - 1), data[0]);
+    EXPECT_EQ(static_cast<int32_t>(Num - 10), data[9]);
+    partialSort(data, 5, 10);
+    EXPECT_TRUE(isSorted(data, 5));
+    delete[] data;
+}
+
+TEST_F(SortTest, nthElementTest) {
+    const size_t Num = 1001;
+    int32_t data[Num];
+    for (size_t n : { 0u, 1u, 500u, 999u, 1000u }) {
+        for (size_t i = 0; i < Num; ++i) {
+            data[i] = static_cast<int32_t>((i * 7919u) % 100u);
+        }
+        nthElement(data, Num, n);
+        int32_t sorted[Num];
+        ::memcpy(sorted, data, sizeof(data));
+        sort(sorted, Num);
+        EXPECT_EQ(sorted[n], data[n]);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_LE(data[i], data[n]);
+        }
+        for (size_t i = n + 1; i < Num; ++i) {
+            EXPECT_GE(data[i], data[n]);
+        }
+    }
+}
+
+TEST_F(SortTest, parallelSortTest) {
+    ThreadPool pool(3);
+    for (size_t num : { 0u, 1u, 1000u, 100000u, 100003u }) {
+        uint32_t *data = new uint32_t[num + 1];
+        uint32_t *buffer = new uint32_t[num + 1];
+        uint32_t state = 5u;
+        for (size_t i = 0; i < num; ++i) {
+            state = state * 1664525u + 1013904223u;
+            data[i] = state >> 3;
+        }
+        parallelSort(data, num, buffer, TLess<uint32_t>(), &pool);
+        EXPECT_TRUE(isSorted(data, num));
+        delete[] data;
+        delete[] buffer;
+    }
+}
+
+TEST_F(SortTest, parallelStableSortTest) {
+    // The result must be the same as the sequential stable sort for any number of threads
+    const size_t Num = 100000;
+    Record *input = new Record[Num];
+    Record *expected = new Record[Num];
+    Record *data = new Record[Num];
+    Record *buffer = new Record[Num];
+    for (size_t i = 0; i < Num; ++i) {
+        input[i].key = (i * 7919u) % 1000u;
+        input[i].payload[0] = i;
+    }
+    auto byKey = [](const Record &lhs, const Record &rhs) { return lhs.key < rhs.key; };
+    ::memcpy(expected, input, Num * sizeof(Record));
+    stableSort(expected, Num, buffer, byKey);
+
+    for (size_t numThreads : { 0u, 1u, 2u, 4u }) {
+        ThreadPool pool(numThreads);
+        ::memcpy(data, input, Num * sizeof(Record));
+        parallelStableSort(data, Num, buffer, byKey, &pool);
+        for (size_t i = 0; i < Num; ++i) {
+            EXPECT_EQ(expected[i].key, data[i].key);
+            EXPECT_EQ(expected[i].payload[0], data[i].payload[0]);
+        }
+    }
+    delete[] input;
+    delete[] expected;
+    delete[] data;
+    delete[] buffer;
+}
+
+TEST_F(SortTest, lowerBoundTest) {
+    for (size_t num : { 0u, 1u, 2u, 3u, 10u, 1000u, 1001u }) {
+        int32_t *data = new int32_t[num + 1];
+        for (size_t i = 0; i < num; ++i) {
+            data[i] = static_cast<int32_t>(i / 2) * 3;
+        }
+        for (int32_t key = -2; key <= static_cast<int32_t>(num) * 2; ++key) {
+            size_t expected = 0;
+            while (expected < num && data[expected] < key) {
+                ++expected;
+            }
+            EXPECT_EQ(expected, lowerBound(data, num, key));
+        }
+        delete[] data;
+    }
+
+    int32_t descending[] = { 9, 7, 7, 3 };
+    EXPECT_EQ(1u, lowerBound(descending, 4, 7, [](int32_t lhs, int32_t rhs) { return lhs > rhs; }));
+}
+
+TEST_F(SortTest, sortNetworkTest) {
+    const CPUInfo::SimdLevel levels[] = { CPUInfo::SimdLevel::AVX2, CPUInfo::SimdLevel::SSE42, CPUInfo::SimdLevel::Scalar };
+    uint32_t state = 12345u;
+    for (CPUInfo::SimdLevel level : levels) {
+        CPUInfo::setSimdLevelLimit(level);
+        for (size_t num = 0; num <= Details::SortNetworkMaxSize; ++num) {
+            int32_t ints[Details::SortNetworkMaxSize], expectedInts[Details::SortNetworkMaxSize];
+            float floats[Details::SortNetworkMaxSize], expectedFloats[Details::SortNetworkMaxSize];
+            for (size_t i = 0; i < num; ++i) {
+                state = state * 1664525u + 1013904223u;
+                ints[i] = static_cast<int32_t>(state) >> (state % 24);
+                floats[i] = static_cast<float>(ints[i] % 1000) * 0.5f;
+            }
+            if (num > 2) {
+                ints[0] = std::numeric_limits<int32_t>::max();
+                ints[1] = std::numeric_limits<int32_t>::min();
+                floats[0] = -std::numeric_limits<float>::infinity();
+                floats[1] = std::numeric_limits<float>::infinity();
+            }
+            std::copy(ints, ints + num, expectedInts);
+            std::copy(floats, floats + num, expectedFloats);
+            std::sort(expectedInts, expectedInts + num);
+            std::sort(expectedFloats, expectedFloats + num);
+
+            sortNetwork(ints, num);
+            sortNetwork(floats, num);
+            for (size_t i = 0; i < num; ++i) {
+                EXPECT_EQ(expectedInts[i], ints[i]);
+                EXPECT_EQ(expectedFloats[i], floats[i]);
+            }
+        }
+    }
+    CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::AVX2);
+
+    // The templated sort uses the network for small arrays
+    float values[] = { 3.0f, -0.0f, -1.5f, 0.0f, 2.0f, -7.0f };
+    sort(values, 6);
+    EXPECT_TRUE(isSorted(values, 6, TLess<float>()));
+    EXPECT_TRUE(std::signbit(values[2]));
+    EXPECT_FALSE(std::signbit(values[3]));
+
+    // NaNs must not get lost
+    float withNaN[] = { 1.0f, std::numeric_limits<float>::quiet_NaN(), -2.0f, 0.5f };
+    sortNetwork(withNaN, 4);
+    EXPECT_EQ(1, std::count_if(withNaN, withNaN + 4, [](float value) { return std::isnan(value); }));
+    EXPECT_EQ(1, std::count(withNaN, withNaN + 4, -2.0f));
+}
@@ -0,0 +1,126 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/TAtomicBitSet.h>
+
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+using namespace cppcore;
+
+class TAtomicBitSetTest : public testing::Test {
+    // empty
+};
+
+TEST_F(TAtomicBitSetTest, CreateTest) {
+    TAtomicBitSet<> bitset1;
+    EXPECT_EQ(0u, bitset1.size());
+
+    TAtomicBitSet<> bitset2(100);
+    EXPECT_EQ(100u, bitset2.size());
+    EXPECT_EQ(0u, bitset2.count());
+}
+
+TEST_F(TAtomicBitSetTest, SetClearTest) {
+    TAtomicBitSet<> bitset(130);
+    EXPECT_FALSE(bitset.test(65));
+    EXPECT_TRUE(bitset.trySet(65));
+    EXPECT_TRUE(bitset.test(65));
+    EXPECT_FALSE(bitset.trySet(65));
+    EXPECT_EQ(1u, bitset.count());
+
+    EXPECT_TRUE(bitset.clear(65));
+    EXPECT_FALSE(bitset.test(65));
+    EXPECT_FALSE(bitset.clear(65));
+    EXPECT_EQ(0u, bitset.count());
+}
+
+TEST_F(TAtomicBitSetTest, FindAndSetFirstZeroTest) {
+    static constexpr size_t NumBits = 200;
+    TAtomicBitSet<> bitset(NumBits);
+    size_t pos = 0;
+    for (size_t i = 0; i < NumBits; ++i) {
+        EXPECT_TRUE(bitset.findAndSetFirstZero(pos));
+        EXPECT_EQ(i, pos);
+    }
+    EXPECT_FALSE(bitset.findAndSetFirstZero(pos));
+    EXPECT_EQ(NumBits, bitset.count());
+
+    bitset.clear(130);
+    EXPECT_TRUE(bitset.findAndSetFirstZero(pos));
+    EXPECT_EQ(130u, pos);
+
+    bitset.clearAll();
+    EXPECT_EQ(0u, bitset.count());
+    EXPECT_TRUE(bitset.findAndSetFirstZero(pos));
+    EXPECT_EQ(0u, pos);
+}
+
+TEST_F(TAtomicBitSetTest, MostlyFullTest) {
+    static constexpr size_t NumBits = 1024 * 1024;
+    TAtomicBitSet<> bitset(NumBits);
+    for (size_t i = 0; i < NumBits; ++i) {
+        bitset.trySet(i);
+    }
+    bitset.clear(NumBits - 3);
+
+    size_t pos = 0;
+    EXPECT_TRUE(bitset.findAndSetFirstZero(pos));
+    EXPECT_EQ(NumBits - 3, pos);
+    EXPECT_FALSE(bitset.findAndSetFirstZero(pos));
+}
+
+TEST_F(TAtomicBitSetTest, ConcurrentClaimTest) {
+    static constexpr size_t NumBits = 4096;
+    static constexpr size_t NumThreads = 4;
+    TAtomicBitSet<> bitset(NumBits);
+    std::vector<std::vector<size_t>> claimed(NumThreads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < NumThreads; ++t) {
+        threads.emplace_back([&bitset, &claimed, t]() {
+            size_t pos = 0;
+            while (bitset.findAndSetFirstZero(pos)) {
+                claimed[t].push_back(pos);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> owners(NumBits, 0);
+    size_t total = 0;
+    for (const auto &slots : claimed) {
+        for (size_t slot : slots) {
+            ++owners[slot];
+            ++total;
+        }
+    }
+    EXPECT_EQ(NumBits, total);
+    for (int owner : owners) {
+        EXPECT_EQ(1, owner);
+    }
+}
@@ -0,0 +1,95 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <gtest/gtest.h>
+
+#include <cppcore/Common/TMdSpan.h>
+
+using namespace ::cppcore;
+
+class TMdSpanTest : public ::testing::Test {};
+
+TEST_F(TMdSpanTest, extentsTest) {
+    static_assert(TMdSpan<float, 4, 3>::Rank == 2, "Rank of a 2D span");
+    static_assert(TMdSpan<float, 4, 3, 2>::size() == 24, "Size of a 3D span");
+    static_assert(TMdSpan<float, 4, 3, 2>::extent(1) == 3, "Extent of a 3D span");
+
+    float data[12] = {};
+    TMdSpan<float, 4, 3> span(data);
+    EXPECT_EQ(data, span.data());
+    EXPECT_EQ(3u, span.stride(0));
+    EXPECT_EQ(1u, span.stride(1));
+    EXPECT_TRUE(span.isContiguous());
+}
+
+TEST_F(TMdSpanTest, accessTest) {
+    int data[24];
+    for (int i = 0; i < 24; ++i) {
+        data[i] = i;
+    }
+
+    TMdSpan<int, 2, 3, 4> volume(data);
+    EXPECT_EQ(0, volume(0, 0, 0));
+    EXPECT_EQ(23, volume(1, 2, 3));
+    EXPECT_EQ(12 + 8 + 1, volume(1, 2, 1));
+
+    // Slices along the first dimension
+    TMdSpan<int, 3, 4> plane = volume[1];
+    EXPECT_EQ(12 + 4 + 2, plane(1, 2));
+    EXPECT_EQ(12 + 8 + 3, plane[2][3]);
+    volume[1][2][3] = 100;
+    EXPECT_EQ(100, data[23]);
+
+    const int *constData = data;
+    TMdSpan<const int, 4, 6> readOnly(constData);
+    EXPECT_EQ(100, readOnly(3, 5));
+
+#ifndef NDEBUG
+    // The indices are only checked in debug builds
+    ASSERT_DEATH(volume(2, 0, 0), "");
+#endif
+}
+
+TEST_F(TMdSpanTest, tileTest) {
+    // A 2x3 tile at (1, 2) of a 6x5 image
+    const size_t width = 5;
+    float image[6 * width] = {};
+    TMdSpan<float, 2, 3> tile(image + 1 * width + 2, {width, 1});
+    EXPECT_FALSE(tile.isContiguous());
+    for (size_t row = 0; row < tile.extent(0); ++row) {
+        for (size_t col = 0; col < tile.extent(1); ++col) {
+            tile(row, col) = 1.0f;
+        }
+    }
+
+    float sum = 0.0f;
+    for (float value : image) {
+        sum += value;
+    }
+    EXPECT_EQ(6.0f, sum);
+    EXPECT_EQ(1.0f, image[1 * width + 2]);
+    EXPECT_EQ(1.0f, image[2 * width + 4]);
+    EXPECT_EQ(0.0f, image[2 * width + 1]);
+    EXPECT_EQ(0.0f, image[3 * width + 2]);
+}
@@ -0,0 +1,216 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <gtest/gtest.h>
+
+#include <cppcore/Common/TRope.h>
+
+#include <string>
+
+using namespace cppcore;
+
+class TRopeTest : public ::testing::Test {
+protected:
+    static std::string toStd(const TRope<char> &rope) {
+        std::string result;
+        TRope<char>::ChunkIterator chunks = rope.chunks();
+        for (const TStringView<char> &chunk : chunks) {
+            EXPECT_FALSE(chunk.isEmpty());
+            EXPECT_LE(chunk.size(), TRope<char>::ChunkSize);
+            result.append(chunk.data(), chunk.size());
+        }
+        return result;
+    }
+
+    static std::string makeText(size_t size) {
+        std::string text(size, ' ');
+        for (size_t i = 0; i < size; ++i) {
+            text[i] = static_cast<char>('a' + (i * 7 + i / 26) % 26);
+        }
+        return text;
+    }
+};
+
+TEST_F(TRopeTest, constructTest) {
+    TRope<char> empty;
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(0u, empty.size());
+    EXPECT_EQ("", toStd(empty));
+
+    const std::string text = makeText(5000);
+    TRope<char> rope(text.c_str(), text.size());
+    EXPECT_EQ(text.size(), rope.size());
+    EXPECT_EQ(text, toStd(rope));
+    EXPECT_EQ('a', rope[0]);
+    EXPECT_EQ(text[4321], rope[4321]);
+    EXPECT_EQ(text[4999], rope[4999]);
+
+    const TStringBase<char> str = rope.toString();
+    EXPECT_EQ(text.size(), str.size());
+    EXPECT_EQ(0, memcmp(text.c_str(), str.c_str(), text.size()));
+
+    rope.clear();
+    EXPECT_TRUE(rope.isEmpty());
+}
+
+TEST_F(TRopeTest, insertEraseTest) {
+    TRope<char> rope("Hello World", 11);
+    rope.insert(5, ",", 1);
+    rope.insert(0, ">> ", 3);
+    rope.append("!", 1);
+    EXPECT_EQ(">> Hello, World!", toStd(rope));
+
+    // The position is clamped
+    rope.insert(1000, "?", 1);
+    EXPECT_EQ(">> Hello, World!?", toStd(rope));
+
+    rope.erase(0, 3);
+    rope.erase(5, 1);
+    rope.erase(11, 100);
+    EXPECT_EQ("Hello World", toStd(rope));
+    rope.erase(100, 1);
+    rope.erase(0, 0);
+    EXPECT_EQ("Hello World", toStd(rope));
+    rope.erase(0, rope.size());
+    EXPECT_TRUE(rope.isEmpty());
+}
+
+TEST_F(TRopeTest, randomEditTest) {
+    std::string expected = makeText(20000);
+    TRope<char> rope(expected.c_str(), expected.size());
+    const std::string source = makeText(3000);
+
+    uint32_t seed = 12345u;
+    for (int i = 0; i < 2000; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        const size_t pos = (seed >> 8) % (expected.size() + 1);
+        seed = seed * 1664525u + 1013904223u;
+        const size_t len = (seed >> 8) % ((i % 10) == 0 ? 2500 : 20);
+        if ((seed & 0x300) != 0 || expected.size() < 1000) {
+            rope.insert(pos, source.c_str(), len);
+            expected.insert(pos, source.c_str(), len);
+        } else {
+            rope.erase(pos, len);
+            expected.erase(pos, len);
+        }
+        ASSERT_EQ(expected.size(), rope.size());
+    }
+    EXPECT_EQ(expected, toStd(rope));
+    for (size_t i = 0; i < expected.size(); i += 997) {
+        EXPECT_EQ(expected[i], rope[i]);
+    }
+}
+
+TEST_F(TRopeTest, typingTest) {
+    // Char by char input must not create a chunk per char
+    TRope<char> rope;
+    std::string expected;
+    for (int i = 0; i < 10000; ++i) {
+        const char c = static_cast<char>('a' + i % 26);
+        rope.insert(i / 2, &c, 1);
+        expected.insert(expected.begin() + i / 2, c);
+    }
+    EXPECT_EQ(expected, toStd(rope));
+
+    size_t numChunks = 0;
+    TRope<char>::ChunkIterator chunks = rope.chunks();
+    TStringView<char> chunk;
+    while (chunks.next(chunk)) {
+        ++numChunks;
+    }
+    EXPECT_LT(numChunks, 100u);
+}
+
+TEST_F(TRopeTest, substringTest) {
+    const std::string text = makeText(10000);
+    TRope<char> rope(text.c_str(), text.size());
+
+    TRope<char> sub = rope.substring(1500, 4000);
+    EXPECT_EQ(text.substr(1500, 4000), toStd(sub));
+    EXPECT_EQ(text.substr(9000), toStd(rope.substring(9000, 5000)));
+    EXPECT_TRUE(rope.substring(10000, 5).isEmpty());
+    EXPECT_TRUE(rope.substring(5, 0).isEmpty());
+
+    // The original is not changed
+    EXPECT_EQ(text, toStd(rope));
+
+    // Insert a rope into itself, nodes are shared
+    rope.insert(10, sub);
+    std::string expected = text;
+    expected.insert(10, text.substr(1500, 4000));
+    EXPECT_EQ(expected, toStd(rope));
+
+    // A rope with other pools is copied
+    TRope<char> other("<other>", 7);
+    rope.insert(0, other);
+    other.clear();
+    expected.insert(0, "<other>");
+    EXPECT_EQ(expected, toStd(rope));
+
+    // An empty rope adopts the pools
+    TRope<char> target;
+    target.insert(0, sub);
+    EXPECT_EQ(toStd(sub), toStd(target));
+}
+
+TEST_F(TRopeTest, snapshotTest) {
+    const std::string text = makeText(50000);
+    TRope<char> rope(text.c_str(), text.size());
+    TRope<char> snapshot = rope;
+    EXPECT_EQ(text, toStd(snapshot));
+
+    rope.insert(25000, "inserted", 8);
+    rope.erase(0, 100);
+    TRope<char> second(rope);
+    rope.append("end", 3);
+
+    EXPECT_EQ(text, toStd(snapshot));
+    std::string expected = text;
+    expected.insert(25000, "inserted");
+    expected.erase(0, 100);
+    EXPECT_EQ(expected, toStd(second));
+    EXPECT_EQ(expected + "end", toStd(rope));
+
+    // Snapshots keep the pools alive
+    TRope<char> moved;
+    {
+        TRope<char> temp(text.c_str(), 100);
+        snapshot = temp;
+        moved = std::move(temp);
+        EXPECT_TRUE(temp.isEmpty());
+    }
+    EXPECT_EQ(text.substr(0, 100), toStd(snapshot));
+    EXPECT_EQ(text.substr(0, 100), toStd(moved));
+    snapshot = snapshot.substring(10, 10);
+    EXPECT_EQ(text.substr(10, 10), toStd(snapshot));
+}
+
+TEST_F(TRopeTest, wideCharTest) {
+    const char16_t text[] = u"Grüße, 世界";
+    TRope<char16_t> rope(text, 9);
+    rope.insert(7, u"die ", 4);
+    EXPECT_EQ(13u, rope.size());
+    EXPECT_EQ(u'd', rope[7]);
+    EXPECT_EQ(u'界', rope[12]);
+}
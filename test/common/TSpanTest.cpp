@@ -39,7 +39,18 @@ TEST_F(TSpanTest, accessDataTest) {
     constexpr int arr[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
     TSpan<int> mySpan(arr, 10);
     ASSERT_EQ(mySpan.size(), 10);
-    ASSERT_EQ(mySpan[10], std::numeric_limits<int>::max());
+    ASSERT_EQ(mySpan[9], 10);
+    ASSERT_EQ(&mySpan[9], &arr[9]);
+
+    TSpan<int> part = mySpan.subspan(2, 3);
+    ASSERT_EQ(part.size(), 3);
+    ASSERT_EQ(part[0], 3);
+    ASSERT_TRUE(mySpan.subspan(10, 0).empty());
+
+#ifndef NDEBUG
+    // The index is only checked in debug builds
+    ASSERT_DEATH(mySpan[10], "");
+#endif
 }
 
 TEST_F(TSpanTest, iteratorTest) {
@@ -57,3 +68,60 @@ TEST_F(TSpanTest, iteratorTest) {
         index++;
     }
 }
+
+TEST_F(TSpanTest, mutableSpanTest) {
+    int arr[6] = {1, 2, 3, 4, 5, 6};
+    TMutableSpan<int> mySpan(arr, 6);
+    ASSERT_EQ(mySpan.size(), 6);
+    mySpan[0] = 10;
+    for (int &value : mySpan.subspan(4, 2)) {
+        value *= 2;
+    }
+    ASSERT_EQ(arr[0], 10);
+    ASSERT_EQ(arr[3], 4);
+    ASSERT_EQ(arr[4], 10);
+    ASSERT_EQ(arr[5], 12);
+
+    const TSpan<int> readOnly = mySpan;
+    ASSERT_EQ(readOnly.data(), static_cast<const int*>(arr));
+    ASSERT_EQ(readOnly.size(), 6);
+}
+
+TEST_F(TSpanTest, stridedSpanTest) {
+    struct Particle {
+        float x, y, z;
+        uint32_t flags;
+    };
+    Particle particles[4] = {};
+    for (uint32_t i = 0; i < 4; ++i) {
+        particles[i].y = static_cast<float>(i);
+        particles[i].flags = i;
+    }
+
+    TStridedSpan<float> heights = makeColumnSpan(particles, 4, &Particle::y);
+    ASSERT_EQ(heights.size(), 4);
+    ASSERT_EQ(heights.stride(), sizeof(Particle));
+    ASSERT_FALSE(heights.isContiguous());
+    for (float &y : heights) {
+        y += 1.0f;
+    }
+    heights[3] = 10.0f;
+    ASSERT_EQ(particles[0].y, 1.0f);
+    ASSERT_EQ(particles[2].y, 3.0f);
+    ASSERT_EQ(particles[3].y, 10.0f);
+    ASSERT_EQ(particles[3].flags, 3u);
+
+    const Particle *constParticles = particles;
+    TStridedSpan<const uint32_t> flags = makeColumnSpan(constParticles, 4, &Particle::flags);
+    uint32_t sum = 0;
+    for (size_t i = 0; i < flags.size(); ++i) {
+        sum += flags[i];
+    }
+    ASSERT_EQ(sum, 6u);
+
+    int arr[3] = {1, 2, 3};
+    TStridedSpan<int> contiguous(TMutableSpan<int>(arr, 3));
+    ASSERT_TRUE(contiguous.isContiguous());
+    ASSERT_EQ(contiguous[2], 3);
+    ASSERT_TRUE(TStridedSpan<int>().empty());
+}
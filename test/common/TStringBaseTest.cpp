@@ -26,6 +26,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <cppcore/Common/TStringBase.h>
 
+#include <thread>
+
 using namespace cppcore;
 
 class TStringBaseTest : public ::testing::Test {};
@@ -44,7 +46,7 @@ TEST_F(TStringBaseTest, createTest) {
 TEST_F(TStringBaseTest, setResetTest) {
     TStringBase<char> string_1;
     EXPECT_EQ(string_1.size(), 0);
-    EXPECT_EQ(string_1.capacity(), 512);
+    EXPECT_EQ(string_1.capacity(), TStringBase<char>::InlineCapacity);
     string_1.set("test", 4);
     EXPECT_EQ(string_1.size(), 4);
     EXPECT_EQ(0, strncmp(string_1.c_str(), "test", 4));
@@ -52,9 +54,28 @@ TEST_F(TStringBaseTest, setResetTest) {
     EXPECT_EQ(string_1.size(), 0);
 }
 
+TEST_F(TStringBaseTest, selfSetTest) {
+    TStringBase<char> shortString("test string", 11);
+    shortString.set(shortString.c_str(), 4);
+    EXPECT_EQ(4u, shortString.size());
+    EXPECT_EQ(0, strcmp(shortString.c_str(), "test"));
+    shortString.set(shortString.c_str() + 2, 2);
+    EXPECT_EQ(0, strcmp(shortString.c_str(), "st"));
+
+    const char *longText = "this is a string which does not fit into the inline buffer";
+    TStringBase<char> longString(longText, strlen(longText));
+    longString.set(longString.c_str() + 5, 2);
+    EXPECT_EQ(0, strcmp(longString.c_str(), "is"));
+    EXPECT_EQ(hash64("is", 2), longString.hash());
+
+    longString.set(nullptr, 0);
+    EXPECT_TRUE(longString.isEmpty());
+    EXPECT_EQ(0, strcmp(longString.c_str(), ""));
+}
+
 TEST_F(TStringBaseTest, setClearTest) {
     TStringBase<char> string_1("test", 4);
-    EXPECT_EQ(string_1.capacity(), 512);
+    EXPECT_EQ(string_1.capacity(), TStringBase<char>::InlineCapacity);
     EXPECT_EQ(string_1.size(), 4);
     EXPECT_FALSE(string_1.isEmpty());
 
@@ -62,3 +83,147 @@ TEST_F(TStringBaseTest, setClearTest) {
     EXPECT_EQ(string_1.size(), 0);
     EXPECT_TRUE(string_1.isEmpty());
 }
+
+TEST_F(TStringBaseTest, layoutTest) {
+    EXPECT_EQ(32u, sizeof(TStringBase<char>));
+    EXPECT_EQ(23u, TStringBase<char>::InlineCapacity);
+}
+
+TEST_F(TStringBaseTest, heapGrowthTest) {
+    const char *longText = "this is a string which does not fit into the inline buffer";
+    const size_t len = strlen(longText);
+    TStringBase<char> string_1(longText, len);
+    EXPECT_EQ(len, string_1.size());
+    EXPECT_GE(string_1.capacity(), len);
+    EXPECT_EQ(0, strcmp(string_1.c_str(), longText));
+    EXPECT_EQ('r', string_1[len - 1]);
+    EXPECT_EQ(0, string_1[len]);
+
+    // A short string will reuse the heap buffer
+    const size_t capacity = string_1.capacity();
+    string_1.set("short", 5);
+    EXPECT_EQ(capacity, string_1.capacity());
+    EXPECT_EQ(0, strcmp(string_1.c_str(), "short"));
+
+    // Growing is geometric
+    char buffer[256] = {};
+    memset(buffer, 'x', sizeof(buffer) - 1);
+    string_1.set(buffer, capacity + 1);
+    EXPECT_EQ(2 * capacity, string_1.capacity());
+
+    string_1.clear();
+    EXPECT_EQ(TStringBase<char>::InlineCapacity, string_1.capacity());
+    EXPECT_EQ(0, strcmp(string_1.c_str(), ""));
+}
+
+TEST_F(TStringBaseTest, copyMoveTest) {
+    const char *longText = "this is a string which does not fit into the inline buffer";
+    TStringBase<char> longString(longText, strlen(longText));
+    TStringBase<char> shortString("test", 4);
+
+    TStringBase<char> copy(longString);
+    EXPECT_EQ(longString, copy);
+    EXPECT_NE(longString.c_str(), copy.c_str());
+    copy = shortString;
+    EXPECT_EQ(shortString, copy);
+
+    const char *heapPtr = longString.c_str();
+    TStringBase<char> moved(std::move(longString));
+    EXPECT_EQ(heapPtr, moved.c_str());
+    EXPECT_TRUE(longString.isEmpty());
+    EXPECT_EQ(0, strcmp(longString.c_str(), ""));
+
+    moved = std::move(shortString);
+    EXPECT_EQ(0, strcmp(moved.c_str(), "test"));
+    EXPECT_TRUE(shortString.isEmpty());
+
+    longString = std::move(moved);
+    EXPECT_EQ(4u, longString.size());
+    EXPECT_EQ(0, strcmp(longString.c_str(), "test"));
+}
+
+TEST_F(TStringBaseTest, appendTest) {
+    TStringBase<char> string_1("Info: ", 6);
+    string_1 += TStringBase<char>("message", 7);
+    string_1 += '!';
+    EXPECT_EQ(14u, string_1.size());
+    EXPECT_EQ(0, strcmp(string_1.c_str(), "Info: message!"));
+
+    // Appending char by char must grow geometrically
+    TStringBase<char> string_2;
+    size_t numGrows = 0;
+    size_t capacity = string_2.capacity();
+    for (size_t i = 0; i < 10000; ++i) {
+        string_2 += 'x';
+        if (string_2.capacity() != capacity) {
+            capacity = string_2.capacity();
+            ++numGrows;
+        }
+    }
+    EXPECT_EQ(10000u, string_2.size());
+    EXPECT_LE(numGrows, 10u);
+    EXPECT_EQ('x', string_2[9999]);
+
+    // Appending the string to itself
+    TStringBase<char> string_3("abc", 3);
+    for (size_t i = 0; i < 5; ++i) {
+        string_3 += string_3;
+    }
+    EXPECT_EQ(96u, string_3.size());
+    EXPECT_EQ(0, strncmp(string_3.c_str() + 93, "abc", 3));
+}
+
+TEST_F(TStringBaseTest, reserveTest) {
+    TStringBase<char> string_1("test", 4);
+    string_1.reserve(10);
+    EXPECT_EQ(TStringBase<char>::InlineCapacity, string_1.capacity());
+
+    string_1.reserve(100);
+    EXPECT_EQ(100u, string_1.capacity());
+    EXPECT_EQ(0, strcmp(string_1.c_str(), "test"));
+
+    const char *ptr = string_1.c_str();
+    for (size_t i = 0; i < 96; ++i) {
+        string_1 += 'y';
+    }
+    EXPECT_EQ(ptr, string_1.c_str());
+    EXPECT_EQ(100u, string_1.size());
+}
+
+TEST_F(TStringBaseTest, hashTest) {
+    const char *longText = "this is a string which does not fit into the inline buffer";
+    const size_t len = strlen(longText);
+    TStringBase<char> shortString("test", 4);
+    TStringBase<char> longString(longText, len);
+    EXPECT_EQ(hash64("test", 4), shortString.hash());
+    EXPECT_EQ(hash64(longText, len), longString.hash());
+    EXPECT_EQ(longString.hash(), longString.hash());
+
+    // The cached hash must follow modifications
+    longString += '!';
+    EXPECT_NE(hash64(longText, len), longString.hash());
+    longString.set(longText, len);
+    EXPECT_EQ(hash64(longText, len), longString.hash());
+    longString.set("test", 4);
+    EXPECT_EQ(shortString.hash(), longString.hash());
+    EXPECT_EQ(shortString, longString);
+
+    TStringBase<char> copy(longString);
+    EXPECT_EQ(longString.hash(), copy.hash());
+    longString.reset();
+    EXPECT_EQ(hash64("", 0), longString.hash());
+
+    // The cache may be filled by several readers of a shared const string
+    const TStringBase<char> shared(longText, len);
+    HashId hashes[2] = {};
+    std::thread reader([&shared, &hashes]() { hashes[0] = shared.hash(); });
+    hashes[1] = shared.hash();
+    reader.join();
+    EXPECT_EQ(hash64(longText, len), hashes[0]);
+    EXPECT_EQ(hashes[0], hashes[1]);
+
+    // Compile time hashes can be compared with the hash of a string
+    EXPECT_EQ(constHash("x"), TStringBase<char>("x", 1).hash());
+    EXPECT_EQ(constHash("test"), shortString.hash());
+    EXPECT_EQ(constHash(longText), TStringBase<char>(longText, len).hash());
+}
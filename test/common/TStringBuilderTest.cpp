@@ -0,0 +1,85 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <gtest/gtest.h>
+
+#include <cppcore/Common/TStringBuilder.h>
+
+#include <limits>
+
+using namespace cppcore;
+
+class TStringBuilderTest : public ::testing::Test {};
+
+TEST_F(TStringBuilderTest, appendStringsTest) {
+    TStringBuilder<char> builder;
+    EXPECT_TRUE(builder.isEmpty());
+
+    const char *text = "view text";
+    builder.append("Info: ").append(TStringBase<char>("msg", 3)).append(' ');
+    builder.append(TStringView<char>(text, 4)).append("abc", 2);
+    EXPECT_EQ(16u, builder.size());
+
+    TStringBase<char> result = builder.build();
+    EXPECT_EQ(0, strcmp(result.c_str(), "Info: msg viewab"));
+}
+
+TEST_F(TStringBuilderTest, appendIntegersTest) {
+    TStringBuilder<char> builder;
+    builder << 0 << ',' << -42 << ',' << 123456789u << ',' << std::numeric_limits<int64_t>::min()
+            << ',' << std::numeric_limits<uint64_t>::max();
+
+    TStringBase<char> result = builder.build();
+    EXPECT_EQ(0, strcmp(result.c_str(), "0,-42,123456789,-9223372036854775808,18446744073709551615"));
+}
+
+TEST_F(TStringBuilderTest, appendFloatsTest) {
+    TStringBuilder<char> builder;
+    builder << 1.5 << ' ' << 0.25f << ' ';
+    builder.append(3.14159265, 3);
+    builder << ' ';
+    builder.append(0.1 + 0.2, -1);
+
+    TStringBase<char> result = builder.build();
+    EXPECT_EQ(0, strcmp(result.c_str(), "1.5 0.25 3.14 0.30000000000000004"));
+}
+
+TEST_F(TStringBuilderTest, buildTest) {
+    TStringBuilder<char> builder(256);
+    for (int i = 0; i < 20; ++i) {
+        builder << "item_" << i << ';';
+    }
+
+    TStringBase<char> result = builder.build();
+    EXPECT_EQ(builder.size(), result.size());
+    EXPECT_EQ(0, memcmp(result.c_str(), builder.view().data(), result.size()));
+    EXPECT_NE(result.c_str(), builder.view().data());
+
+    builder.reset();
+    EXPECT_TRUE(builder.isEmpty());
+    builder << "short";
+    result = builder.build();
+    EXPECT_EQ(TStringBase<char>::InlineCapacity, result.capacity());
+    EXPECT_EQ(0, strcmp(result.c_str(), "short"));
+}
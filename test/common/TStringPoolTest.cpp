@@ -0,0 +1,102 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <gtest/gtest.h>
+
+#include <cppcore/Common/TStringPool.h>
+
+#include <stdio.h>
+
+using namespace cppcore;
+
+class TStringPoolTest : public ::testing::Test {};
+
+TEST_F(TStringPoolTest, internTest) {
+    TStringPool<char> pool;
+    EXPECT_TRUE(pool.isEmpty());
+    EXPECT_EQ(TStringPool<char>::InvalidId, pool.find("Renderer", 8));
+
+    const TStringPool<char>::Id renderer = pool.intern("Renderer", 8);
+    const TStringPool<char>::Id audio = pool.intern(TStringBase<char>("Audio", 5));
+    EXPECT_NE(renderer, audio);
+    EXPECT_EQ(2u, pool.size());
+
+    // Equal strings are stored once
+    char buffer[] = "Renderer";
+    EXPECT_EQ(renderer, pool.intern(buffer, 8));
+    EXPECT_EQ(renderer, pool.find(buffer, 8));
+    EXPECT_EQ(2u, pool.size());
+    EXPECT_EQ(0, strcmp(pool.c_str(renderer), "Renderer"));
+    EXPECT_NE(static_cast<const char*>(buffer), pool.c_str(renderer));
+    EXPECT_EQ(5u, pool.view(audio).size());
+
+    // Prefixes and the empty string are different strings
+    EXPECT_NE(renderer, pool.intern("Render", 6));
+    const TStringPool<char>::Id empty = pool.intern("", 0);
+    EXPECT_EQ(0, strcmp(pool.c_str(empty), ""));
+    EXPECT_EQ(4u, pool.size());
+
+    // Heap strings pass their cached hash, it must match the hash of the raw chars
+    const char *path = "assets/textures/terrain/stone_diffuse.png";
+    TStringBase<char> longString(path, strlen(path));
+    longString.hash();
+    const TStringPool<char>::Id pathId = pool.intern(longString);
+    EXPECT_EQ(pathId, pool.find(path, strlen(path)));
+    EXPECT_EQ(pathId, pool.intern(path, strlen(path)));
+
+    pool.clear();
+    EXPECT_TRUE(pool.isEmpty());
+    EXPECT_EQ(TStringPool<char>::InvalidId, pool.find("Renderer", 8));
+}
+
+TEST_F(TStringPoolTest, stablePointerTest) {
+    TStringPool<char> pool;
+    char name[64];
+    const TStringPool<char>::Id first = pool.intern("assets/first.png", 16);
+    const char *firstPtr = pool.c_str(first);
+
+    // Many strings force rehashing and new chunks
+    for (int i = 0; i < 5000; ++i) {
+        const int len = snprintf(name, sizeof(name), "assets/texture_%d.png", i);
+        const TStringPool<char>::Id id = pool.intern(name, static_cast<size_t>(len));
+        EXPECT_EQ(static_cast<TStringPool<char>::Id>(i + 1), id);
+    }
+    EXPECT_EQ(firstPtr, pool.c_str(first));
+    EXPECT_EQ(first, pool.intern("assets/first.png", 16));
+
+    for (int i = 0; i < 5000; ++i) {
+        const int len = snprintf(name, sizeof(name), "assets/texture_%d.png", i);
+        const TStringPool<char>::Id id = pool.find(name, static_cast<size_t>(len));
+        ASSERT_EQ(static_cast<TStringPool<char>::Id>(i + 1), id);
+        EXPECT_EQ(0, strcmp(pool.c_str(id), name));
+    }
+
+    // A string longer than a chunk
+    TArray<char> longName;
+    longName.resize(TStringPool<char>::ChunkSize * 2);
+    longName.set('a');
+    const TStringPool<char>::Id longId = pool.intern(longName.data(), longName.size());
+    EXPECT_EQ(longName.size(), pool.view(longId).size());
+    EXPECT_EQ(longId, pool.find(longName.data(), longName.size()));
+}
@@ -24,11 +24,27 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <cstdint>
 #include <cppcore/Common/TStringView.h>
+#include <cppcore/Common/CPUInfo.h>
 #include <cppcore/Container/TAlgorithm.h>
+#include <cppcore/Container/TArray.h>
 
 using namespace cppcore;
 
-class TStringViewTest : public ::testing::Test {};
+class TStringViewTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::AVX2);
+    }
+
+    template <class TCheck>
+    void forAllLevels(TCheck check) {
+        const CPUInfo::SimdLevel levels[] = { CPUInfo::SimdLevel::AVX2, CPUInfo::SimdLevel::SSE42, CPUInfo::SimdLevel::Scalar };
+        for (CPUInfo::SimdLevel level : levels) {
+            CPUInfo::setSimdLevelLimit(level);
+            check();
+        }
+    }
+};
 
 using StringView = TStringView<char>;
 
@@ -64,3 +80,140 @@ TEST_F(TStringViewTest, iterateTest) {
         EXPECT_EQ(tag[i++], *it);
     }
 }
+
+TEST_F(TStringViewTest, findTest) {
+    forAllLevels([]() {
+        StringView sv("the quick brown fox jumps over the lazy dog, the end");
+        EXPECT_EQ(4u, sv.find('q'));
+        EXPECT_EQ(StringView::NotFound, sv.find('Q'));
+        EXPECT_EQ(12u, sv.find('o', 11));
+        EXPECT_EQ(StringView::NotFound, sv.find('t', 100));
+        EXPECT_EQ(0u, sv.find("the"));
+        EXPECT_EQ(31u, sv.find("the", 1));
+        EXPECT_EQ(16u, sv.find("fox"));
+        EXPECT_EQ(StringView::NotFound, sv.find("cat"));
+        EXPECT_EQ(5u, sv.find("", 5));
+        EXPECT_EQ(sv.size() - 3, sv.find("end"));
+
+        EXPECT_EQ(45u, sv.rfind("the"));
+        EXPECT_EQ(sv.size() - 1, sv.rfind('d'));
+        EXPECT_EQ(0u, sv.rfind("the quick"));
+        EXPECT_EQ(StringView::NotFound, sv.rfind("cat"));
+        EXPECT_EQ(StringView::NotFound, sv.rfind('Q'));
+
+        EXPECT_EQ(3u, sv.findFirstOf(" ,"));
+        EXPECT_EQ(43u, sv.findFirstOf(",!?", 10));
+        EXPECT_EQ(StringView::NotFound, sv.findFirstOf("XYZ"));
+        EXPECT_EQ(1u, sv.findFirstOf("0123456789abcdefgh"));
+    });
+}
+
+TEST_F(TStringViewTest, findCrossCheckTest) {
+    // Compare against a naive search, with matches at all offsets of the vector blocks
+    TArray<char> buffer;
+    buffer.resize(300);
+    uint32_t state = 1;
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        state = state * 1103515245u + 12345u;
+        buffer[i] = static_cast<char>('a' + (state >> 16) % 4);
+    }
+    const StringView text(buffer.data(), buffer.size());
+    const StringView needles[] = { "ab", "abc", "dddd", "abcdabcd", "cab" };
+
+    forAllLevels([&]() {
+        for (size_t len = 0; len <= text.size(); len += 7) {
+            const StringView part = text.subView(0, len);
+            for (const StringView &needle : needles) {
+                size_t expectedFirst = StringView::NotFound, expectedLast = StringView::NotFound;
+                for (size_t i = 0; i + needle.size() <= len; ++i) {
+                    if (part.subView(i, needle.size()) == needle) {
+                        expectedFirst = expectedFirst == StringView::NotFound ? i : expectedFirst;
+                        expectedLast = i;
+                    }
+                }
+                EXPECT_EQ(expectedFirst, part.find(needle));
+                EXPECT_EQ(expectedLast, part.rfind(needle));
+            }
+
+            size_t expectedD = StringView::NotFound, expectedLastD = StringView::NotFound;
+            for (size_t i = 0; i < len; ++i) {
+                if (part[i] == 'd') {
+                    expectedD = expectedD == StringView::NotFound ? i : expectedD;
+                    expectedLastD = i;
+                }
+            }
+            EXPECT_EQ(expectedD, part.find('d'));
+            EXPECT_EQ(expectedLastD, part.rfind('d'));
+            EXPECT_EQ(expectedD, part.findFirstOf("dxyz"));
+        }
+    });
+}
+
+TEST_F(TStringViewTest, findFirstOfTest) {
+    // Chars with more than 8 distinct high nibbles use another path than ASCII sets
+    char text[256];
+    for (size_t i = 0; i < sizeof(text); ++i) {
+        text[i] = static_cast<char>(255 - i);
+    }
+    const StringView view(text, sizeof(text));
+    const char wideSet[] = { 0x01, 0x12, 0x23, 0x34, 0x45, 0x56, 0x67, 0x78, static_cast<char>(0x89) };
+    const char asciiSet[] = "_Zz09";
+    forAllLevels([&]() {
+        EXPECT_EQ(255u - 0x89u, view.findFirstOf(StringView(wideSet, sizeof(wideSet))));
+        EXPECT_EQ(255u - 0x7au, view.findFirstOf(asciiSet));
+        EXPECT_EQ(255u - 0x5fu, view.findFirstOf(asciiSet, 255u - 0x7au + 1));
+        EXPECT_EQ(255u - 0x5au, view.findFirstOf(asciiSet, 255u - 0x5fu + 1));
+        EXPECT_EQ(255u - 0x39u, view.findFirstOf(asciiSet, 255u - 0x5au + 1));
+        EXPECT_EQ(StringView::NotFound, view.subView(0, 10).findFirstOf(asciiSet));
+        EXPECT_EQ(StringView::NotFound, view.findFirstOf(""));
+    });
+}
+
+TEST_F(TStringViewTest, startsEndsWithTest) {
+    StringView sv("config.render.width");
+    EXPECT_TRUE(sv.startsWith("config."));
+    EXPECT_TRUE(sv.startsWith(""));
+    EXPECT_FALSE(sv.startsWith("render"));
+    EXPECT_TRUE(sv.endsWith(".width"));
+    EXPECT_FALSE(sv.endsWith("config.render.width.x"));
+    EXPECT_EQ(StringView("render"), sv.subView(7, 6));
+    EXPECT_EQ(StringView("width"), sv.subView(14));
+    EXPECT_TRUE(sv.subView(100).isEmpty());
+}
+
+TEST_F(TStringViewTest, splitTest) {
+    const char *text = "line1\n\nline3\n";
+    TArray<StringView> tokens;
+    for (const StringView &token : StringView(text).split('\n')) {
+        tokens.add(token);
+    }
+    ASSERT_EQ(4u, tokens.size());
+    EXPECT_EQ(StringView("line1"), tokens[0]);
+    EXPECT_TRUE(tokens[1].isEmpty());
+    EXPECT_EQ(StringView("line3"), tokens[2]);
+    EXPECT_TRUE(tokens[3].isEmpty());
+
+    // The tokens point into the original buffer
+    EXPECT_EQ(text, tokens[0].data());
+    EXPECT_EQ(text + 7, tokens[2].data());
+
+    size_t numTokens = 0;
+    for (const StringView &token : StringView("").split(',')) {
+        (void) token;
+        ++numTokens;
+    }
+    EXPECT_EQ(0u, numTokens);
+}
+
+TEST_F(TStringViewTest, tokenizeTest) {
+    TStringTokenizer<char> tokenizer = StringView("  key =\tvalue ;; next ").tokenize(" \t=;");
+    StringView token;
+    ASSERT_TRUE(tokenizer.next(token));
+    EXPECT_EQ(StringView("key"), token);
+    ASSERT_TRUE(tokenizer.next(token));
+    EXPECT_EQ(StringView("value"), token);
+    ASSERT_TRUE(tokenizer.next(token));
+    EXPECT_EQ(StringView("next"), token);
+    EXPECT_FALSE(tokenizer.next(token));
+    EXPECT_FALSE(tokenizer.next(token));
+}
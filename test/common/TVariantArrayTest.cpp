@@ -0,0 +1,100 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <gtest/gtest.h>
+
+#include <cppcore/Common/TVariantArray.h>
+
+using namespace cppcore;
+
+class TVariantArrayTest : public ::testing::Test {};
+
+TEST_F(TVariantArrayTest, addTest) {
+    TVariantArray<float> values;
+    EXPECT_TRUE(values.isEmpty());
+    EXPECT_EQ(Variant::Float, TVariantArray<float>::Type);
+
+    Variant value;
+    value.setFloat(1.5f);
+    EXPECT_TRUE(values.add(value));
+    values.add(2.5f);
+    value.setInt(1);
+    EXPECT_FALSE(values.add(value));
+    EXPECT_EQ(2u, values.size());
+    EXPECT_EQ(2.5f, values[1]);
+
+    const Variant boxed = values.get(0);
+    EXPECT_EQ(Variant::Float, boxed.getType());
+    EXPECT_EQ(1.5f, boxed.getFloat());
+
+    values.clear();
+    EXPECT_TRUE(values.isEmpty());
+}
+
+TEST_F(TVariantArrayTest, batchTest) {
+    Variant args[100];
+    for (size_t i = 0; i < 100; ++i) {
+        const float f = static_cast<float>(i);
+        args[i].setFloat3(f, f + 1.0f, f + 2.0f);
+    }
+
+    TVariantArray<Variant::Float3Value> positions;
+    EXPECT_EQ(3u, TVariantArray<Variant::Float3Value>::NumComponents);
+    EXPECT_TRUE(positions.add(args, 100));
+    EXPECT_TRUE(positions.add(args, 50));
+    ASSERT_EQ(150u, positions.size());
+    EXPECT_EQ(11.0f, positions[10][1]);
+    EXPECT_EQ(12.0f, positions[110][2]);
+
+    // A wrong type rejects the whole batch
+    args[20].setInt(1);
+    EXPECT_FALSE(positions.add(args, 100));
+    EXPECT_EQ(150u, positions.size());
+
+    TMutableSpan<float> components = positions.components();
+    ASSERT_EQ(450u, components.size());
+    for (float &component : components) {
+        component *= 2.0f;
+    }
+    EXPECT_EQ(22.0f, positions[10][1]);
+    EXPECT_EQ(4.0f, positions.values()[1][1]);
+
+    const Variant boxed = positions.get(10);
+    EXPECT_EQ(Variant::Float3, boxed.getType());
+    EXPECT_EQ(24.0f, boxed.getFloat3()[2]);
+}
+
+TEST_F(TVariantArrayTest, growTest) {
+    TVariantArray<int32_t> values;
+    for (int32_t i = 0; i < 100000; ++i) {
+        values.add(i);
+    }
+    ASSERT_EQ(100000u, values.size());
+
+    int64_t sum = 0;
+    for (int32_t value : values.values()) {
+        sum += value;
+    }
+    EXPECT_EQ(int64_t(99999) * 100000 / 2, sum);
+}
@@ -0,0 +1,91 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Common/ThreadPool.h>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace cppcore;
+
+class ThreadPoolTest : public testing::Test {};
+
+TEST_F(ThreadPoolTest, parallelForTest) {
+    ThreadPool pool(4);
+    EXPECT_EQ(4u, pool.getNumThreads());
+
+    std::vector<int> visited(10000, 0);
+    pool.parallelFor(0, visited.size(), 0, [&visited](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            ++visited[i];
+        }
+    });
+    for (int count : visited) {
+        EXPECT_EQ(1, count);
+    }
+
+    // Chunk size of one and an empty range
+    std::atomic<size_t> sum(0);
+    pool.parallelFor(5, 105, 1, [&sum](size_t first, size_t last) {
+        EXPECT_EQ(first + 1, last);
+        sum += first;
+    });
+    EXPECT_EQ(5450u, sum.load());
+    pool.parallelFor(3, 3, 0, [](size_t, size_t) {
+        FAIL();
+    });
+}
+
+TEST_F(ThreadPoolTest, nestedParallelForTest) {
+    ThreadPool pool(2);
+    std::atomic<size_t> count(0);
+    pool.parallelFor(0, 16, 1, [&pool, &count](size_t, size_t) {
+        pool.parallelFor(0, 100, 10, [&count](size_t first, size_t last) {
+            count += last - first;
+        });
+    });
+    EXPECT_EQ(1600u, count.load());
+}
+
+TEST_F(ThreadPoolTest, submitTest) {
+    std::atomic<int> count(0);
+    {
+        ThreadPool pool(3);
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&count]() {
+                ++count;
+            });
+        }
+    }
+    // The destructor will finish all tasks
+    EXPECT_EQ(100, count.load());
+
+    ThreadPool inlinePool(0);
+    inlinePool.submit([&count]() {
+        ++count;
+    });
+    EXPECT_EQ(101, count.load());
+}
@@ -0,0 +1,242 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <gtest/gtest.h>
+
+#include <cppcore/Common/CPUInfo.h>
+#include <cppcore/Common/Unicode.h>
+
+#include <random>
+#include <string.h>
+#include <vector>
+
+using namespace cppcore;
+
+class UnicodeTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::AVX2);
+    }
+
+    template <class TCheck>
+    void forAllLevels(TCheck check) {
+        const CPUInfo::SimdLevel levels[] = { CPUInfo::SimdLevel::AVX2, CPUInfo::SimdLevel::SSE42, CPUInfo::SimdLevel::Scalar };
+        for (CPUInfo::SimdLevel level : levels) {
+            CPUInfo::setSimdLevelLimit(level);
+            check();
+        }
+    }
+
+    static bool isValid(const std::vector<char> &bytes) {
+        return isValidUtf8(TStringView<char>(bytes.data(), bytes.size()));
+    }
+
+    static void appendUtf8(uint32_t codePoint, std::vector<char> &bytes) {
+        if (codePoint < 0x80) {
+            bytes.push_back(static_cast<char>(codePoint));
+        } else if (codePoint < 0x800) {
+            bytes.push_back(static_cast<char>(0xc0 | (codePoint >> 6)));
+            bytes.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+        } else if (codePoint < 0x10000) {
+            bytes.push_back(static_cast<char>(0xe0 | (codePoint >> 12)));
+            bytes.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+            bytes.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+        } else {
+            bytes.push_back(static_cast<char>(0xf0 | (codePoint >> 18)));
+            bytes.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f)));
+            bytes.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f)));
+            bytes.push_back(static_cast<char>(0x80 | (codePoint & 0x3f)));
+        }
+    }
+
+    // Mostly ASCII with runs of all sequence lengths
+    static std::vector<uint32_t> randomCodePoints(std::mt19937 &rng, size_t count) {
+        std::vector<uint32_t> codePoints;
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t kind = rng() % 8;
+            uint32_t codePoint = 0;
+            if (kind < 4) {
+                codePoint = rng() % 0x80;
+            } else if (kind == 4) {
+                codePoint = 0x80 + rng() % (0x800 - 0x80);
+            } else if (kind < 7) {
+                do {
+                    codePoint = 0x800 + rng() % (0x10000 - 0x800);
+                } while (codePoint >= 0xd800 && codePoint <= 0xdfff);
+            } else {
+                codePoint = 0x10000 + rng() % (0x110000 - 0x10000);
+            }
+            codePoints.push_back(codePoint);
+        }
+        return codePoints;
+    }
+};
+
+TEST_F(UnicodeTest, validateTest) {
+    const char *valid[] = {
+        "", "plain ascii", "\xc3\xa4", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\xed\x9f\xbf", "\xee\x80\x80",
+        "\xf4\x8f\xbf\xbf", "\xc2\x80", "\xe0\xa0\x80", "\xf0\x90\x80\x80"
+    };
+    const char *invalid[] = {
+        "\x80", "\xbf", "\xc3", "\xe2\x82", "\xf0\x9f\x98",     // stray continuation or truncated
+        "\xc0\x80", "\xc1\xbf", "\xe0\x9f\xbf", "\xf0\x8f\xbf\xbf", // overlong
+        "\xed\xa0\x80", "\xed\xbf\xbf",                         // surrogates
+        "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xff", "\xfe", // too large
+        "\xc3\xa4\xa4", "a\xc3" "a", "\xe2\x82\xac\x80"
+    };
+    forAllLevels([&]() {
+        for (const char *str : valid) {
+            // Pad to different positions within and across blocks
+            for (size_t pad = 0; pad < 70; ++pad) {
+                std::vector<char> bytes(pad, 'x');
+                bytes.insert(bytes.end(), str, str + strlen(str));
+                EXPECT_TRUE(isValid(bytes)) << pad << " " << str;
+                bytes.resize(bytes.size() + pad, 'y');
+                EXPECT_TRUE(isValid(bytes)) << pad << " " << str;
+            }
+        }
+        for (const char *str : invalid) {
+            for (size_t pad = 0; pad < 70; ++pad) {
+                std::vector<char> bytes(pad, 'x');
+                bytes.insert(bytes.end(), str, str + strlen(str));
+                EXPECT_FALSE(isValid(bytes)) << pad << " " << str;
+                bytes.resize(bytes.size() + pad, 'y');
+                EXPECT_FALSE(isValid(bytes)) << pad << " " << str;
+            }
+        }
+    });
+}
+
+TEST_F(UnicodeTest, validateRandomTest) {
+    std::mt19937 rng(5);
+    std::vector<char> bytes;
+    for (uint32_t codePoint : randomCodePoints(rng, 4000)) {
+        appendUtf8(codePoint, bytes);
+    }
+    forAllLevels([&]() {
+        EXPECT_TRUE(isValid(bytes));
+    });
+
+    // Single byte errors must be found by all levels in the same way
+    for (int i = 0; i < 2000; ++i) {
+        std::vector<char> broken(bytes.begin(), bytes.begin() + rng() % bytes.size());
+        broken[rng() % broken.size()] = static_cast<char>(rng());
+        CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::Scalar);
+        const bool expected = isValid(broken);
+        CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::SSE42);
+        EXPECT_EQ(expected, isValid(broken));
+        CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::AVX2);
+        EXPECT_EQ(expected, isValid(broken));
+    }
+}
+
+TEST_F(UnicodeTest, countCodePointsTest) {
+    std::mt19937 rng(9);
+    const std::vector<uint32_t> codePoints = randomCodePoints(rng, 1000);
+    std::vector<char> bytes;
+    for (uint32_t codePoint : codePoints) {
+        appendUtf8(codePoint, bytes);
+    }
+    forAllLevels([&]() {
+        EXPECT_EQ(0u, TStringView<char>("").countCodePoints());
+        EXPECT_EQ(4u, TStringView<char>("a\xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80").countCodePoints());
+        EXPECT_EQ(codePoints.size(), TStringView<char>(bytes.data(), bytes.size()).countCodePoints());
+    });
+
+    const char16_t utf16[] = { 'a', 0xe4, 0xd83d, 0xde00, 0 };
+    EXPECT_EQ(3u, TStringView<char16_t>(utf16).countCodePoints());
+    const char32_t utf32[] = { 'a', 0x1f600, 0 };
+    EXPECT_EQ(2u, TStringView<char32_t>(utf32).countCodePoints());
+}
+
+TEST_F(UnicodeTest, convertTest) {
+    const char *text = "a\xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80";
+    TStringBase<char16_t> utf16;
+    TStringBase<char32_t> utf32;
+    TStringBase<char> utf8;
+    forAllLevels([&]() {
+        ASSERT_TRUE(utf8ToUtf16(TStringView<char>(text), utf16));
+        ASSERT_EQ(5u, utf16.size());
+        EXPECT_EQ(u'a', utf16[0]);
+        EXPECT_EQ(0xe4, utf16[1]);
+        EXPECT_EQ(0x20ac, utf16[2]);
+        EXPECT_EQ(0xd83d, utf16[3]);
+        EXPECT_EQ(0xde00, utf16[4]);
+
+        ASSERT_TRUE(utf8ToUtf32(TStringView<char>(text), utf32));
+        ASSERT_EQ(4u, utf32.size());
+        EXPECT_EQ(0x1f600u, static_cast<uint32_t>(utf32[3]));
+
+        ASSERT_TRUE(utf16ToUtf8(TStringView<char16_t>(utf16.c_str(), utf16.size()), utf8));
+        EXPECT_EQ(0, strcmp(text, utf8.c_str()));
+        ASSERT_TRUE(utf32ToUtf8(TStringView<char32_t>(utf32.c_str(), utf32.size()), utf8));
+        EXPECT_EQ(0, strcmp(text, utf8.c_str()));
+
+        // Invalid input leaves an empty result
+        EXPECT_FALSE(utf8ToUtf16(TStringView<char>("ab\xc3"), utf16));
+        EXPECT_TRUE(utf16.isEmpty());
+        const char16_t unpaired[] = { 'a', 0xd83d, 'b', 0 };
+        EXPECT_FALSE(utf16ToUtf8(TStringView<char16_t>(unpaired), utf8));
+        EXPECT_TRUE(utf8.isEmpty());
+        const char16_t lowFirst[] = { 0xde00, 0xd83d, 0 };
+        EXPECT_FALSE(utf16ToUtf8(TStringView<char16_t>(lowFirst), utf8));
+        const char32_t tooLarge[] = { 'a', 0x110000, 0 };
+        EXPECT_FALSE(utf32ToUtf8(TStringView<char32_t>(tooLarge), utf8));
+        const char32_t surrogate[] = { 0xd800, 0 };
+        EXPECT_FALSE(utf32ToUtf8(TStringView<char32_t>(surrogate), utf8));
+    });
+}
+
+TEST_F(UnicodeTest, convertRoundTripTest) {
+    std::mt19937 rng(13);
+    // Long enough for several conversion chunks
+    const std::vector<uint32_t> codePoints = randomCodePoints(rng, 5000);
+    std::vector<char> bytes;
+    for (uint32_t codePoint : codePoints) {
+        appendUtf8(codePoint, bytes);
+    }
+    // A long ASCII run for the block paths
+    bytes.insert(bytes.end(), 3000, 'z');
+    const size_t numCodePoints = codePoints.size() + 3000;
+    const TStringView<char> view(bytes.data(), bytes.size());
+
+    forAllLevels([&]() {
+        TStringBase<char16_t> utf16;
+        ASSERT_TRUE(utf8ToUtf16(view, utf16));
+        EXPECT_EQ(numCodePoints, TStringView<char16_t>(utf16.c_str(), utf16.size()).countCodePoints());
+        TStringBase<char32_t> utf32;
+        ASSERT_TRUE(utf8ToUtf32(view, utf32));
+        ASSERT_EQ(numCodePoints, utf32.size());
+        for (size_t i = 0; i < codePoints.size(); ++i) {
+            ASSERT_EQ(codePoints[i], static_cast<uint32_t>(utf32[i]));
+        }
+
+        TStringBase<char> utf8;
+        ASSERT_TRUE(utf16ToUtf8(TStringView<char16_t>(utf16.c_str(), utf16.size()), utf8));
+        ASSERT_EQ(bytes.size(), utf8.size());
+        EXPECT_EQ(0, memcmp(bytes.data(), utf8.c_str(), bytes.size()));
+        ASSERT_TRUE(utf32ToUtf8(TStringView<char32_t>(utf32.c_str(), utf32.size()), utf8));
+        EXPECT_EQ(0, memcmp(bytes.data(), utf8.c_str(), bytes.size()));
+    });
+}
@@ -195,3 +195,216 @@ TEST_F( VariantTest, accessBooleanTest ) {
     Variant test1( test );
     EXPECT_EQ( test1, test );
 }
+
+TEST_F( VariantTest, accessFloat4x4Test ) {
+    float data[ 16 ];
+    for ( size_t i = 0; i < 16; ++i ) {
+        data[ i ] = static_cast<float>( i );
+    }
+    Variant test( Variant::Float4x4, (void*) data, 16 );
+    EXPECT_EQ( Variant::Float4x4, test.getType() );
+    EXPECT_EQ( 64u, test.getSize() );
+    EXPECT_TRUE( validateFloatData( 16, data, test.getFloat4x4() ) );
+
+    // Fixed-size types are stored inline
+    EXPECT_GE( test.getPtr(), static_cast<void*>( &test ) );
+    EXPECT_LT( test.getPtr(), static_cast<void*>( &test + 1 ) );
+}
+
+TEST_F( VariantTest, accessStringTest ) {
+    Variant test;
+    test.setStdString( "short" );
+    EXPECT_EQ( Variant::String, test.getType() );
+    EXPECT_STREQ( "short", test.getString() );
+    EXPECT_EQ( 6u, test.getSize() );
+
+    const std::string longString( 200, 'x' );
+    test.setStdString( longString );
+    EXPECT_EQ( longString, test.getString() );
+
+    test.setString( "", 0 );
+    EXPECT_STREQ( "", test.getString() );
+
+    char name[] = "player";
+    Variant fromData( Variant::String, (void*) name, 6 );
+    EXPECT_STREQ( "player", fromData.getString() );
+
+    test.setInt( 5 );
+    EXPECT_EQ( 5, test.getInt() );
+}
+
+TEST_F( VariantTest, selfSubstringTest ) {
+    // Heap source, inline result
+    Variant test;
+    std::string text( 100, 'x' );
+    text[ 10 ] = 'a';
+    test.setStdString( text );
+    test.setString( test.getString() + 10, 5 );
+    EXPECT_STREQ( "axxxx", test.getString() );
+    EXPECT_EQ( 6u, test.getSize() );
+
+    // Heap source, heap result
+    test.setStdString( text );
+    test.setString( test.getString() + 10, 80 );
+    EXPECT_EQ( text.substr( 10, 80 ), test.getString() );
+
+    // Inline source, inline result
+    test.setStdString( "inline string" );
+    test.setString( test.getString() + 7, 6 );
+    EXPECT_STREQ( "string", test.getString() );
+}
+
+TEST_F( VariantTest, assignTest ) {
+    const std::string longString( 100, 'y' );
+    Variant shortString, heapString, value;
+    shortString.setStdString( "inline" );
+    heapString.setStdString( longString );
+    value.setFloat3( 1.0f, 2.0f, 3.0f );
+
+    Variant test;
+    test = heapString;
+    EXPECT_EQ( test, heapString );
+    EXPECT_NE( test.getString(), heapString.getString() );
+    test = shortString;
+    EXPECT_EQ( test, shortString );
+    test = value;
+    EXPECT_EQ( test, value );
+    const Variant &self = test;
+    test = self;
+    EXPECT_EQ( 2.0f, test.getFloat3()[ 1 ] );
+
+    // The old value is always replaced, even if it compares equal
+    Variant other;
+    other.setInt( 1 );
+    test.setInt( 1 );
+    test = other;
+    EXPECT_EQ( 1, test.getInt() );
+}
+
+TEST_F( VariantTest, moveTest ) {
+    const std::string longString( 100, 'z' );
+    Variant heapString;
+    heapString.setStdString( longString );
+    const char *ptr = heapString.getString();
+
+    Variant moved( std::move( heapString ) );
+    EXPECT_EQ( Variant::Invalid, heapString.getType() );
+    EXPECT_EQ( ptr, moved.getString() );
+
+    Variant target;
+    target.setStdString( "old" );
+    target = std::move( moved );
+    EXPECT_EQ( ptr, target.getString() );
+    EXPECT_EQ( Variant::Invalid, moved.getType() );
+
+    Variant value;
+    value.setInt4( 1, 2, 3, 4 );
+    target = std::move( value );
+    EXPECT_EQ( 4, target.getInt4()[ 3 ] );
+}
+
+TEST_F( VariantTest, tryGetTest ) {
+    Variant test;
+    EXPECT_EQ( nullptr, test.tryGet<int32_t>() );
+
+    test.setInt( 42 );
+    ASSERT_NE( nullptr, test.tryGet<int32_t>() );
+    EXPECT_EQ( 42, *test.tryGet<int32_t>() );
+    EXPECT_EQ( nullptr, test.tryGet<float>() );
+    EXPECT_EQ( nullptr, test.tryGet<char>() );
+
+    test.setFloat3( 1.0f, 2.0f, 3.0f );
+    Variant::Float3Value *value = test.tryGet<Variant::Float3Value>();
+    ASSERT_NE( nullptr, value );
+    EXPECT_EQ( 2.0f, ( *value )[ 1 ] );
+    ( *value )[ 1 ] = 5.0f;
+    EXPECT_EQ( 5.0f, test.getFloat3()[ 1 ] );
+    EXPECT_EQ( nullptr, test.tryGet<Variant::Float4Value>() );
+
+    test.setStdString( "name" );
+    const Variant &constTest = test;
+    EXPECT_STREQ( "name", constTest.tryGet<char>() );
+
+    const Variant::Int4Value vec = { { 1, 2, 3, 4 } };
+    test.set( vec );
+    EXPECT_EQ( Variant::Int4, test.getType() );
+    EXPECT_EQ( 4, test.getInt4()[ 3 ] );
+    test.set( true );
+    EXPECT_TRUE( test.getBool() );
+    test.set( static_cast<uint8_t>( 7 ) );
+    EXPECT_EQ( 7, test.getByte() );
+}
+
+namespace {
+
+struct TypeNameVisitor {
+    const char *operator()( const Variant::InvalidValue & ) const { return "invalid"; }
+    const char *operator()( uint8_t ) const { return "byte"; }
+    const char *operator()( int32_t ) const { return "int"; }
+    const char *operator()( const Variant::Int3Value & ) const { return "int3"; }
+    const char *operator()( const Variant::Int4Value & ) const { return "int4"; }
+    const char *operator()( float ) const { return "float"; }
+    const char *operator()( const Variant::Float3Value & ) const { return "float3"; }
+    const char *operator()( const Variant::Float4Value & ) const { return "float4"; }
+    const char *operator()( const Variant::Float4x4Value & ) const { return "float4x4"; }
+    const char *operator()( const char * ) const { return "string"; }
+    const char *operator()( bool ) const { return "bool"; }
+};
+
+struct SumVisitor {
+    float operator()( const Variant::InvalidValue & ) const { return 0.0f; }
+    float operator()( const char *str ) const { return static_cast<float>( ::strlen( str ) ); }
+    template <class T, size_t N>
+    float operator()( const TVariantVector<T, N> &vec ) const {
+        float sum = 0.0f;
+        for ( size_t i = 0; i < N; ++i ) {
+            sum += static_cast<float>( vec[ i ] );
+        }
+        return sum;
+    }
+    template <class T>
+    float operator()( const T &value ) const { return static_cast<float>( value ); }
+};
+
+} // namespace
+
+TEST_F( VariantTest, visitTest ) {
+    Variant test;
+    TypeNameVisitor names;
+    EXPECT_STREQ( "invalid", test.visit( names ) );
+    test.setByte( 1 );
+    EXPECT_STREQ( "byte", test.visit( names ) );
+    test.setInt( 1 );
+    EXPECT_STREQ( "int", test.visit( names ) );
+    test.setInt3( 1, 2, 3 );
+    EXPECT_STREQ( "int3", test.visit( names ) );
+    test.setInt4( 1, 2, 3, 4 );
+    EXPECT_STREQ( "int4", test.visit( names ) );
+    test.setFloat( 1.0f );
+    EXPECT_STREQ( "float", test.visit( names ) );
+    test.setFloat3( 1.0f, 2.0f, 3.0f );
+    EXPECT_STREQ( "float3", test.visit( names ) );
+    test.setFloat4( 1.0f, 2.0f, 3.0f, 4.0f );
+    EXPECT_STREQ( "float4", test.visit( names ) );
+    float matrix[ 16 ] = {};
+    test.setFloat4x4( matrix );
+    EXPECT_STREQ( "float4x4", test.visit( names ) );
+    test.setStdString( "text" );
+    EXPECT_STREQ( "string", test.visit( names ) );
+    test.setBool( true );
+    EXPECT_STREQ( "bool", test.visit( names ) );
+
+    SumVisitor sum;
+    test.setInt4( 1, 2, 3, 4 );
+    EXPECT_EQ( 10.0f, test.visit( sum ) );
+    test.setFloat( 2.5f );
+    EXPECT_EQ( 2.5f, test.visit( sum ) );
+    test.setStdString( "text" );
+    EXPECT_EQ( 4.0f, test.visit( sum ) );
+
+    // Generic lambdas work as well
+    int numCalls = 0;
+    test.setFloat3( 1.0f, 2.0f, 3.0f );
+    test.visit( [ &numCalls ]( const auto & ) { ++numCalls; } );
+    EXPECT_EQ( 1, numCalls );
+}
@@ -24,6 +24,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 #include <cppcore/Container/TAlgorithm.h>
 #include <cppcore/Container/TArray.h>
+#include <cppcore/Common/CPUInfo.h>
+#include <cppcore/Common/TSpan.h>
 #include <cppcore/CPPCoreCommon.h>
 
 #include "gtest/gtest.h"
@@ -32,7 +34,67 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 using namespace cppcore;
 
-class TAlgorithmTest : public testing::Test {};
+class TAlgorithmTest : public testing::Test {
+protected:
+    void TearDown() override {
+        CPUInfo::setSimdLevelLimit(CPUInfo::SimdLevel::AVX2);
+    }
+
+    // Runs the check for every kernel level, sizes cover the unrolled loops and the tails
+    template <class TCheck>
+    void forAllLevels(TCheck check) {
+        const CPUInfo::SimdLevel levels[] = { CPUInfo::SimdLevel::AVX2, CPUInfo::SimdLevel::SSE42, CPUInfo::SimdLevel::Scalar };
+        for (CPUInfo::SimdLevel level : levels) {
+            CPUInfo::setSimdLevelLimit(level);
+            for (size_t size : { 0u, 1u, 3u, 7u, 8u, 31u, 32u, 33u, 100u, 1000u }) {
+                check(size);
+            }
+        }
+    }
+
+    template <class T>
+    void checkSearch() {
+        forAllLevels([](size_t size) {
+            TArray<T> arr;
+            for (size_t i = 0; i < size; ++i) {
+                arr.add(static_cast<T>(i % 17));
+            }
+            for (T value : { T(0), T(5), T(16), T(42) }) {
+                EXPECT_EQ(Details::findScalar(arr.data(), arr.size(), value), static_cast<size_t>(find(arr, value) - arr.data()));
+                EXPECT_EQ(Details::countScalar(arr.data(), arr.size(), value), count(arr, value));
+            }
+            if (size > 0) {
+                arr[size - 1] = T(42);
+                EXPECT_EQ(size - 1, static_cast<size_t>(find(arr, T(42)) - arr.data()));
+            }
+
+            TArray<T> expected(arr);
+            Details::replaceScalar(expected.data(), expected.size(), T(3), T(99));
+            replace(arr, T(3), T(99));
+            for (size_t i = 0; i < size; ++i) {
+                EXPECT_EQ(expected[i], arr[i]);
+            }
+        });
+    }
+
+    template <class T>
+    void checkMinMax() {
+        forAllLevels([](size_t size) {
+            TArray<T> arr;
+            for (size_t i = 0; i < size; ++i) {
+                arr.add(static_cast<T>((i * 37) % 101) - static_cast<T>(50));
+            }
+            T minValue = T(0), maxValue = T(0);
+            EXPECT_EQ(size != 0, minMax(arr, minValue, maxValue));
+            if (size != 0) {
+                T expectedMin, expectedMax;
+                Details::minMaxScalar(arr.data(), arr.size(), expectedMin, expectedMax);
+                EXPECT_EQ(expectedMin, minValue);
+                EXPECT_EQ(expectedMax, maxValue);
+            }
+        });
+    }
+};
 
 TEST_F(TAlgorithmTest, distanceTest) {
     TArray<float> theArray;
@@ -46,3 +108,93 @@ TEST_F(TAlgorithmTest, distanceTest) {
     dist = distance(theArray.begin()+1, theArray.end());
     EXPECT_EQ(dist, 2u);
 }
+
+TEST_F(TAlgorithmTest, findTest) {
+    checkSearch<int32_t>();
+    checkSearch<uint32_t>();
+    checkSearch<int64_t>();
+    checkSearch<uint64_t>();
+    checkSearch<float>();
+    checkSearch<double>();
+    checkSearch<short>();
+}
+
+TEST_F(TAlgorithmTest, findSpanTest) {
+    int data[] = { 1, 2, 3, 4 };
+    TSpan<int> span(data, 4);
+    EXPECT_EQ(&data[2], find(span, 3));
+    EXPECT_EQ(span.data() + 4, find(span, 5));
+    EXPECT_EQ(1u, count(span, 4));
+
+    TArray<float> arr;
+    arr.add(1.0f);
+    arr.add(-0.0f);
+    EXPECT_EQ(arr.begin() + 1, arr.linearSearch(0.0f));
+    EXPECT_EQ(arr.end(), arr.linearSearch(2.0f));
+}
+
+TEST_F(TAlgorithmTest, minMaxTest) {
+    checkMinMax<int32_t>();
+    checkMinMax<uint32_t>();
+    checkMinMax<int64_t>();
+    checkMinMax<float>();
+    checkMinMax<double>();
+    checkMinMax<int16_t>();
+
+    uint32_t data[] = { 0x80000000u, 1u, 0xffffffffu, 7u, 3u, 2u, 9u, 8u, 4u };
+    uint32_t minValue = 0, maxValue = 0;
+    EXPECT_TRUE(minMax(TSpan<uint32_t>(data, 9), minValue, maxValue));
+    EXPECT_EQ(1u, minValue);
+    EXPECT_EQ(0xffffffffu, maxValue);
+}
+
+TEST_F(TAlgorithmTest, sumTest) {
+    forAllLevels([](size_t size) {
+        TArray<int32_t> ints;
+        TArray<uint64_t> longs;
+        TArray<double> doubles;
+        for (size_t i = 0; i < size; ++i) {
+            ints.add(static_cast<int32_t>(i * 1000003));
+            longs.add(static_cast<uint64_t>(i) << 40);
+            doubles.add(static_cast<double>(i) * 0.5);
+        }
+        EXPECT_EQ(Details::sumScalarWrapped(ints.data(), size, std::true_type()), sum(ints));
+        EXPECT_EQ(Details::sumScalarWrapped(longs.data(), size, std::true_type()), sum(longs));
+        EXPECT_DOUBLE_EQ(Details::sumScalar(doubles.data(), size), sum(doubles));
+    });
+
+    TArray<float> empty;
+    EXPECT_EQ(0.0f, sum(empty));
+}
+
+TEST_F(TAlgorithmTest, prefixSumTest) {
+    forAllLevels([](size_t size) {
+        TArray<int32_t> ints;
+        TArray<float> floats;
+        for (size_t i = 0; i < size; ++i) {
+            ints.add(static_cast<int32_t>(i) - 10);
+            floats.add(1.0f);
+        }
+        TArray<int32_t> expected(ints);
+        Details::prefixSumScalar(expected.data(), expected.data(), size);
+        prefixSum(ints);
+        prefixSum(floats);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(expected[i], ints[i]);
+            EXPECT_EQ(static_cast<float>(i + 1), floats[i]);
+        }
+    });
+}
+
+TEST_F(TAlgorithmTest, anyOfAllOfTest) {
+    TArray<int> arr;
+    EXPECT_FALSE(anyOf(arr, [](int v) { return v > 0; }));
+    EXPECT_TRUE(allOf(arr, [](int v) { return v > 0; }));
+
+    arr.add(1);
+    arr.add(2);
+    arr.add(-3);
+    EXPECT_TRUE(anyOf(arr, [](int v) { return v < 0; }));
+    EXPECT_FALSE(allOf(arr, [](int v) { return v > 0; }));
+    EXPECT_TRUE(allOf(arr, [](int v) { return v != 0; }));
+}
@@ -78,6 +78,15 @@ TEST_F( TArrayTest, constructWithSizeTest) {
     }
 }
 
+TEST_F( TArrayTest, constructWithBigSizeTest) {
+    // Bigger than the capped growing size, must not allocate twice
+    TArray<int> arrayInstance( 100000 );
+    EXPECT_EQ( 100000u, arrayInstance.size() );
+    EXPECT_LE( 100000u, arrayInstance.capacity() );
+    arrayInstance[ 99999 ] = 1;
+    EXPECT_EQ( 1, arrayInstance.back() );
+}
+
 TEST_F( TArrayTest, addTest) {
     TArray<float> arrayInstance;
     arrayInstance.add( 0.0f );
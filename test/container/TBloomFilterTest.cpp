@@ -0,0 +1,109 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Container/TBloomFilter.h>
+
+#include "gtest/gtest.h"
+
+using namespace cppcore;
+
+class TBloomFilterTest : public testing::Test {};
+
+TEST_F(TBloomFilterTest, createTest) {
+    TBloomFilter<uint64_t> filter(1000, 0.01);
+    EXPECT_GE(filter.numBits(), 9000u);
+    EXPECT_EQ(0u, filter.numBits() % 512);
+    EXPECT_GE(filter.numHashes(), 6u);
+    EXPECT_FALSE(filter.mayContain(1));
+
+    TBloomFilter<uint64_t> emptyFilter;
+    EXPECT_FALSE(emptyFilter.mayContain(1));
+}
+
+TEST_F(TBloomFilterTest, noFalseNegativesTest) {
+    static constexpr uint64_t NumItems = 10000;
+    TBloomFilter<uint64_t> filter(NumItems, 0.01);
+    for (uint64_t i = 0; i < NumItems; ++i) {
+        filter.add(i * 7919);
+    }
+    for (uint64_t i = 0; i < NumItems; ++i) {
+        EXPECT_TRUE(filter.mayContain(i * 7919));
+    }
+
+    filter.clear();
+    EXPECT_FALSE(filter.mayContain(0));
+}
+
+TEST_F(TBloomFilterTest, falsePositiveRateTest) {
+    static constexpr uint64_t NumItems = 20000;
+    TBloomFilter<uint64_t> filter(NumItems, 0.01);
+    for (uint64_t i = 0; i < NumItems; ++i) {
+        filter.add(i);
+    }
+
+    size_t falsePositives = 0;
+    for (uint64_t i = NumItems; i < NumItems * 11; ++i) {
+        if (filter.mayContain(i)) {
+            ++falsePositives;
+        }
+    }
+    const double rate = static_cast<double>(falsePositives) / static_cast<double>(NumItems * 10);
+    EXPECT_LT(rate, 0.02);
+}
+
+TEST_F(TBloomFilterTest, hashTest) {
+    TBloomFilter<uint64_t> filter(100, 0.01);
+    const char key[] = "assets/texture.png";
+    const HashId hash = hash64(key, sizeof(key) - 1);
+    filter.addHash(hash);
+    EXPECT_TRUE(filter.mayContainHash(hash));
+}
+
+TEST_F(TBloomFilterTest, countingAddRemoveTest) {
+    static constexpr uint64_t NumItems = 1000;
+    TCountingBloomFilter<uint64_t> filter(NumItems, 0.01);
+    EXPECT_GE(filter.numCounters(), 9000u);
+    for (uint64_t i = 0; i < NumItems; ++i) {
+        filter.add(i);
+    }
+    for (uint64_t i = 0; i < NumItems; ++i) {
+        EXPECT_TRUE(filter.mayContain(i));
+    }
+
+    for (uint64_t i = 0; i < NumItems; i += 2) {
+        filter.remove(i);
+    }
+    size_t stillFound = 0;
+    for (uint64_t i = 0; i < NumItems; ++i) {
+        if (i % 2 == 1) {
+            EXPECT_TRUE(filter.mayContain(i));
+        } else if (filter.mayContain(i)) {
+            ++stillFound;
+        }
+    }
+    EXPECT_LT(stillFound, NumItems / 20);
+
+    filter.clear();
+    EXPECT_FALSE(filter.mayContain(1));
+}
@@ -0,0 +1,62 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Container/TEytzingerArray.h>
+
+#include "gtest/gtest.h"
+
+using namespace cppcore;
+
+class TEytzingerArrayTest : public testing::Test {};
+
+TEST_F(TEytzingerArrayTest, lowerBoundTest) {
+    for (size_t num : { 0u, 1u, 2u, 3u, 7u, 8u, 100u, 1023u, 1024u, 5000u }) {
+        // Even values with duplicates
+        TArray<int32_t> sorted(num);
+        for (size_t i = 0; i < num; ++i) {
+            sorted[i] = static_cast<int32_t>(i / 3) * 2;
+        }
+        TEytzingerArray<int32_t> table(sorted.data(), num);
+        EXPECT_EQ(num, table.size());
+
+        for (int32_t key = -1; key <= static_cast<int32_t>(num) + 1; ++key) {
+            const size_t expected = lowerBound(sorted.data(), num, key);
+            EXPECT_EQ(expected, table.lowerBound(key));
+            EXPECT_EQ(expected < num && sorted[expected] == key, table.contains(key));
+        }
+        for (size_t i = 0; i < num; ++i) {
+            EXPECT_EQ(sorted[i], table.at(i));
+        }
+    }
+}
+
+TEST_F(TEytzingerArrayTest, compareTest) {
+    float sorted[] = { 9.0f, 7.5f, 3.0f, 1.0f };
+    auto greater = [](float lhs, float rhs) { return lhs > rhs; };
+    TEytzingerArray<float, decltype(greater)> table(sorted, 4, greater);
+    EXPECT_EQ(2u, table.lowerBound(5.0f));
+    EXPECT_EQ(0u, table.lowerBound(10.0f));
+    EXPECT_EQ(4u, table.lowerBound(0.5f));
+    EXPECT_TRUE(table.contains(7.5f));
+}
@@ -0,0 +1,146 @@
+/*
+-------------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2014-2025 Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-------------------------------------------------------------------------------------------------
+*/
+#include <cppcore/Container/TParallelAlgorithm.h>
+#include <cppcore/Common/TSpan.h>
+
+#include "gtest/gtest.h"
+
+using namespace cppcore;
+
+class TParallelAlgorithmTest : public testing::Test {
+protected:
+    TParallelAlgorithmTest() : mPool(3) {}
+
+    // Sequential, automatic chunks and very small chunks
+    template <class TCheck>
+    void forAllPolicies(TCheck check) {
+        check(ExecutionPolicy::sequential());
+        check(ExecutionPolicy::parallel(&mPool));
+        check(ExecutionPolicy::parallel(&mPool, 7));
+    }
+
+    ThreadPool mPool;
+};
+
+TEST_F(TParallelAlgorithmTest, forEachTest) {
+    forAllPolicies([](const ExecutionPolicy &policy) {
+        TArray<int> arr(1000);
+        for (size_t i = 0; i < arr.size(); ++i) {
+            arr[i] = static_cast<int>(i);
+        }
+        parallelForEach(policy, arr, [](int &value) {
+            value *= 2;
+        });
+        for (size_t i = 0; i < arr.size(); ++i) {
+            EXPECT_EQ(static_cast<int>(i) * 2, arr[i]);
+        }
+    });
+}
+
+TEST_F(TParallelAlgorithmTest, transformTest) {
+    forAllPolicies([](const ExecutionPolicy &policy) {
+        float in[100];
+        for (size_t i = 0; i < 100; ++i) {
+            in[i] = static_cast<float>(i);
+        }
+        TArray<int> out(100);
+        parallelTransform(policy, TSpan<float>(in, 100), out, [](float value) {
+            return static_cast<int>(value) + 1;
+        });
+        for (size_t i = 0; i < 100; ++i) {
+            EXPECT_EQ(static_cast<int>(i) + 1, out[i]);
+        }
+    });
+}
+
+TEST_F(TParallelAlgorithmTest, reduceTest) {
+    forAllPolicies([](const ExecutionPolicy &policy) {
+        TArray<uint64_t> arr(12345);
+        for (size_t i = 0; i < arr.size(); ++i) {
+            arr[i] = i;
+        }
+        const uint64_t expected = 12345ull * 12344ull / 2ull;
+        EXPECT_EQ(expected + 10, parallelReduce(policy, arr, uint64_t(10), [](uint64_t a, uint64_t b) { return a + b; }));
+
+        TArray<uint64_t> empty;
+        EXPECT_EQ(7u, parallelReduce(policy, empty, uint64_t(7), [](uint64_t a, uint64_t b) { return a + b; }));
+
+        // Not commutative, but associative: the order must be kept
+        TArray<int> digits(5);
+        for (size_t i = 0; i < 5; ++i) {
+            digits[i] = static_cast<int>(i) + 1;
+        }
+        EXPECT_EQ(12345, parallelReduce(policy, digits, 0, [](int a, int b) {
+            int scale = 1;
+            while (scale <= b) {
+                scale *= 10;
+            }
+            return a * scale + b;
+        }));
+    });
+}
+
+TEST_F(TParallelAlgorithmTest, scanTest) {
+    forAllPolicies([](const ExecutionPolicy &policy) {
+        for (size_t size : { 1u, 2u, 5u, 100u, 1001u }) {
+            TArray<int> arr(size);
+            for (size_t i = 0; i < size; ++i) {
+                arr[i] = static_cast<int>(i % 7) - 3;
+            }
+            TArray<int> expected(arr);
+            Details::prefixSumScalar(expected.data(), expected.data(), size);
+
+            // In place
+            parallelScan(policy, arr, arr, [](int a, int b) { return a + b; });
+            for (size_t i = 0; i < size; ++i) {
+                EXPECT_EQ(expected[i], arr[i]);
+            }
+        }
+    });
+}
+
+TEST_F(TParallelAlgorithmTest, sortTest) {
+    forAllPolicies([](const ExecutionPolicy &policy) {
+        // The last size is far above the parallel threshold, so the merge buffers are used
+        const size_t sizes[] = { 0u, 1u, 2u, 13u, 1000u, 50003u, 4 * Details::ParallelSortThreshold + 3 };
+        for (size_t size : sizes) {
+            TArray<uint32_t> arr(size);
+            uint32_t state = 12345u;
+            for (size_t i = 0; i < size; ++i) {
+                state = state * 1664525u + 1013904223u;
+                arr[i] = state >> 8;
+            }
+            parallelSort(policy, arr);
+            for (size_t i = 1; i < size; ++i) {
+                EXPECT_LE(arr[i - 1], arr[i]);
+            }
+
+            parallelSort(policy, arr, [](uint32_t a, uint32_t b) { return a > b; });
+            for (size_t i = 1; i < size; ++i) {
+                EXPECT_GE(arr[i - 1], arr[i]);
+            }
+        }
+    });
+}
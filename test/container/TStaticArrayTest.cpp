@@ -106,3 +106,64 @@ TEST_F(TStaticArrayTest, copyTest) {
     }
 }
 
+
+namespace {
+
+constexpr TStaticArray<int, 8> makeSquares() {
+    TStaticArray<int, 8> table;
+    for (size_t i = 0; i < table.size(); ++i) {
+        table[i] = static_cast<int>(i * i);
+    }
+    return table;
+}
+
+} // namespace
+
+TEST_F(TStaticArrayTest, constexprTest) {
+    static constexpr TStaticArray<int, 8> Squares = makeSquares();
+    static_assert(Squares[3] == 9, "Table must be built at compile time.");
+    static_assert(Squares.size() == 8, "Size must be a compile-time constant.");
+    static_assert(sizeof(TStaticArray<int, 8>) == sizeof(int) * 8, "No size shall be stored.");
+    static_assert(std::is_trivially_copyable<TStaticArray<int, 8>>::value, "Copies shall be a memcpy.");
+
+    static constexpr TStaticArray<int, 4> Values = { 1, 2, 3 };
+    static_assert(Values[2] == 3 && Values[3] == 0, "Missing items shall be value-initialized.");
+
+    static constexpr TStaticArray<int, 4> Filled(7);
+    static_assert(Filled[3] == 7, "Fill constructor shall work at compile time.");
+
+    // A single value in braces fills the array, like before the value lists
+    static constexpr TStaticArray<int, 4> BracedFill{ 7 };
+    static_assert(BracedFill[0] == 7 && BracedFill[3] == 7, "{x} shall fill the whole array.");
+    EXPECT_EQ(49, Squares[7]);
+}
+
+TEST_F(TStaticArrayTest, compareTest) {
+    TStaticArray<int, 16> arr1(3);
+    TStaticArray<int, 16> arr2(3);
+    EXPECT_EQ(arr1, arr2);
+    arr2[15] = 4;
+    EXPECT_NE(arr1, arr2);
+    arr1 = arr2;
+    EXPECT_EQ(arr1, arr2);
+
+    TStaticArray<std::string, 2> str1(std::string("a"));
+    TStaticArray<std::string, 2> str2(std::string("a"));
+    EXPECT_EQ(str1, str2);
+    str2[1] = "b";
+    EXPECT_NE(str1, str2);
+}
+
+TEST_F(TStaticArrayTest, memsetTest) {
+    TStaticArray<char, 32> chars;
+    chars.memset('x');
+    for (char c : chars) {
+        EXPECT_EQ('x', c);
+    }
+
+    TStaticArray<float, 32> floats;
+    floats.memset(1.5f);
+    for (float f : floats) {
+        EXPECT_EQ(1.5f, f);
+    }
+}